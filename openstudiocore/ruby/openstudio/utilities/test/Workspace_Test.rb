@@ -50,6 +50,26 @@ class Workspace_Test < MiniTest::Unit::TestCase
     
   end
 
+  def test_BulkFieldAccess
+
+    idfPath = OpenStudio::Path.new($OpenStudio_ResourcePath + "resultsviewer/SmallOffice/SmallOffice.idf")
+    workspace = OpenStudio::Workspace::load(idfPath).get
+    zoneType = "Zone".to_IddObjectType
+
+    # one call per column, rows in the order of getHandlesByType
+    handles = workspace.getHandlesByType(zoneType)
+    assert_equal(6, handles.size())
+    names = workspace.getStringColumn(zoneType, 0).to_a
+    assert_equal(6, names.size())
+    assert_equal(workspace.getObject(handles[0]).get.name.get, names[0])
+
+    # one call to set a column from a Ruby Array
+    assert(workspace.setDoubleColumn(zoneType, 2, Array.new(6, 3.0)))
+    workspace.getDoubleColumn(zoneType, 2).each { |x| assert_equal(3.0, x) }
+    assert((not workspace.setDoubleColumn(zoneType, 2, [1.0])))
+
+  end
+
 end
 
 
@@ -184,6 +184,17 @@ namespace detail {
     dataPoint.cast<OptimizationDataPoint>().setObjectiveValues(objectiveFunctionValues);
   }
 
+  void OptimizationProblem_Impl::updateDataPoint(DataPoint& dataPoint,
+                                                 const runmanager::Files& resultFiles) const
+  {
+    Problem_Impl::updateDataPoint(dataPoint,resultFiles);
+    DoubleVector objectiveFunctionValues;
+    for (const Function& objectiveFunction : objectives()) {
+      objectiveFunctionValues.push_back(objectiveFunction.getValue(dataPoint));
+    }
+    dataPoint.cast<OptimizationDataPoint>().setObjectiveValues(objectiveFunctionValues);
+  }
+
   boost::optional<std::string> OptimizationProblem_Impl::getDakotaResultsFile(
       const DataPoint& dataPoint) const
   {
@@ -102,6 +102,9 @@ namespace detail {
     virtual void updateDataPoint(DataPoint& dataPoint,
                                  const runmanager::Job& completedJob) const;
 
+    virtual void updateDataPoint(DataPoint& dataPoint,
+                                 const runmanager::Files& resultFiles) const;
+
     /** Returns the DAKOTA results file string corresponding to dataPoint, if dataPoint completed
      *  successfully. Returns boost::none otherwise. */
     virtual boost::optional<std::string> getDakotaResultsFile(const DataPoint& dataPoint) const;
@@ -46,6 +46,7 @@
 #include "UncertaintyDescription_Impl.hpp"
 #include "WorkflowStep_Impl.hpp"
 
+#include "../runmanager/lib/FileInfo.hpp"
 #include "../runmanager/lib/WorkItem.hpp"
 #include "../runmanager/lib/Workflow.hpp"
 #include "../runmanager/lib/MergedJobResults.hpp"
@@ -1524,8 +1525,19 @@ namespace detail {
       return;
     }
 
-    runmanager::Files allFiles = completedJob.treeAllFiles();
+    attachResultFiles(dataPoint,completedJob.treeAllFiles());
+  }
+
+  void Problem_Impl::updateDataPoint(DataPoint& dataPoint,
+                                     const runmanager::Files& resultFiles) const
+  {
+    dataPoint.markComplete();
+    attachResultFiles(dataPoint,resultFiles);
+  }
 
+  void Problem_Impl::attachResultFiles(DataPoint& dataPoint,
+                                       const runmanager::Files& allFiles) const
+  {
     // Add input files
     try {
       openstudio::path osmInputDataPath = allFiles.getLastByExtension("osm").fullPath;
@@ -2601,6 +2613,12 @@ void Problem::updateDataPoint(DataPoint& dataPoint,
   getImpl<detail::Problem_Impl>()->updateDataPoint(dataPoint,completedJob);
 }
 
+void Problem::updateDataPoint(DataPoint& dataPoint,
+                              const runmanager::Files& resultFiles) const
+{
+  getImpl<detail::Problem_Impl>()->updateDataPoint(dataPoint,resultFiles);
+}
+
 std::vector<WorkflowStepJob> Problem::getJobsByWorkflowStep(const DataPoint& dataPoint,
                                                             bool optimize) const
 {
@@ -42,6 +42,7 @@ namespace ruleset {
 }
 
 namespace runmanager {
+  class Files;
   class Job;
   class JobType;
   class Workflow;
@@ -373,6 +374,12 @@ class ANALYSIS_API Problem : public AnalysisObject {
   void updateDataPoint(DataPoint& dataPoint,
                        const runmanager::Job& completedJob) const;
 
+  /** Updates dataPoint from the files of a previous, successful simulation of the same inputs
+   *  (for instance, as restored by analysisdriver::DataPointResultCache), without requiring a
+   *  runmanager::Job. */
+  void updateDataPoint(DataPoint& dataPoint,
+                       const runmanager::Files& resultFiles) const;
+
   /** Returns the jobs stored in dataPoint broken down by WorkflowStep. Can be used to extract
    *  errors and warnings on a per-WorkflowStep basis. If optimize, steps that evaluate to null
    *  jobs are removed from the return vector. */
@@ -37,6 +37,7 @@ namespace ruleset {
 }
 
 namespace runmanager {
+  class Files;
   class Job;
   class JobType;
   class Workflow;
@@ -265,6 +266,9 @@ namespace detail {
     virtual void updateDataPoint(DataPoint& dataPoint,
                                  const runmanager::Job& completedJob) const;
 
+    virtual void updateDataPoint(DataPoint& dataPoint,
+                                 const runmanager::Files& resultFiles) const;
+
     /** Returns the jobs stored in dataPoint broken down by WorkflowStep. Can be used to extract
      *  errors and warnings on a per-WorkflowStep basis. If optimize, steps that evaluate to null
      *  jobs are removed from the return vector. */
@@ -306,6 +310,11 @@ namespace detail {
     std::vector<WorkflowStep> m_workflow; // InputVariables and runmanager WorkItems applied in order
     std::vector<Function> m_responses; // response functions.
 
+    /** Sets dataPoint's input and output data from resultFiles and evaluates the response
+     *  functions. Shared by both updateDataPoint overloads. */
+    void attachResultFiles(DataPoint& dataPoint,
+                           const runmanager::Files& resultFiles) const;
+
    private:
     std::vector<WorkflowStep> convertVariablesAndWorkflowToWorkflowSteps(const std::vector<Variable>& variables,
                                                                          const runmanager::Workflow& simulationWorkflow) const;
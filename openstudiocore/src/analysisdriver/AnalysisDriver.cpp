@@ -21,6 +21,7 @@
 #include "AnalysisDriver_Impl.hpp"
 #include "AnalysisRunOptions.hpp"
 #include "CurrentAnalysis.hpp"
+#include "DataPointResultCache.hpp"
 #include "CurrentAnalysis_Impl.hpp"
 
 #include "../analysis/Analysis.hpp"
@@ -31,6 +32,12 @@
 #include "../analysis/DakotaAlgorithm_Impl.hpp"
 #include "../analysis/DataPoint.hpp"
 #include "../analysis/DataPoint_Impl.hpp"
+#include "../analysis/MeasureGroup.hpp"
+#include "../analysis/MeasureGroup_Impl.hpp"
+#include "../analysis/RubyContinuousVariable.hpp"
+#include "../analysis/RubyContinuousVariable_Impl.hpp"
+#include "../analysis/RubyMeasure.hpp"
+#include "../analysis/RubyMeasure_Impl.hpp"
 #include "../analysis/DakotaParametersFile.hpp"
 
 #include "../project/AnalysisRecord.hpp"
@@ -369,6 +376,7 @@ namespace detail {
           << "'. Parent job uuid is '" << toString(job->uuid()) << "'.");
       analysis.problem().updateDataPoint(*dataPoint,*job);
       OS_ASSERT(dataPoint->isComplete());
+      storeInResultCache(currentAnalysis,*dataPoint);
 
       // create new data points as appropriate
       bool callQueueJobs(false);
@@ -479,6 +487,9 @@ namespace detail {
   }
 
   void AnalysisDriver_Impl::catchAnalysisCompleteOrStopped(const openstudio::UUID& analysisUUID) {
+    // the next run hashes the seed, weather file and measures again, they may have been edited
+    m_resultCacheInputsKeys.erase(analysisUUID);
+
     if (m_currentAnalyses.empty()) {
       LOG(Debug, "AnalysisDriver no longer running.");
       m_running = false;
@@ -532,6 +543,64 @@ namespace detail {
         ++dpit;
       }
     }
+
+    // Complete any DataPoints whose inputs have already been simulated from the result cache.
+    AnalysisRunOptions runOptions = currentAnalysis->runOptions();
+    std::map<openstudio::UUID, runmanager::Workflow> workflows;
+    if (runOptions.resultCache()) {
+      DataPointVector completedFromCache;
+      Problem problem = analysis.problem();
+      dpit = dataPoints.begin();
+      while (dpit != dataPoints.end()) {
+        // points that already missed are waiting on queue space, no need to look them up again
+        if (m_resultCacheKeys.find(dpit->uuid()) != m_resultCacheKeys.end()) {
+          ++dpit;
+          continue;
+        }
+        runmanager::Workflow workflow = createDataPointWorkflow(problem,*dpit,runOptions);
+        if (completeFromResultCache(*currentAnalysis,workflow,*dpit)) {
+          completedFromCache.push_back(*dpit);
+          dpit = dataPoints.erase(dpit);
+        } else {
+          workflows.insert(std::make_pair(dpit->uuid(),workflow));
+          ++dpit;
+        }
+      }
+
+      if (!completedFromCache.empty()) {
+        // points left over from a partially queued iteration are already counted in it
+        if (currentAnalysis->numCompletedJobsInOSIteration() < currentAnalysis->totalNumJobsInOSIteration()) {
+          currentAnalysis->getImpl()->addCompletedOSDataPoints(completedFromCache);
+        }
+
+        AnalysisDriver copyOfThis = getAnalysisDriver();
+        saveAnalysis(analysis,copyOfThis);
+        for (const DataPoint& dataPoint : completedFromCache) {
+          emit dataPointComplete(analysis.uuid(),dataPoint.uuid());
+        }
+        emit resultsChanged();
+
+        if (dataPoints.empty() && (currentAnalysis->numQueuedOSJobs() > 0)) {
+          // wait for the jobs that are still running
+          return;
+        }
+
+        // an OpenStudioAlgorithm may be able to move on without simulating anything
+        if (dataPoints.empty()) {
+          if (OptionalOpenStudioAlgorithm osAlgorithm = getOpenStudioAlgorithm(analysis)) {
+            int n = osAlgorithm->createNextIteration(analysis);
+            LOG(Info,"OpenStudioAlgorithm '" << osAlgorithm->name() << "' created " << n
+                << " new DataPoints.");
+            if (n > 0) {
+              saveAnalysis(analysis,copyOfThis);
+              queueJobs(currentAnalysis);
+              return;
+            }
+          }
+        }
+      }
+    }
+
     if (dataPoints.empty()) {
       // Declare analysis complete if possible
       bool analysisCompleteFlag(false);
@@ -562,7 +631,6 @@ namespace detail {
     }
 
     // Handle queue pausing behavior.
-    AnalysisRunOptions runOptions = currentAnalysis->runOptions();
     QueuePausingBehavior queuePausingBehavior = runOptions.queuePausingBehavior();
     int firstN = runOptions.firstN();
     if (queuePausingBehavior != QueuePausingBehavior::NoPause) {
@@ -582,8 +650,6 @@ namespace detail {
       if (analysis.weatherFile()) {
         weatherFile = analysis.weatherFile().get().path();
       }
-      openstudio::path workingDirectory = runOptions.workingDirectory();
-      openstudio::path rubyIncludeDirectory = runOptions.rubyIncludeDirectory();
       std::vector<URLSearchPath> urlSearchPaths = runOptions.urlSearchPaths();
       bool force = runOptions.force();
       OptionalInt queueSize = runOptions.queueSize();
@@ -596,36 +662,15 @@ namespace detail {
         }
 
         // create workflow
-        runmanager::Workflow workflow = problem.createWorkflow(dataPoint,rubyIncludeDirectory);
-        openstudio::runmanager::JobParams params;
-        params.append("cleanoutfiles", runOptions.jobCleanUpBehavior().valueName());
-        workflow.add(params);
-        if (boost::optional<runmanager::Tools> tools = runOptions.runManagerTools()) {
-          workflow.add(*tools);
-        }
+        auto wit = workflows.find(dataPoint.uuid());
+        runmanager::Workflow workflow = (wit != workflows.end()) ? wit->second :
+            createDataPointWorkflow(problem,dataPoint,runOptions);
 
-        // get DataPointRecord and determine run directory
-        DataPointRecord dataPointRecord =
-            database().getObjectRecordByHandle<DataPointRecord>(dataPoint.uuid()).get();
-        std::stringstream ss;
-        ss << "dataPoint" << dataPointRecord.id();
+        // determine run directory
         openstudio::path seedPath = boost::filesystem::complete(analysis.seed().path());
-        openstudio::path runDir = boost::filesystem::complete(workingDirectory / toPath(ss.str()));
-        dataPoint.setDirectory(runDir);
-        if (boost::filesystem::exists(runDir)) {
-          // rerunning--clear out old data
-          try {
-            boost::filesystem::remove_all(runDir);
-          }
-          catch (std::exception& e) {
-            LOG(Warn,"Tried to erase old data before re-running data point, but was unable to, "
-                << "because " << e.what() << ". You may see multiple similar and conflicting "
-                << "sub-folders in " << toString(runDir) << ".");
-          }
-        }
-        boost::filesystem::create_directory(runDir);
+        openstudio::path runDir = prepareRunDirectory(dataPoint,runOptions);
 
-        LOG(Info,"Queuing user or OpenStudioAlgorithm generated '" << ss.str() << "'.");
+        LOG(Info,"Queuing user or OpenStudioAlgorithm generated '" << toString(runDir.filename()) << "'.");
 
         runmanager::Job job = workflow.create(runDir,seedPath,weatherFile,urlSearchPaths);
         runmanager::JobFactory::optimizeJobTree(job);
@@ -664,6 +709,162 @@ namespace detail {
     }
   }
 
+  runmanager::Workflow AnalysisDriver_Impl::createDataPointWorkflow(const analysis::Problem& problem,
+                                                                   const analysis::DataPoint& dataPoint,
+                                                                   const AnalysisRunOptions& runOptions) const
+  {
+    runmanager::Workflow workflow = problem.createWorkflow(dataPoint,runOptions.rubyIncludeDirectory());
+    openstudio::runmanager::JobParams params;
+    params.append("cleanoutfiles", runOptions.jobCleanUpBehavior().valueName());
+    workflow.add(params);
+    if (boost::optional<runmanager::Tools> tools = runOptions.runManagerTools()) {
+      workflow.add(*tools);
+    }
+    return workflow;
+  }
+
+  openstudio::path AnalysisDriver_Impl::prepareRunDirectory(analysis::DataPoint& dataPoint,
+                                                            const AnalysisRunOptions& runOptions)
+  {
+    // get DataPointRecord and determine run directory
+    DataPointRecord dataPointRecord =
+        database().getObjectRecordByHandle<DataPointRecord>(dataPoint.uuid()).get();
+    std::stringstream ss;
+    ss << "dataPoint" << dataPointRecord.id();
+    openstudio::path runDir = boost::filesystem::complete(runOptions.workingDirectory() / toPath(ss.str()));
+    dataPoint.setDirectory(runDir);
+    if (boost::filesystem::exists(runDir)) {
+      // rerunning--clear out old data
+      try {
+        boost::filesystem::remove_all(runDir);
+      }
+      catch (std::exception& e) {
+        LOG(Warn,"Tried to erase old data before re-running data point, but was unable to, "
+            << "because " << e.what() << ". You may see multiple similar and conflicting "
+            << "sub-folders in " << toString(runDir) << ".");
+      }
+    }
+    boost::filesystem::create_directory(runDir);
+    return runDir;
+  }
+
+  std::string AnalysisDriver_Impl::resultCacheInputsKey(const analysis::Analysis& analysis,
+                                                        const AnalysisRunOptions& runOptions)
+  {
+    auto it = m_resultCacheInputsKeys.find(analysis.uuid());
+    if (it != m_resultCacheInputsKeys.end()) {
+      return it->second;
+    }
+
+    openstudio::path seedPath = boost::filesystem::complete(analysis.seed().path());
+    openstudio::path weatherFile;
+    if (analysis.weatherFile()) {
+      weatherFile = analysis.weatherFile().get().path();
+    }
+
+    std::string energyPlusVersion;
+    runmanager::Tools tools = database().runManager().getConfigOptions().getTools();
+    if (boost::optional<runmanager::Tools> runOptionsTools = runOptions.runManagerTools()) {
+      tools = *runOptionsTools;
+    }
+    try {
+      energyPlusVersion = tools.getTool("energyplus").version.toString();
+    }
+    catch (...) {}
+
+    // workflow keys only carry measure paths, so hash every measure the problem can apply
+    std::vector<openstudio::path> measures;
+    auto addMeasure = [&measures](const RubyMeasure& measure) {
+      if (measure.usesBCLMeasure()) {
+        measures.push_back(measure.bclMeasureDirectory());
+      }
+      else {
+        measures.push_back(measure.perturbationScript().path());
+      }
+    };
+    for (const InputVariable& variable : analysis.problem().variables()) {
+      if (OptionalMeasureGroup measureGroup = variable.optionalCast<MeasureGroup>()) {
+        for (const Measure& measure : measureGroup->measures(false)) {
+          if (OptionalRubyMeasure rubyMeasure = measure.optionalCast<RubyMeasure>()) {
+            addMeasure(*rubyMeasure);
+          }
+        }
+      }
+      else if (OptionalRubyContinuousVariable rubyVariable = variable.optionalCast<RubyContinuousVariable>()) {
+        addMeasure(rubyVariable->measure());
+      }
+    }
+
+    std::string result = DataPointResultCache::inputsKey(seedPath,weatherFile,energyPlusVersion,measures);
+    m_resultCacheInputsKeys[analysis.uuid()] = result;
+    return result;
+  }
+
+  bool AnalysisDriver_Impl::completeFromResultCache(const CurrentAnalysis& currentAnalysis,
+                                                    const runmanager::Workflow& workflow,
+                                                    analysis::DataPoint& dataPoint)
+  {
+    AnalysisRunOptions runOptions = currentAnalysis.runOptions();
+    OS_ASSERT(runOptions.resultCache());
+    DataPointResultCache resultCache = *runOptions.resultCache();
+
+    Analysis analysis = currentAnalysis.analysis();
+    std::string key = DataPointResultCache::key(workflow,resultCacheInputsKey(analysis,runOptions));
+    if (resultCache.contains(key)) {
+      openstudio::path runDir = prepareRunDirectory(dataPoint,runOptions);
+      if (boost::optional<runmanager::Files> resultFiles = resultCache.restore(key,runDir)) {
+        LOG(Info,"Completing '" << toString(runDir.filename()) << "' from result cache entry '"
+            << key << "'.");
+        analysis.problem().updateDataPoint(dataPoint,*resultFiles);
+        return true;
+      }
+    }
+
+    m_resultCacheKeys[dataPoint.uuid()] = key;
+    return false;
+  }
+
+  void AnalysisDriver_Impl::storeInResultCache(const CurrentAnalysis& currentAnalysis,
+                                               const analysis::DataPoint& dataPoint)
+  {
+    auto it = m_resultCacheKeys.find(dataPoint.uuid());
+    if (it == m_resultCacheKeys.end()) {
+      return;
+    }
+    std::string key = it->second;
+    m_resultCacheKeys.erase(it);
+
+    boost::optional<DataPointResultCache> resultCache = currentAnalysis.runOptions().resultCache();
+    if (!resultCache || dataPoint.failed() || !dataPoint.sqlOutputData()) {
+      return;
+    }
+
+    std::vector<FileReference> fileReferences;
+    if (OptionalFileReference osmInputData = dataPoint.osmInputData()) {
+      fileReferences.push_back(*osmInputData);
+    }
+    if (OptionalFileReference idfInputData = dataPoint.idfInputData()) {
+      fileReferences.push_back(*idfInputData);
+    }
+    fileReferences.push_back(*dataPoint.sqlOutputData());
+    for (const FileReference& xmlOutputData : dataPoint.xmlOutputData()) {
+      fileReferences.push_back(xmlOutputData);
+    }
+
+    // input files may have been cleaned out, depending on JobCleanUpBehavior
+    std::vector<openstudio::path> resultFiles;
+    for (const FileReference& fileReference : fileReferences) {
+      if (boost::filesystem::exists(fileReference.path())) {
+        resultFiles.push_back(fileReference.path());
+      }
+    }
+
+    if (resultCache->store(key,resultFiles,dataPoint.directory())) {
+      LOG(Debug,"Stored results of '" << toString(dataPoint.directory().filename())
+          << "' in result cache entry '" << key << "'.");
+    }
+  }
+
   void AnalysisDriver_Impl::startDakotaJob(CurrentAnalysis& currentAnalysis) {
     // Runmanager settings
     runmanager::ConfigOptions rmConfig = database().runManager().getConfigOptions();
@@ -29,6 +29,7 @@
   #include <analysisdriver/AnalysisDriverEnums.hpp>
   #include <analysisdriver/AnalysisDriver.hpp>
   #include <analysisdriver/CurrentAnalysis.hpp>
+  #include <analysisdriver/DataPointResultCache.hpp>
   #include <analysisdriver/AnalysisRunOptions.hpp>
   #include <analysisdriver/AnalysisDriverWatcher.hpp>
   #include <analysisdriver/SimpleProject.hpp>
@@ -121,6 +122,9 @@
 
 %include <analysisdriver/AnalysisDriverEnums.hpp>
 
+%template(OptionalDataPointResultCache) boost::optional<openstudio::analysisdriver::DataPointResultCache>;
+
+ANALYSISDRIVER_WRAP(DataPointResultCache)
 ANALYSISDRIVER_WRAP(AnalysisRunOptions)
 ANALYSISDRIVER_WRAP(CurrentAnalysis)
 ANALYSISDRIVER_WRAP(AnalysisDriver)
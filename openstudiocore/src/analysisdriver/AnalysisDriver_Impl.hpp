@@ -38,6 +38,11 @@ namespace openstudio {
 namespace analysis {
   class Analysis;
   class DataPoint;
+  class Problem;
+}
+
+namespace runmanager {
+  class Workflow;
 }
 
 namespace analysisdriver {
@@ -155,6 +160,8 @@ namespace detail {
     AnalysisStatus m_status;
     project::ProjectDatabase m_database;
     std::vector<CurrentAnalysis> m_currentAnalyses;
+    std::map<openstudio::UUID, std::string> m_resultCacheKeys; // queued DataPoint to result cache key
+    std::map<openstudio::UUID, std::string> m_resultCacheInputsKeys; // running Analysis to DataPointResultCache::inputsKey
     
     void setStatus(AnalysisStatus status);
 
@@ -162,6 +169,29 @@ namespace detail {
 
     void queueJobs(std::vector<CurrentAnalysis>::iterator& currentAnalysis);
 
+    runmanager::Workflow createDataPointWorkflow(const analysis::Problem& problem,
+                                                 const analysis::DataPoint& dataPoint,
+                                                 const AnalysisRunOptions& runOptions) const;
+
+    /** Determines dataPoint's run directory, clears out any old data, and sets the directory on
+     *  dataPoint. */
+    openstudio::path prepareRunDirectory(analysis::DataPoint& dataPoint,
+                                         const AnalysisRunOptions& runOptions);
+
+    /** Returns DataPointResultCache::inputsKey for analysis, which hashes the seed, weather file
+     *  and measures. Computed the first time it is needed in each run. */
+    std::string resultCacheInputsKey(const analysis::Analysis& analysis,
+                                     const AnalysisRunOptions& runOptions);
+
+    /** Returns true if dataPoint was completed from the result cache. On a miss, remembers the
+     *  key so that the simulation results can be stored once dataPoint completes. */
+    bool completeFromResultCache(const CurrentAnalysis& currentAnalysis,
+                                 const runmanager::Workflow& workflow,
+                                 analysis::DataPoint& dataPoint);
+
+    void storeInResultCache(const CurrentAnalysis& currentAnalysis,
+                            const analysis::DataPoint& dataPoint);
+
     void startDakotaJob(CurrentAnalysis& currentAnalysis);
 
     void queueDakotaJob(CurrentAnalysis& currentAnalysis,
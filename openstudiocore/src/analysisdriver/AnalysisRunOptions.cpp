@@ -79,6 +79,10 @@ bool AnalysisRunOptions::dakotaFileSave() const {
   return m_dakotaFileSave;
 }
 
+boost::optional<DataPointResultCache> AnalysisRunOptions::resultCache() const {
+  return m_resultCache;
+}
+
 void AnalysisRunOptions::setRubyIncludeDirectory(const openstudio::path& includeDir) {
   m_rubyIncludeDirectory = includeDir;
 }
@@ -137,6 +141,14 @@ void AnalysisRunOptions::setDakotaFileSave(bool value) {
   m_dakotaFileSave = value;
 }
 
+void AnalysisRunOptions::setResultCache(const DataPointResultCache& resultCache) {
+  m_resultCache = resultCache;
+}
+
+void AnalysisRunOptions::clearResultCache() {
+  m_resultCache.reset();
+}
+
 } // analysisdriver
 } // openstudio
 
@@ -21,6 +21,7 @@
 #define ANALYSISDRIVER_ANALYSISRUNOPTIONS_HPP
 
 #include "AnalysisDriverAPI.hpp"
+#include "DataPointResultCache.hpp"
 
 #include "../runmanager/lib/ToolInfo.hpp"
 
@@ -124,6 +125,11 @@ class ANALYSISDRIVER_API AnalysisRunOptions {
    *  be saved. Defaults to true. */
   bool dakotaFileSave() const;
 
+  /** If set, DataPoints whose simulation inputs match a cache entry are completed from the
+   *  cache rather than simulated, and successful simulations are added to the cache. Only
+   *  applies to DataPoints queued directly by AnalysisDriver (not those created by DAKOTA). */
+  boost::optional<DataPointResultCache> resultCache() const;
+
   //@}
   /** @name Setters */
   //@{
@@ -156,6 +162,10 @@ class ANALYSISDRIVER_API AnalysisRunOptions {
 
   void setDakotaFileSave(bool value);
 
+  void setResultCache(const DataPointResultCache& resultCache);
+
+  void clearResultCache();
+
   //@}
  private:
   REGISTER_LOGGER("openstudio.analysisdriver.AnalysisRunOptions");
@@ -172,6 +182,7 @@ class ANALYSISDRIVER_API AnalysisRunOptions {
 
   openstudio::path m_dakotaExePath;
   bool m_dakotaFileSave;
+  boost::optional<DataPointResultCache> m_resultCache;
 };
 
 } // analysisdriver
@@ -218,6 +218,18 @@ namespace detail {
     return result;
   }
 
+  void CurrentAnalysis_Impl::addCompletedOSDataPoints(const std::vector<analysis::DataPoint>& dataPoints) {
+    for (const analysis::DataPoint& dataPoint : dataPoints) {
+      ++m_numOSJobsComplete;
+      if (dataPoint.failed()) {
+        ++m_numOSJobsFailed;
+      }
+    }
+    OS_ASSERT(m_numOSJobsComplete <= m_numOSJobsInIteration);
+
+    emit iterationProgress(numCompletedJobsInOSIteration(),totalNumJobsInOSIteration());
+  }
+
   analysis::DataPoint CurrentAnalysis_Impl::removeCompletedDakotaDataPoint(const openstudio::UUID& completedJob) {
     auto it = std::find_if(m_queuedDakotaDataPoints.begin(),
                            m_queuedDakotaDataPoints.end(),
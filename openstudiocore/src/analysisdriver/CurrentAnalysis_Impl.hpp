@@ -141,6 +141,10 @@ namespace detail {
      *  from the list of jobs to watch. */
     analysis::DataPoint removeCompletedOSDataPoint(const openstudio::UUID& completedJob);
 
+    /** Counts dataPoints, which were completed without being queued (for instance, from the
+     *  result cache), towards the current OpenStudio iteration. */
+    void addCompletedOSDataPoints(const std::vector<analysis::DataPoint>& dataPoints);
+
     /** Returns the Dakota DataPoint that corresponds to completedJob, and erases it
      *  from the list of jobs to watch. */
     analysis::DataPoint removeCompletedDakotaDataPoint(const openstudio::UUID& completedJob);
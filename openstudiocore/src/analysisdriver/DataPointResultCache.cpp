@@ -0,0 +1,277 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include "DataPointResultCache.hpp"
+
+#include "../runmanager/lib/Workflow.hpp"
+
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/PathHelpers.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <sstream>
+
+namespace openstudio {
+namespace analysisdriver {
+
+DataPointResultCache::DataPointResultCache(const openstudio::path& cacheDirectory, unsigned maxEntries)
+  : m_cacheDirectory(cacheDirectory),
+    m_maxEntries(maxEntries)
+{}
+
+openstudio::path DataPointResultCache::cacheDirectory() const {
+  return m_cacheDirectory;
+}
+
+unsigned DataPointResultCache::maxEntries() const {
+  return m_maxEntries;
+}
+
+unsigned DataPointResultCache::numEntries() const {
+  return entryKeys().size();
+}
+
+bool DataPointResultCache::contains(const std::string& key) const {
+  return boost::filesystem::exists(manifestPath(key));
+}
+
+void DataPointResultCache::setMaxEntries(unsigned maxEntries) {
+  m_maxEntries = maxEntries;
+  evict();
+}
+
+std::string DataPointResultCache::measureChecksum(const openstudio::path& measure)
+{
+  if (boost::filesystem::is_regular_file(measure)) {
+    return checksum(measure);
+  }
+  if (!boost::filesystem::is_directory(measure)) {
+    return "00000000";
+  }
+
+  // sort so the result does not depend on directory iteration order
+  std::vector<openstudio::path> files;
+  for (boost::filesystem::recursive_directory_iterator it(measure), itEnd; it != itEnd; ++it) {
+    if (boost::filesystem::is_regular_file(it->status())) {
+      files.push_back(relativePath(it->path(),measure));
+    }
+  }
+  std::sort(files.begin(),files.end());
+
+  std::stringstream ss;
+  for (const openstudio::path& file : files) {
+    ss << toString(file) << checksum(measure / file);
+  }
+  return checksum(ss.str());
+}
+
+std::string DataPointResultCache::inputsKey(const openstudio::path& seedFile,
+                                            const openstudio::path& weatherFile,
+                                            const std::string& energyPlusVersion,
+                                            const std::vector<openstudio::path>& measures)
+{
+  std::stringstream ss;
+  ss << checksum(seedFile);
+  if (boost::filesystem::exists(weatherFile) && boost::filesystem::is_regular_file(weatherFile)) {
+    ss << checksum(weatherFile);
+  }
+  else {
+    ss << "00000000";
+  }
+  ss << checksum(energyPlusVersion);
+
+  std::stringstream measuress;
+  for (const openstudio::path& measure : measures) {
+    measuress << measureChecksum(measure);
+  }
+  ss << checksum(measuress.str());
+  return ss.str();
+}
+
+std::string DataPointResultCache::key(const runmanager::Workflow& workflow, const std::string& inputsKey)
+{
+  return workflow.key() + "_" + inputsKey;
+}
+
+bool DataPointResultCache::store(const std::string& key,
+                                 const std::vector<openstudio::path>& resultFiles,
+                                 const openstudio::path& baseDirectory)
+{
+  openstudio::path entryDir = entryDirectory(key);
+  try {
+    if (boost::filesystem::exists(entryDir)) {
+      boost::filesystem::remove_all(entryDir);
+    }
+    boost::filesystem::create_directories(entryDir);
+
+    std::vector<openstudio::path> relativePaths;
+    for (const openstudio::path& file : resultFiles) {
+      openstudio::path relPath = relativePath(file,baseDirectory);
+      if (relPath.empty()) {
+        std::stringstream ss;
+        ss << relativePaths.size() << "_" << toString(file.filename());
+        relPath = toPath("external") / toPath(ss.str());
+      }
+      openstudio::path dest = entryDir / relPath;
+      boost::filesystem::create_directories(dest.parent_path());
+      boost::filesystem::copy_file(file,dest);
+      relativePaths.push_back(relPath);
+    }
+
+    // write the manifest last, and atomically, so that readers only ever see complete entries
+    openstudio::path tempManifest = entryDir / toPath("manifest.txt.tmp");
+    {
+      boost::filesystem::ofstream manifest(tempManifest);
+      for (const openstudio::path& relPath : relativePaths) {
+        manifest << toString(relPath) << std::endl;
+      }
+    }
+    boost::filesystem::rename(tempManifest,manifestPath(key));
+  }
+  catch (std::exception& e) {
+    LOG(Warn,"Unable to store results in cache entry '" << key << "', because " << e.what() << ".");
+    remove(key);
+    return false;
+  }
+
+  evict();
+  return true;
+}
+
+boost::optional<runmanager::Files> DataPointResultCache::restore(const std::string& key,
+                                                                 const openstudio::path& directory)
+{
+  openstudio::path manifestFile = manifestPath(key);
+  if (!boost::filesystem::exists(manifestFile)) {
+    return boost::none;
+  }
+
+  runmanager::Files result;
+  try {
+    std::vector<openstudio::path> relativePaths;
+    {
+      boost::filesystem::ifstream manifest(manifestFile);
+      std::string line;
+      while (std::getline(manifest,line)) {
+        if (!line.empty()) {
+          relativePaths.push_back(toPath(line));
+        }
+      }
+    }
+
+    openstudio::path entryDir = entryDirectory(key);
+    for (const openstudio::path& relPath : relativePaths) {
+      openstudio::path src = entryDir / relPath;
+      openstudio::path dest = directory / relPath;
+      boost::filesystem::create_directories(dest.parent_path());
+      if (boost::filesystem::exists(dest)) {
+        boost::filesystem::remove(dest);
+      }
+      boost::filesystem::copy_file(src,dest);
+      std::string ext = toString(dest.extension());
+      if (!ext.empty() && (ext[0] == '.')) {
+        ext = ext.substr(1);
+      }
+      result.append(runmanager::FileInfo(dest,ext));
+    }
+
+    // mark as most recently used
+    boost::filesystem::last_write_time(manifestFile,std::time(nullptr));
+  }
+  catch (std::exception& e) {
+    LOG(Warn,"Unable to restore results from cache entry '" << key << "', because " << e.what()
+        << ". Removing the entry.");
+    remove(key);
+    return boost::none;
+  }
+
+  return result;
+}
+
+bool DataPointResultCache::remove(const std::string& key) {
+  openstudio::path entryDir = entryDirectory(key);
+  try {
+    if (boost::filesystem::exists(entryDir)) {
+      boost::filesystem::remove_all(entryDir);
+      return true;
+    }
+  }
+  catch (std::exception& e) {
+    LOG(Warn,"Unable to remove cache entry '" << key << "', because " << e.what() << ".");
+  }
+  return false;
+}
+
+void DataPointResultCache::clear() {
+  for (const std::string& key : entryKeys()) {
+    remove(key);
+  }
+}
+
+openstudio::path DataPointResultCache::entryDirectory(const std::string& key) const {
+  return m_cacheDirectory / toPath(key);
+}
+
+openstudio::path DataPointResultCache::manifestPath(const std::string& key) const {
+  return entryDirectory(key) / toPath("manifest.txt");
+}
+
+std::vector<std::string> DataPointResultCache::entryKeys() const {
+  std::vector<std::string> result;
+  if (!boost::filesystem::is_directory(m_cacheDirectory)) {
+    return result;
+  }
+  for (boost::filesystem::directory_iterator it(m_cacheDirectory), itEnd; it != itEnd; ++it) {
+    if (boost::filesystem::is_directory(it->status())) {
+      std::string key = toString(it->path().filename());
+      if (boost::filesystem::exists(manifestPath(key))) {
+        result.push_back(key);
+      }
+    }
+  }
+  return result;
+}
+
+void DataPointResultCache::evict() {
+  std::vector<std::string> keys = entryKeys();
+  if (keys.size() <= m_maxEntries) {
+    return;
+  }
+
+  std::vector<std::pair<std::time_t,std::string> > lastUsed;
+  for (const std::string& key : keys) {
+    try {
+      lastUsed.push_back(std::make_pair(boost::filesystem::last_write_time(manifestPath(key)),key));
+    }
+    catch (...) {}
+  }
+  std::sort(lastUsed.begin(),lastUsed.end());
+
+  unsigned numToRemove = keys.size() - m_maxEntries;
+  for (unsigned i = 0; (i < numToRemove) && (i < lastUsed.size()); ++i) {
+    LOG(Debug,"Evicting cache entry '" << lastUsed[i].second << "'.");
+    remove(lastUsed[i].second);
+  }
+}
+
+} // analysisdriver
+} // openstudio
@@ -0,0 +1,138 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef ANALYSISDRIVER_DATAPOINTRESULTCACHE_HPP
+#define ANALYSISDRIVER_DATAPOINTRESULTCACHE_HPP
+
+#include "AnalysisDriverAPI.hpp"
+
+#include "../runmanager/lib/FileInfo.hpp"
+
+#include "../utilities/core/Path.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace runmanager {
+  class Workflow;
+}
+namespace analysisdriver {
+
+/** DataPointResultCache is a content-addressed store of the result files of successfully
+ *  simulated analysis::DataPoints. Entries are keyed by a hash of everything that went into the
+ *  simulation (see key()), and live in their own sub-folders of cacheDirectory(), so one cache
+ *  directory may be shared by several projects. Once more than maxEntries() entries are stored,
+ *  the least recently used entries are evicted.
+ *
+ *  AnalysisDriver consults the cache when an AnalysisRunOptions::resultCache() is set. On a hit
+ *  the stored files are copied into the DataPoint's run directory and attached to the DataPoint
+ *  instead of simulating it. */
+class ANALYSISDRIVER_API DataPointResultCache {
+ public:
+  /** @name Constructors and Destructors */
+  //@{
+
+  DataPointResultCache(const openstudio::path& cacheDirectory, unsigned maxEntries = 1000u);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  openstudio::path cacheDirectory() const;
+
+  /** Defaults to 1000. */
+  unsigned maxEntries() const;
+
+  /** Returns the number of complete entries currently on disk. */
+  unsigned numEntries() const;
+
+  /** Returns true if there is a complete entry for key. */
+  bool contains(const std::string& key) const;
+
+  //@}
+  /** @name Setters */
+  //@{
+
+  /** Sets maxEntries and immediately evicts any excess entries. */
+  void setMaxEntries(unsigned maxEntries);
+
+  //@}
+  /** @name Actions */
+  //@{
+
+  /** Returns a checksum of the contents of a measure. If measure is a directory, every file in
+   *  it (measure.xml, the measure script and its resources) contributes, along with its path
+   *  relative to the directory. If measure is a single script, returns that file's checksum. */
+  static std::string measureChecksum(const openstudio::path& measure);
+
+  /** Returns the part of the cache key shared by all the simulations of an analysis: the
+   *  contents of seedFile, weatherFile (if it exists) and each of measures (see
+   *  measureChecksum), and energyPlusVersion. This reads all of those files, so AnalysisDriver
+   *  computes it once per run. */
+  static std::string inputsKey(const openstudio::path& seedFile,
+                               const openstudio::path& weatherFile,
+                               const std::string& energyPlusVersion,
+                               const std::vector<openstudio::path>& measures);
+
+  /** Returns the cache key for a simulation. workflow.key() covers the job types, tools, files
+   *  and parameters (including measure arguments) of the workflow, which identifies files by
+   *  path only; inputsKey covers their contents. */
+  static std::string key(const runmanager::Workflow& workflow, const std::string& inputsKey);
+
+  /** Copies resultFiles into a new entry for key, replacing any existing entry. Paths are stored
+   *  relative to baseDirectory, so that restore() can recreate the same layout. The order of
+   *  resultFiles is preserved. Evicts least recently used entries beyond maxEntries(). */
+  bool store(const std::string& key,
+             const std::vector<openstudio::path>& resultFiles,
+             const openstudio::path& baseDirectory);
+
+  /** Copies the files stored for key into directory, marks the entry as recently used, and
+   *  returns the copied files in the order they were stored. Returns boost::none on a miss. */
+  boost::optional<runmanager::Files> restore(const std::string& key,
+                                             const openstudio::path& directory);
+
+  bool remove(const std::string& key);
+
+  /** Removes all entries. */
+  void clear();
+
+  //@}
+ private:
+  REGISTER_LOGGER("openstudio.analysisdriver.DataPointResultCache");
+
+  openstudio::path m_cacheDirectory;
+  unsigned m_maxEntries;
+
+  openstudio::path entryDirectory(const std::string& key) const;
+
+  openstudio::path manifestPath(const std::string& key) const;
+
+  std::vector<std::string> entryKeys() const;
+
+  void evict();
+};
+
+} // analysisdriver
+} // openstudio
+
+#endif // ANALYSISDRIVER_DATAPOINTRESULTCACHE_HPP
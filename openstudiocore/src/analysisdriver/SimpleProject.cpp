@@ -93,6 +93,13 @@ namespace analysisdriver {
 
 namespace detail {
 
+  namespace {
+
+    // DataPointRecords loaded per query when an unloaded analysis is cleaned up
+    const unsigned dataPointPageSize = 100;
+
+  }
+
   SimpleProject_Impl::SimpleProject_Impl(const openstudio::path& projectDir,
                                          const analysisdriver::AnalysisDriver& analysisDriver,
                                          const boost::optional<analysis::Analysis>& analysis,
@@ -984,26 +991,32 @@ namespace detail {
       database.unloadUnusedCleanRecords();
       bool didStartTransaction = database.startTransaction();
       AnalysisRecord analysisRecord = this->analysisRecord();
-      DataPointRecordVector dataPointRecords = analysisRecord.dataPointRecords();
-      for (DataPointRecord& dataPointRecord : dataPointRecords) {
-        boost::optional<UUID> jobUUID = dataPointRecord.topLevelJobUUID();
-        if (jobUUID) {
-          try {
-            runmanager::Job job = database.runManager().getJob(*jobUUID);
-            database.runManager().remove(job);
-          }
-          catch (...) {}
-        }
-        openstudio::path dpDir = dataPointRecord.directory();
-        if (!dpDir.empty() && boost::filesystem::exists(dpDir)) {
-          try {
-            boost::filesystem::remove_all(dpDir);
+      // load the records a page at a time, rather than all at once or one query per point
+      unsigned offset = 0;
+      DataPointRecordVector dataPointRecords = analysisRecord.dataPointRecords(offset,dataPointPageSize);
+      while (!dataPointRecords.empty()) {
+        for (DataPointRecord& dataPointRecord : dataPointRecords) {
+          boost::optional<UUID> jobUUID = dataPointRecord.topLevelJobUUID();
+          if (jobUUID) {
+            try {
+              runmanager::Job job = database.runManager().getJob(*jobUUID);
+              database.runManager().remove(job);
+            }
+            catch (...) {}
           }
-          catch (...) {
-            result = false;
+          openstudio::path dpDir = dataPointRecord.directory();
+          if (!dpDir.empty() && boost::filesystem::exists(dpDir)) {
+            try {
+              boost::filesystem::remove_all(dpDir);
+            }
+            catch (...) {
+              result = false;
+            }
           }
+          dataPointRecord.clearResults();
         }
-        dataPointRecord.clearResults();
+        offset += dataPointRecords.size();
+        dataPointRecords = analysisRecord.dataPointRecords(offset,dataPointPageSize);
       }
       if (OptionalAlgorithmRecord algorithmRecord = analysisRecord.algorithmRecord()) {
         if (OptionalDakotaAlgorithmRecord dakotaAlgorithmRecord = algorithmRecord->optionalCast<DakotaAlgorithmRecord>()) {
@@ -1051,26 +1064,35 @@ namespace detail {
       database.unloadUnusedCleanRecords();
       bool didStartTransaction = database.startTransaction();
       AnalysisRecord analysisRecord = this->analysisRecord();
-      DataPointRecordVector dataPointRecords = analysisRecord.dataPointRecords();
-      for (DataPointRecord& dataPointRecord : dataPointRecords) {
-        boost::optional<UUID> jobUUID = dataPointRecord.topLevelJobUUID();
-        if (jobUUID) {
-          try {
-            runmanager::Job job = database.runManager().getJob(*jobUUID);
-            database.runManager().remove(job);
+      // load the records a page at a time, rather than all at once or one query per point.
+      // removeRecord deletes the row, so the next page starts where this one did.
+      unsigned offset = 0;
+      DataPointRecordVector dataPointRecords = analysisRecord.dataPointRecords(offset,dataPointPageSize);
+      while (!dataPointRecords.empty()) {
+        for (DataPointRecord& dataPointRecord : dataPointRecords) {
+          boost::optional<UUID> jobUUID = dataPointRecord.topLevelJobUUID();
+          if (jobUUID) {
+            try {
+              runmanager::Job job = database.runManager().getJob(*jobUUID);
+              database.runManager().remove(job);
+            }
+            catch (...) {}
           }
-          catch (...) {}
-        }
-        openstudio::path dpDir = dataPointRecord.directory();
-        if (!dpDir.empty() && boost::filesystem::exists(dpDir)) {
-          try {
-            boost::filesystem::remove_all(dpDir);
+          openstudio::path dpDir = dataPointRecord.directory();
+          if (!dpDir.empty() && boost::filesystem::exists(dpDir)) {
+            try {
+              boost::filesystem::remove_all(dpDir);
+            }
+            catch (...) {
+              result = false;
+            }
           }
-          catch (...) {
-            result = false;
+          if (!database.removeRecord(dataPointRecord)) {
+            // row is still there, skip it
+            ++offset;
           }
         }
-        database.removeRecord(dataPointRecord);
+        dataPointRecords = analysisRecord.dataPointRecords(offset,dataPointPageSize);
       }
       if (OptionalAlgorithmRecord algorithmRecord = analysisRecord.algorithmRecord()) {
         if (OptionalDakotaAlgorithmRecord dakotaAlgorithmRecord = algorithmRecord->optionalCast<DakotaAlgorithmRecord>()) {
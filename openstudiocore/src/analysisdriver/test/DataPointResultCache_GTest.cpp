@@ -0,0 +1,229 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+#include "AnalysisDriverFixture.hpp"
+
+#include "../DataPointResultCache.hpp"
+#include "../AnalysisDriver.hpp"
+#include "../AnalysisRunOptions.hpp"
+#include "../CurrentAnalysis.hpp"
+
+#include "../../project/ProjectDatabase.hpp"
+
+#include "../../analysis/Analysis.hpp"
+#include "../../analysis/DataPoint.hpp"
+#include "../../analysis/MeasureGroup.hpp"
+#include "../../analysis/Problem.hpp"
+#include "../../analysis/RubyMeasure.hpp"
+
+#include "../../runmanager/lib/Workflow.hpp"
+#include "../../runmanager/lib/JobParam.hpp"
+#include "../../runmanager/lib/RunManager.hpp"
+
+#include "../../model/Model.hpp"
+
+#include "../../utilities/bcl/BCLMeasure.hpp"
+#include "../../utilities/core/FileReference.hpp"
+
+#include <resources.hxx>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <ctime>
+
+using namespace openstudio;
+using namespace openstudio::analysis;
+using namespace openstudio::analysisdriver;
+
+namespace {
+
+  openstudio::path writeFile(const openstudio::path& p, const std::string& contents) {
+    boost::filesystem::create_directories(p.parent_path());
+    boost::filesystem::ofstream file(p);
+    file << contents;
+    return p;
+  }
+
+  std::string readFile(const openstudio::path& p) {
+    boost::filesystem::ifstream file(p);
+    std::string result;
+    std::getline(file,result);
+    return result;
+  }
+
+}
+
+TEST_F(AnalysisDriverFixture,DataPointResultCache_Key) {
+  openstudio::path dir = toPath("AnalysisDriverFixtureData") / toPath("DataPointResultCache_Key");
+  boost::filesystem::remove_all(dir);
+  openstudio::path seed = writeFile(dir / toPath("seed.osm"),"seed");
+  openstudio::path otherSeed = writeFile(dir / toPath("otherSeed.osm"),"other seed");
+  openstudio::path weather = writeFile(dir / toPath("weather.epw"),"weather");
+
+  runmanager::Workflow workflow;
+  workflow.addJob(runmanager::JobType::ModelToIdf);
+  workflow.addJob(runmanager::JobType::EnergyPlus);
+
+  openstudio::path measure = writeFile(dir / toPath("measure") / toPath("measure.rb"),"measure").parent_path();
+  writeFile(measure / toPath("measure.xml"),"xml");
+  std::vector<openstudio::path> measures(1u,measure);
+
+  std::string inputsKey = DataPointResultCache::inputsKey(seed,weather,"8.2.0",measures);
+  std::string key = DataPointResultCache::key(workflow,inputsKey);
+  EXPECT_EQ(key,DataPointResultCache::key(workflow,DataPointResultCache::inputsKey(seed,weather,"8.2.0",measures)));
+
+  // every input contributes
+  EXPECT_NE(inputsKey,DataPointResultCache::inputsKey(otherSeed,weather,"8.2.0",measures));
+  EXPECT_NE(inputsKey,DataPointResultCache::inputsKey(seed,openstudio::path(),"8.2.0",measures));
+  EXPECT_NE(inputsKey,DataPointResultCache::inputsKey(seed,weather,"8.3.0",measures));
+  EXPECT_NE(inputsKey,DataPointResultCache::inputsKey(seed,weather,"8.2.0",std::vector<openstudio::path>()));
+
+  runmanager::Workflow otherWorkflow = workflow;
+  runmanager::JobParams params;
+  params.append("cleanoutfiles","maximum");
+  otherWorkflow.add(params);
+  EXPECT_NE(key,DataPointResultCache::key(otherWorkflow,inputsKey));
+
+  // keys address files, not paths
+  openstudio::path seedCopy = writeFile(dir / toPath("copy") / toPath("seed.osm"),"seed");
+  EXPECT_EQ(inputsKey,DataPointResultCache::inputsKey(seedCopy,weather,"8.2.0",measures));
+
+  // measures are addressed by the contents of all their files
+  std::string measureChecksum = DataPointResultCache::measureChecksum(measure);
+  writeFile(measure / toPath("resources") / toPath("helper.rb"),"helper");
+  EXPECT_NE(measureChecksum,DataPointResultCache::measureChecksum(measure));
+  measureChecksum = DataPointResultCache::measureChecksum(measure);
+  writeFile(measure / toPath("measure.rb"),"edited measure");
+  EXPECT_NE(measureChecksum,DataPointResultCache::measureChecksum(measure));
+  EXPECT_NE(inputsKey,DataPointResultCache::inputsKey(seed,weather,"8.2.0",measures));
+}
+
+TEST_F(AnalysisDriverFixture,DataPointResultCache_StoreRestoreEvict) {
+  openstudio::path dir = toPath("AnalysisDriverFixtureData") / toPath("DataPointResultCache_StoreRestoreEvict");
+  boost::filesystem::remove_all(dir);
+
+  openstudio::path runDir = dir / toPath("dataPoint1");
+  std::vector<openstudio::path> resultFiles;
+  resultFiles.push_back(writeFile(runDir / toPath("ModelToIdf/in.osm"),"osm"));
+  resultFiles.push_back(writeFile(runDir / toPath("EnergyPlus/eplusout.sql"),"sql"));
+  resultFiles.push_back(writeFile(runDir / toPath("UserScript-0/result.ossr"),"measure 0"));
+  resultFiles.push_back(writeFile(runDir / toPath("UserScript-1/result.ossr"),"measure 1"));
+
+  DataPointResultCache cache(dir / toPath("cache"),2u);
+  EXPECT_EQ(2u,cache.maxEntries());
+  EXPECT_EQ(0u,cache.numEntries());
+  EXPECT_FALSE(cache.contains("a"));
+  EXPECT_FALSE(cache.restore("a",dir / toPath("dataPoint2")));
+
+  EXPECT_TRUE(cache.store("a",resultFiles,runDir));
+  EXPECT_TRUE(cache.contains("a"));
+  EXPECT_EQ(1u,cache.numEntries());
+
+  // restore recreates the layout and order of the stored files
+  openstudio::path restoreDir = dir / toPath("dataPoint2");
+  boost::optional<runmanager::Files> restored = cache.restore("a",restoreDir);
+  ASSERT_TRUE(restored);
+  ASSERT_EQ(4u,restored->files().size());
+  EXPECT_EQ(restoreDir / toPath("ModelToIdf/in.osm"),restored->files()[0].fullPath);
+  EXPECT_EQ(restoreDir / toPath("UserScript-1/result.ossr"),restored->files()[3].fullPath);
+  EXPECT_EQ("sql",readFile(restored->getLastByExtension("sql").fullPath));
+  EXPECT_EQ("measure 1",readFile(restored->getAllByExtension("ossr").files()[1].fullPath));
+
+  // least recently used entry is evicted first
+  EXPECT_TRUE(cache.store("b",resultFiles,runDir));
+  boost::filesystem::last_write_time(dir / toPath("cache/b/manifest.txt"),std::time(nullptr) - 100);
+  EXPECT_TRUE(cache.restore("a",restoreDir));
+  EXPECT_EQ(2u,cache.numEntries());
+  EXPECT_TRUE(cache.store("c",resultFiles,runDir));
+  EXPECT_EQ(2u,cache.numEntries());
+  EXPECT_TRUE(cache.contains("a"));
+  EXPECT_FALSE(cache.contains("b"));
+  EXPECT_TRUE(cache.contains("c"));
+
+  cache.setMaxEntries(1u);
+  EXPECT_EQ(1u,cache.numEntries());
+
+  cache.clear();
+  EXPECT_EQ(0u,cache.numEntries());
+  EXPECT_FALSE(cache.contains("c"));
+}
+
+TEST_F(AnalysisDriverFixture,DataPointResultCache_AnalysisDriver) {
+  openstudio::path dir = toPath("AnalysisDriverFixtureData") / toPath("DataPointResultCache_AnalysisDriver");
+  boost::filesystem::remove_all(dir);
+
+  // a private copy of the measure, so that it can be edited
+  openstudio::path originalDir = resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade");
+  openstudio::path measureDir = dir / toPath("SetWindowToWallRatioByFacade");
+  boost::filesystem::create_directories(measureDir);
+  boost::filesystem::copy_file(originalDir / toPath("measure.rb"),measureDir / toPath("measure.rb"));
+  boost::filesystem::copy_file(originalDir / toPath("measure.xml"),measureDir / toPath("measure.xml"));
+
+  openstudio::path seedPath = dir / toPath("seed.osm");
+  fastExampleModel().save(seedPath,true);
+
+  DataPointResultCache resultCache(dir / toPath("cache"));
+
+  // runs the baseline point of a one measure analysis in a clean database,
+  // returns the number of RunManager jobs the run created
+  auto runAnalysis = [&](const std::string& databaseName) -> unsigned {
+    BCLMeasure measure = BCLMeasure::load(measureDir).get();
+    Problem problem("Cached Problem");
+    problem.push(MeasureGroup("Window to Wall Ratio",MeasureVector(1u,RubyMeasure(measure))));
+    appendDefaultSimulationWorkflow(problem,true,true);
+    Analysis analysis("Cached Analysis",problem,FileReference(seedPath));
+    OptionalDataPoint dataPoint = problem.createDataPoint(std::vector<QVariant>(1u,QVariant(0)));
+    EXPECT_TRUE(dataPoint);
+    if (!dataPoint || !analysis.addDataPoint(*dataPoint)) {
+      return 0u;
+    }
+
+    project::ProjectDatabase database = getCleanDatabase(databaseName);
+    AnalysisDriver analysisDriver(database);
+    AnalysisRunOptions runOptions = standardRunOptions(database.path().parent_path());
+    runOptions.setResultCache(resultCache);
+    CurrentAnalysis currentAnalysis = analysisDriver.run(analysis,runOptions);
+    analysisDriver.waitForFinished();
+
+    DataPointVector dataPoints = currentAnalysis.analysis().dataPoints();
+    EXPECT_EQ(1u,dataPoints.size());
+    for (const DataPoint& point : dataPoints) {
+      EXPECT_TRUE(point.isComplete());
+      EXPECT_FALSE(point.failed());
+      EXPECT_TRUE(point.sqlOutputData());
+    }
+    return database.runManager().getJobs().size();
+  };
+
+  EXPECT_LT(0u,runAnalysis("DataPointResultCache_AnalysisDriver_First"));
+  EXPECT_EQ(1u,resultCache.numEntries());
+
+  // an identical run is served from the cache without simulating
+  EXPECT_EQ(0u,runAnalysis("DataPointResultCache_AnalysisDriver_Second"));
+  EXPECT_EQ(1u,resultCache.numEntries());
+
+  // editing the measure script is a miss, even though its path did not change
+  {
+    boost::filesystem::ofstream script(measureDir / toPath("measure.rb"),std::ios_base::app);
+    script << std::endl << "# edited" << std::endl;
+  }
+  EXPECT_LT(0u,runAnalysis("DataPointResultCache_AnalysisDriver_Third"));
+  EXPECT_EQ(2u,resultCache.numEntries());
+}
@@ -17,21 +17,184 @@
 *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 **********************************************************************/
 
+
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    enum LineKind {
+      OtherLine,
+      MessageLine,
+      ContinuationLine,
+      CompletedSuccessfullyLine,
+      TerminatedLine
+    };
+
+    bool isSpace(char c)
+    {
+      return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n') || (c == '\f') || (c == '\v');
+    }
+
+    std::string::size_type skipSpaces(const std::string& line, std::string::size_type i)
+    {
+      while ((i < line.size()) && isSpace(line[i])) { ++i; }
+      return i;
+    }
+
+    bool isDigit(char c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    bool isWordChar(char c)
+    {
+      return isDigit(c) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
+    }
+
+    bool startsWith(const std::string& line, std::string::size_type i, const char* text)
+    {
+      for (; *text; ++text, ++i){
+        if ((i >= line.size()) || (line[i] != *text)){
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Classifies one line of eplusout.err.  Message lines look like "   ** Warning ** text" and
+    // continuation lines like "   **   ~~~   ** text"; type and text are set for both.
+    LineKind classifyLine(const std::string& line, std::string& type, std::string& text)
+    {
+      std::string::size_type begin = skipSpaces(line, 0);
+      std::string::size_type i = begin;
+      while ((i < line.size()) && (line[i] == '*')) { ++i; }
+      std::string::size_type numStars = i - begin;
+
+      // the "**" opening the type is either preceded by optional stars and whitespace, or is
+      // the start of the leading run of stars itself (which then must follow some whitespace)
+      std::string::size_type open = std::string::npos;
+      std::string::size_type j = skipSpaces(line, i);
+      if ((j > i) && startsWith(line, j, "**")){
+        open = j + 2;
+      }else if ((begin > 0) && (numStars >= 2)){
+        open = begin + 2;
+      }
+
+      if (open != std::string::npos){
+        std::string::size_type typeBegin = skipSpaces(line, open);
+        std::string::size_type typeEnd = typeBegin;
+        while ((typeEnd < line.size()) && !isSpace(line[typeEnd]) && (line[typeEnd] != '*')) { ++typeEnd; }
+        std::string::size_type close = skipSpaces(line, typeEnd);
+        if ((typeEnd > typeBegin) && startsWith(line, close, "**")){
+          type = line.substr(typeBegin, typeEnd - typeBegin);
+          text = line.substr(close + 2);
+          if (type == "~~~"){
+            boost::trim_right(text);
+            return ContinuationLine;
+          }
+          boost::trim(text);
+          return MessageLine;
+        }
+      }
+
+      // "   ****** EnergyPlus Completed Successfully", "   ****** EnergyPlus Terminated"
+      if ((numStars > 0) && startsWith(line, i, " ")){
+        if (startsWith(line, i + 1, "EnergyPlus Completed Successfully")){
+          return CompletedSuccessfullyLine;
+        }
+        if (startsWith(line, i + 1, "EnergyPlus Terminated")){
+          return TerminatedLine;
+        }
+        if (startsWith(line, i + 1, "GroundTempCalc")){
+          j = i + 1 + std::string("GroundTempCalc").size();
+          while ((j < line.size()) && !isSpace(line[j])) { ++j; }
+          if (startsWith(line, j, " Completed Successfully")){
+            return CompletedSuccessfullyLine;
+          }
+        }
+      }
+
+      return OtherLine;
+    }
+
+  }
+
+  // number of bytes at the start of the file compared to detect a new run
+  const std::streamoff headSize = 256;
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+    : m_path(errPath), m_offset(0), m_numWarnings(0), m_completed(false), m_completedSuccessfully(false)
   {
-    boost::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+    update();
+  }
+
+  bool ErrorFile::update()
+  {
+    boost::filesystem::ifstream ifs(m_path, std::ios_base::in | std::ios_base::binary);
+    if (!ifs){
+      return false;
+    }
+
+    ifs.seekg(0, std::ios_base::end);
+    std::streamoff size = ifs.tellg();
+
+    // EnergyPlus writes nothing after the completion line, and each run starts the file with its
+    // own version and time stamp line
+    bool newRun = (size < m_offset) || (m_completed && (size > m_offset));
+    if (!newRun && !m_head.empty()){
+      std::string head(m_head.size(), '\0');
+      ifs.seekg(0);
+      ifs.read(&head[0], head.size());
+      newRun = (head != m_head);
+    }
+    if (newRun){
+      LOG(Debug, "'" << toString(m_path) << "' was replaced by a new run, reading again from the start");
+      clear();
+    }
+    if (m_completed || (size == m_offset)){
+      return false;
+    }
+
+    // the head read so far has just been checked, extend it while the file is short
+    if (static_cast<std::streamoff>(m_head.size()) < std::min(size, headSize)){
+      m_head.assign(static_cast<std::string::size_type>(std::min(size, headSize)), '\0');
+      ifs.seekg(0);
+      ifs.read(&m_head[0], m_head.size());
+    }
+    ifs.clear();
+    ifs.seekg(m_offset);
+
+    size_t numMessages = m_numWarnings + m_severeErrors.size() + m_fatalErrors.size();
+
+    // only complete lines are parsed, a trailing partial line waits for the next update
+    std::vector<char> buffer(1 << 16);
+    while (!m_completed && ifs.read(&buffer[0], buffer.size()).gcount() > 0){
+      std::streamsize n = ifs.gcount();
+      m_offset += n;
+
+      const char* begin = &buffer[0];
+      const char* end = begin + n;
+      const char* newline;
+      while (!m_completed && ((newline = std::find(begin, end, '\n')) != end)){
+        m_partialLine.append(begin, newline);
+        parseLine(m_partialLine);
+        m_partialLine.clear();
+        begin = newline + 1;
+      }
+      if (!m_completed){
+        m_partialLine.append(begin, end);
+      }
+    }
+
+    return m_completed || (numMessages != m_numWarnings + m_severeErrors.size() + m_fatalErrors.size());
   }
 
   /// get warnings
@@ -40,6 +203,20 @@ namespace energyplus {
     return m_warnings;
   }
 
+  unsigned ErrorFile::numWarnings() const
+  {
+    return m_numWarnings;
+  }
+
+  std::vector<std::pair<std::string, unsigned> > ErrorFile::warningCounts() const
+  {
+    std::vector<std::pair<std::string, unsigned> > result(m_warningTemplates.size());
+    for (const auto& warningTemplate : m_warningTemplates){
+      result[warningTemplate.second.first] = std::make_pair(warningTemplate.first, warningTemplate.second.second);
+    }
+    return result;
+  }
+
   /// get severe errors
   std::vector<std::string> ErrorFile::severeErrors() const
   {
@@ -65,94 +242,125 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(boost::filesystem::ifstream& is)
+  std::string ErrorFile::messageTemplate(const std::string& message)
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
-
-      boost::smatch matches;
+    std::string result;
+    std::string::size_type end = message.find('\n');
+    if (end == std::string::npos){
+      end = message.size();
+    }
 
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
+    for (std::string::size_type i = 0; i < end; ){
+      char c = message[i];
+      if (c == '"'){
+        std::string::size_type close = message.find('"', i + 1);
+        if ((close == std::string::npos) || (close >= end)){
+          result.append(message, i, end - i);
+          break;
+        }
+        result += "\"*\"";
+        i = close + 1;
+      }else if ((isDigit(c) || (((c == '-') || (c == '+')) && (i + 1 < end) && isDigit(message[i + 1])))
+                && ((i == 0) || !isWordChar(message[i - 1]))){
+        // numbers, but not digits inside names such as CalcDoe2DXCoil
+        ++i;
+        while ((i < end) && (isDigit(message[i]) || (message[i] == '.'))) { ++i; }
+        result += '#';
+      }else{
+        result += c;
+        ++i;
+      }
+    }
 
+    return result;
+  }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+  void ErrorFile::clear()
+  {
+    m_offset = 0;
+    m_head.clear();
+    m_partialLine.clear();
+    m_lastLevel.reset();
+    m_warnings.clear();
+    m_severeErrors.clear();
+    m_fatalErrors.clear();
+    m_numWarnings = 0;
+    m_warningTemplates.clear();
+    m_completed = false;
+    m_completedSuccessfully = false;
+  }
 
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
-            break;
+  void ErrorFile::parseLine(const std::string& line)
+  {
+    std::string type;
+    std::string text;
+
+    switch (classifyLine(line, type, text)){
+      case MessageLine:
+        {
+          m_lastLevel.reset();
+
+          // correctly sort warnings and errors
+          try{
+            ErrorLevel level(type);
+
+            switch(level.value()){
+              case ErrorLevel::Warning:
+                {
+                  ++m_numWarnings;
+                  auto inserted = m_warningTemplates.insert(std::make_pair(messageTemplate(text),
+                      std::make_pair(static_cast<unsigned>(m_warningTemplates.size()), 0u)));
+                  unsigned count = ++inserted.first->second.second;
+                  if (count > maxWarningsPerTemplate){
+                    // counted, but not kept, and neither are its continuation lines
+                    return;
+                  }
+                  m_warnings.push_back(text);
+                }
+                break;
+              case ErrorLevel::Severe:
+                m_severeErrors.push_back(text);
+                break;
+              case ErrorLevel::Fatal:
+                m_fatalErrors.push_back(text);
+                break;
+            }
+
+            m_lastLevel = level;
+
+          }catch(...){
+            LOG(Error, "Unknown warning or error level '" << type << "'");
           }
         }
-
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
-
-          switch(level.value()){
+        break;
+      case ContinuationLine:
+        // the rest of a multi line warning or error, continuation lines leave the template alone
+        if (m_lastLevel){
+          switch(m_lastLevel->value()){
             case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
+              m_warnings.back() += "\n" + text;
               break;
             case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
+              m_severeErrors.back() += "\n" + text;
               break;
             case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
+              m_fatalErrors.back() += "\n" + text;
               break;
           }
-
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
         }
-
-      }else if (boost::regex_match(line, completedSuccessful) 
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
+        break;
+      case CompletedSuccessfullyLine:
         m_completed = true;
         m_completedSuccessfully = true;
         break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
+      case TerminatedLine:
         m_completed = true;
         m_completedSuccessfully = false;
         break;
-      }
+      default:
+        m_lastLevel.reset();
+        break;
     }
-
   }
 
 } // energyplus
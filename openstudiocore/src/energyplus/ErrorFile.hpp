@@ -27,7 +27,11 @@
 #include "../utilities/core/Logger.hpp"
 
 #include <boost/filesystem/fstream.hpp>
+#include <boost/optional.hpp>
+#include <ios>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace openstudio {
@@ -43,12 +47,27 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
+    /// constructor, reads everything currently in the file
     ErrorFile(const openstudio::path& errPath);
 
-    /// get warnings
+    /** Reads any complete lines appended to the file since the last read, so that a file
+     *  EnergyPlus is still writing can be followed while the simulation runs.  If the file
+     *  belongs to a new run it is read again from the start; a new run is detected by the file
+     *  shrinking, its first bytes changing, or it growing after the run completed.  Returns true
+     *  if new warnings or errors were found or the run completed. */
+    bool update();
+
+    /** Get warnings.  Only the first maxWarningsPerTemplate warnings sharing a messageTemplate()
+     *  are kept in full, warningCounts() and numWarnings() count all of them. */
     std::vector<std::string> warnings() const;
 
+    /// number of warnings in the file, including those not kept by warnings()
+    unsigned numWarnings() const;
+
+    /** Get the distinct warning templates in order of first appearance, each with the number of
+     *  warnings that share it.  See messageTemplate(). */
+    std::vector<std::pair<std::string, unsigned> > warningCounts() const;
+
     /// get severe errors
     std::vector<std::string> severeErrors() const;
 
@@ -61,15 +80,33 @@ namespace energyplus {
     /// completed successfully
     bool completedSuccessfully() const;
 
+    /** Returns the first line of message with quoted text replaced by "*" and numbers replaced
+     *  by "#", so that repeats of a warning about different objects or values compare equal. */
+    static std::string messageTemplate(const std::string& message);
+
+    /// number of warnings sharing a template that are kept in full by warnings()
+    static const unsigned maxWarningsPerTemplate = 100;
+
    private:
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(boost::filesystem::ifstream& is);
+    void clear();
+
+    void parseLine(const std::string& line);
+
+    openstudio::path m_path;
+    std::streamoff m_offset;
+    std::string m_head; // first bytes of the file, which change when a new run replaces it
+    std::string m_partialLine;
+    boost::optional<ErrorLevel> m_lastLevel;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
+    unsigned m_numWarnings;
+    // warning template to its order of first appearance and count
+    std::map<std::string, std::pair<unsigned, unsigned> > m_warningTemplates;
     bool m_completed;
     bool m_completedSuccessfully;
 
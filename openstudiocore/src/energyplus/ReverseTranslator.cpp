@@ -24,6 +24,7 @@
 #include "../model/ModelObject.hpp"
 
 #include "../utilities/idf/IdfFile.hpp"
+#include "../utilities/idf/IdfObject_Impl.hpp"
 #include "../utilities/idf/WorkspaceObject.hpp"
 #include "../utilities/idf/ValidityReport.hpp"
 #include "../utilities/idd/IddEnums.hpp"
@@ -33,6 +34,8 @@
 #include "../utilities/plot/ProgressBar.hpp"
 
 #include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentMap>
 
 using namespace openstudio::model;
 
@@ -42,7 +45,55 @@ namespace openstudio {
 
 namespace energyplus {
 
+namespace {
+
+  /// number of objects each staging Model receives in ReverseTranslator::stageIndependentObjects
+  const unsigned stagingBatchSize = 256;
+
+  // Objects whose translators only read their own fields and create one model object, without
+  // logging, so translating them into another Model and adding the result to m_model is the same
+  // as translating them into m_model.
+  bool isStageableObjectType(const IddObjectType& type)
+  {
+    switch(type.value())
+    {
+    case openstudio::IddObjectType::Curve_Bicubic :
+    case openstudio::IddObjectType::Curve_Biquadratic :
+    case openstudio::IddObjectType::Curve_Cubic :
+    case openstudio::IddObjectType::Curve_DoubleExponentialDecay :
+    case openstudio::IddObjectType::Curve_ExponentialSkewNormal :
+    case openstudio::IddObjectType::Curve_FanPressureRise :
+    case openstudio::IddObjectType::Curve_Functional_PressureDrop :
+    case openstudio::IddObjectType::Curve_Linear :
+    case openstudio::IddObjectType::Curve_Quadratic :
+    case openstudio::IddObjectType::Curve_QuadraticLinear :
+    case openstudio::IddObjectType::Curve_Quartic :
+    case openstudio::IddObjectType::Curve_RectangularHyperbola1 :
+    case openstudio::IddObjectType::Curve_RectangularHyperbola2 :
+    case openstudio::IddObjectType::Curve_Sigmoid :
+    case openstudio::IddObjectType::Curve_Triquadratic :
+    case openstudio::IddObjectType::Material :
+    case openstudio::IddObjectType::Material_AirGap :
+    case openstudio::IddObjectType::Material_NoMass :
+    case openstudio::IddObjectType::WindowMaterial_Gas :
+    case openstudio::IddObjectType::WindowMaterial_Glazing :
+    case openstudio::IddObjectType::WindowMaterial_SimpleGlazingSystem :
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  /// leaf objects translated together into one staging Model, and the model objects they became
+  struct StagingBatch {
+    std::vector<WorkspaceObject> objects;
+    std::vector<boost::optional<IdfObject> > staged;
+  };
+
+}
+
 ReverseTranslator::ReverseTranslator()
+  : m_progressBar(nullptr)
 {
   m_logSink.setLogLevel(Warn);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
@@ -61,6 +112,8 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
 
   m_untranslatedIdfObjects.clear();
 
+  m_untranslatedHandles.clear();
+
   m_logSink.resetStringStream();
 
   m_logSink.setThreadId(QThread::currentThread());
@@ -128,6 +181,10 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   m_untranslatedIdfObjects.clear();
 
+  m_untranslatedHandles.clear();
+
+  m_stagedObjects.clear();
+
   m_logSink.resetStringStream();
 
   // if multiple runperiod objects in idf, remove them all
@@ -154,6 +211,10 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
 
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
 
+  // translate independent resources ahead of time, they are added to m_model below as they come up
+  LOG(Trace,"Staging independent resource objects.");
+  stageIndependentObjects();
+
   // look for site object in workspace and translate if found
   LOG(Trace,"Translating Site:Location object.");
   vector<WorkspaceObject> site = m_workspace.getObjectsByType(IddObjectType::Site_Location);
@@ -189,6 +250,7 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   }
 
   LOG(Trace,"Translation nominally complete.");
+  m_stagedObjects.clear();
   m_model.setFastNaming(false);
   return m_model;
 }
@@ -224,18 +286,56 @@ std::vector<IdfObject> ReverseTranslator::untranslatedIdfObjects() const
   return m_untranslatedIdfObjects;
 }
 
-struct IdfObjectEqual {
-  explicit IdfObjectEqual(const IdfObject& target)
-    : m_target(target)
-  {}
+void ReverseTranslator::stageIndependentObjects()
+{
+  if (QThreadPool::globalInstance()->maxThreadCount() < 2){
+    return;
+  }
 
-  bool operator()(const IdfObject& other) const
-  {
-    return (m_target == other);
+  // the dependency graph is the workspace's pointers, an object that points to nothing can be
+  // translated on its own
+  std::vector<StagingBatch> batches;
+  for (const WorkspaceObject& object : m_workspace.objects(true)){
+    if (!isStageableObjectType(object.iddObject().type()) || !object.targets().empty()){
+      continue;
+    }
+    if (batches.empty() || (batches.back().objects.size() == stagingBatchSize)){
+      batches.push_back(StagingBatch());
+    }
+    batches.back().objects.push_back(object);
+
+    // fill the lazily cached IddObject data up front, so the workers only read it
+    object.iddObject().hasNameField();
   }
 
-  IdfObject m_target;
-};
+  if (batches.size() < 2u){
+    return;
+  }
+
+  // each batch is translated by its own translator into its own Model. the objects are only
+  // read, and IdfObject_Impl is a QObject, so each result is handed back to the calling thread
+  QThread* thread = QThread::currentThread();
+  QtConcurrent::blockingMap(batches, [thread](StagingBatch& batch) {
+    ReverseTranslator stagingTranslator;
+    stagingTranslator.m_model.setFastNaming(true);
+    for (const WorkspaceObject& object : batch.objects){
+      boost::optional<IdfObject> staged;
+      if (boost::optional<ModelObject> modelObject = stagingTranslator.translateAndMapWorkspaceObject(object)){
+        staged = modelObject->idfObject();
+        staged->getImpl<openstudio::detail::IdfObject_Impl>()->moveToThread(thread);
+      }
+      batch.staged.push_back(staged);
+    }
+  });
+
+  for (const StagingBatch& batch : batches){
+    for (unsigned i = 0, n = batch.objects.size(); i < n; ++i){
+      if (batch.staged[i]){
+        m_stagedObjects.insert(std::make_pair(batch.objects[i].handle(), *batch.staged[i]));
+      }
+    }
+  }
+}
 
 boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject)
 {
@@ -248,6 +348,24 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     return boost::optional<ModelObject>(i->second);
   }
 
+  // already translated by stageIndependentObjects, added here so that model objects are created
+  // in the same order as when every object is translated on demand
+  auto staged = m_stagedObjects.find(workspaceObject.handle());
+  if( staged != m_stagedObjects.end() )
+  {
+    OptionalWorkspaceObject added = m_model.addObject(staged->second);
+    OS_ASSERT(added);
+    m_stagedObjects.erase(staged);
+    modelObject = added->cast<ModelObject>();
+
+    LOG(Trace,"Adding staged " << modelObject->briefDescription() << " to map.");
+    m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
+    if (m_progressBar){
+      m_progressBar->setValue(m_untranslatedIdfObjects.size() + m_workspaceToModelMap.size());
+    }
+    return modelObject;
+  }
+
   LOG(Trace,"Translating " << workspaceObject.briefDescription() << ".");
 
   // DLM: the scope of this translator is being changed, we now only import objects from idf
@@ -879,7 +997,7 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
   }else{
     if (addToUntranslated){
-      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
+      if (m_untranslatedHandles.insert(workspaceObject.handle()).second){
         LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
         m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
       }
@@ -25,6 +25,8 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -69,6 +71,13 @@ class ENERGYPLUS_API ReverseTranslator {
    */
   boost::optional<model::ModelObject> translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject);
 
+  /** Translates materials and curves that point to no other objects ahead of time, in batches on
+   *  the global QThreadPool. Each batch has its own translator and Model, so m_model is not
+   *  touched. The results are kept in m_stagedObjects, and translateAndMapWorkspaceObject adds
+   *  each one to m_model when the serial translation reaches it, so the translated Model is the
+   *  same as with a single thread. Does nothing if the pool has fewer than two threads. */
+  void stageIndependentObjects();
+
   boost::optional<model::ModelObject> translateAirLoopHVAC(const WorkspaceObject& workspaceObject);
 
   boost::optional<model::ModelObject> translateAirLoopHVACOutdoorAirSystem(const WorkspaceObject& workspaceObject);
@@ -281,6 +290,10 @@ class ENERGYPLUS_API ReverseTranslator {
 
   std::vector<IdfObject> m_untranslatedIdfObjects;
 
+  std::set<openstudio::Handle> m_untranslatedHandles;
+
+  std::map<openstudio::Handle,IdfObject> m_stagedObjects;
+
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
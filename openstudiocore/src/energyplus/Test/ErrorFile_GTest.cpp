@@ -26,6 +26,8 @@
 
 #include <resources.hxx>
 
+#include <boost/filesystem/fstream.hpp>
+
 #include <sstream>
 
 using openstudio::energyplus::ErrorFile;
@@ -105,3 +107,144 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
 }
 
 
+TEST_F(EnergyPlusFixture,ErrorFile_RepeatingWarnings)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  EXPECT_EQ(static_cast<unsigned>(52), errorFile.warnings().size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.severeErrors().size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.fatalErrors().size());
+  EXPECT_TRUE(errorFile.completed());
+
+  std::vector<std::pair<std::string, unsigned> > counts = errorFile.warningCounts();
+  ASSERT_EQ(static_cast<unsigned>(11), counts.size());
+  unsigned total = 0;
+  for (const auto& count : counts){
+    total += count.second;
+  }
+  EXPECT_EQ(errorFile.numWarnings(), total);
+  EXPECT_EQ(errorFile.warnings().size(), total);
+  EXPECT_EQ("Output:Meter: invalid Name=\"*\" - not found.", counts[3].first);
+  EXPECT_EQ(static_cast<unsigned>(2), counts[3].second);
+  EXPECT_EQ("CalcDoe2DXCoil: Coil:Cooling:DX:SingleSpeed \"*\" - Full load outlet air dry-bulb temperature < #C. This indicates the possibility of coil frost/freeze. Outlet temperature = # C.", 
+            counts[5].first);
+  EXPECT_EQ(static_cast<unsigned>(12), counts[5].second);
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_MessageTemplate)
+{
+  EXPECT_EQ("Output:Meter: invalid Name=\"*\" - not found.", 
+            ErrorFile::messageTemplate("Output:Meter: invalid Name=\"DISTRICTCOOLING:FACILITY\" - not found."));
+  EXPECT_EQ("CalcDoe2DXCoil: temperature = #", 
+            ErrorFile::messageTemplate("CalcDoe2DXCoil: temperature = -3.80\n ... Occurrence info = 01/21 21:10"));
+  EXPECT_EQ("Unterminated \"quote 1", ErrorFile::messageTemplate("Unterminated \"quote 1"));
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_Update)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+  boost::filesystem::ifstream ifs(path, std::ios_base::in | std::ios_base::binary);
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  std::string text = ss.str();
+  ifs.close();
+
+  // append the file in pieces that split lines, as EnergyPlus would while running
+  openstudio::path tailPath = openstudio::toPath("./ErrorFile_Update.err");
+  boost::filesystem::ofstream ofs(tailPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  ofs.close();
+
+  ErrorFile errorFile(tailPath);
+  EXPECT_FALSE(errorFile.update());
+  EXPECT_TRUE(errorFile.warnings().empty());
+
+  bool sawFatal = false;
+  for (std::string::size_type i = 0; i < text.size(); i += 37){
+    ofs.open(tailPath, std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+    ofs << text.substr(i, 37);
+    ofs.close();
+    errorFile.update();
+    if (!errorFile.fatalErrors().empty()){
+      sawFatal = true;
+    }
+  }
+  EXPECT_TRUE(sawFatal);
+
+  ErrorFile expected(path);
+  EXPECT_EQ(expected.warnings(), errorFile.warnings());
+  EXPECT_EQ(expected.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(expected.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_EQ(expected.warningCounts(), errorFile.warningCounts());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_FALSE(errorFile.completedSuccessfully());
+  EXPECT_FALSE(errorFile.update());
+
+  // a new run truncates the file, which is then read from the start
+  ErrorFile rerun(tailPath);
+  ofs.open(tailPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  ofs << "   ** Warning ** New run\n";
+  ofs.close();
+  EXPECT_TRUE(rerun.update());
+  ASSERT_EQ(static_cast<unsigned>(1), rerun.warnings().size());
+  EXPECT_EQ("New run", rerun.warnings()[0]);
+  EXPECT_TRUE(rerun.severeErrors().empty());
+  EXPECT_FALSE(rerun.completed());
+
+  // a new run that is already longer than the last read is recognized by its first line
+  ofs.open(tailPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  ofs << "   ** Severe  ** Another run\n   ** Warning ** Another warning\n";
+  ofs.close();
+  EXPECT_TRUE(rerun.update());
+  ASSERT_EQ(static_cast<unsigned>(1), rerun.warnings().size());
+  EXPECT_EQ("Another warning", rerun.warnings()[0]);
+  ASSERT_EQ(static_cast<unsigned>(1), rerun.severeErrors().size());
+
+  // so is a longer run that starts the same way as a completed run, since nothing follows completion
+  std::string head = "   ** Warning ** " + std::string(300, 'x') + "\n";
+  ofs.open(tailPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  ofs << head << "   ** Warning ** First run\n   ************* EnergyPlus Completed Successfully.\n";
+  ofs.close();
+  EXPECT_TRUE(rerun.update());
+  EXPECT_TRUE(rerun.completedSuccessfully());
+  ofs.open(tailPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  ofs << head << "   ** Warning ** Second run, which writes more warnings than the first\n";
+  ofs << "   ** Warning ** Second run, second warning\n   ** Warning ** Second run, third warning\n";
+  ofs.close();
+  EXPECT_TRUE(rerun.update());
+  ASSERT_EQ(static_cast<unsigned>(4), rerun.warnings().size());
+  EXPECT_EQ("Second run, third warning", rerun.warnings()[3]);
+  EXPECT_TRUE(rerun.severeErrors().empty());
+  EXPECT_FALSE(rerun.completed());
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_WarningsPerTemplate)
+{
+  openstudio::path path = openstudio::toPath("./ErrorFile_WarningsPerTemplate.err");
+  unsigned numRepeats = 3 * ErrorFile::maxWarningsPerTemplate;
+  boost::filesystem::ofstream ofs(path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  for (unsigned i = 0; i < numRepeats; ++i){
+    ofs << "   ** Warning ** Zone \"ZONE " << i << "\" temperature = " << i << "\n";
+    ofs << "   **   ~~~   ** Occurrence " << i << "\n";
+  }
+  ofs << "   ** Warning ** Different warning\n";
+  ofs << "   ************* EnergyPlus Completed Successfully.\n";
+  ofs.close();
+
+  ErrorFile errorFile(path);
+  EXPECT_EQ(numRepeats + 1, errorFile.numWarnings());
+  std::vector<std::pair<std::string, unsigned> > counts = errorFile.warningCounts();
+  ASSERT_EQ(static_cast<unsigned>(2), counts.size());
+  EXPECT_EQ("Zone \"*\" temperature = #", counts[0].first);
+  EXPECT_EQ(numRepeats, counts[0].second);
+  EXPECT_EQ("Different warning", counts[1].first);
+  EXPECT_EQ(static_cast<unsigned>(1), counts[1].second);
+
+  // only the first messages of a template are kept in full, with their continuation lines
+  std::vector<std::string> warnings = errorFile.warnings();
+  ASSERT_EQ(ErrorFile::maxWarningsPerTemplate + 1, warnings.size());
+  EXPECT_EQ("Zone \"ZONE 0\" temperature = 0\n Occurrence 0", warnings[0]);
+  EXPECT_EQ("Different warning", warnings.back());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+}
+
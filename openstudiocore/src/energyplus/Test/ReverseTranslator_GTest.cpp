@@ -66,10 +66,19 @@
 #include <utilities/idd/Version_FieldEnums.hxx>
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/Site_Location_FieldEnums.hxx>
+#include <utilities/idd/Material_FieldEnums.hxx>
+#include <utilities/idd/Construction_FieldEnums.hxx>
+#include <utilities/idd/Curve_Quadratic_FieldEnums.hxx>
 #include "../../utilities/time/Time.hpp"
 
 #include <resources.hxx>
 
+#include <boost/lexical_cast.hpp>
+
+#include <QThreadPool>
+
+#include <algorithm>
+#include <set>
 #include <sstream>
 
 using namespace openstudio::energyplus;
@@ -444,3 +453,138 @@ TEST_F(EnergyPlusFixture,ReverseTranslator_ScheduleDayInterval) {
   EXPECT_EQ(Time(0,12,0),times[0]);
   EXPECT_EQ(Time(0,24,0),times[1]);
 }
+
+TEST_F(EnergyPlusFixture,ReverseTranslator_RepeatedTranslationMatches) {
+  openstudio::path idfPath = resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf");
+  OptionalIdfFile idfFile = IdfFile::load(idfPath, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  Workspace inWorkspace(*idfFile);
+
+  // the translator clones the workspace, so handles differ between translations; compare type,
+  // name and field count instead
+  auto describe = [](const Model& model) {
+    std::vector<std::string> result;
+    for (const ModelObject& object : model.modelObjects()){
+      std::stringstream ss;
+      ss << object.iddObject().name() << "," << object.name().get_value_or("") << "," << object.numFields();
+      result.push_back(ss.str());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  // the same translator twice, to check that its state is reset, and a fresh one
+  ReverseTranslator reverseTranslator;
+  Model model1 = reverseTranslator.translateWorkspace(inWorkspace);
+  std::vector<IdfObject> untranslated1 = reverseTranslator.untranslatedIdfObjects();
+  Model model2 = reverseTranslator.translateWorkspace(inWorkspace);
+  std::vector<IdfObject> untranslated2 = reverseTranslator.untranslatedIdfObjects();
+  ReverseTranslator freshTranslator;
+  Model model3 = freshTranslator.translateWorkspace(inWorkspace);
+
+  std::vector<std::string> objects1 = describe(model1);
+  EXPECT_FALSE(objects1.empty());
+  EXPECT_EQ(objects1, describe(model2));
+  EXPECT_EQ(objects1, describe(model3));
+
+  // untranslated objects are listed in the order they were skipped
+  std::vector<IdfObject> untranslated3 = freshTranslator.untranslatedIdfObjects();
+  ASSERT_EQ(untranslated1.size(), untranslated2.size());
+  ASSERT_EQ(untranslated1.size(), untranslated3.size());
+  for (unsigned i = 0, n = untranslated1.size(); i < n; ++i){
+    EXPECT_EQ(untranslated1[i].iddObject().type(), untranslated2[i].iddObject().type());
+    EXPECT_EQ(untranslated1[i].name(), untranslated2[i].name());
+    EXPECT_EQ(untranslated1[i].iddObject().type(), untranslated3[i].iddObject().type());
+    EXPECT_EQ(untranslated1[i].name(), untranslated3[i].name());
+  }
+}
+
+TEST_F(EnergyPlusFixture,ReverseTranslator_StagedTranslationMatches) {
+  // enough independent materials and curves for several staging batches, and constructions that
+  // point to them so that they are also reached through other objects
+  Workspace inWorkspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  for (unsigned i = 0; i < 1000; ++i){
+    std::string suffix = boost::lexical_cast<std::string>(i);
+    OptionalWorkspaceObject material = inWorkspace.addObject(IdfObject(IddObjectType::Material));
+    ASSERT_TRUE(material);
+    EXPECT_TRUE(material->setName("Material " + suffix));
+    EXPECT_TRUE(material->setString(MaterialFields::Roughness, "Rough"));
+    EXPECT_TRUE(material->setDouble(MaterialFields::Thickness, 0.01 + i * 0.0001));
+    EXPECT_TRUE(material->setDouble(MaterialFields::Conductivity, 1.0 + i));
+    EXPECT_TRUE(material->setDouble(MaterialFields::Density, 1000.0));
+    EXPECT_TRUE(material->setDouble(MaterialFields::SpecificHeat, 800.0));
+
+    OptionalWorkspaceObject curve = inWorkspace.addObject(IdfObject(IddObjectType::Curve_Quadratic));
+    ASSERT_TRUE(curve);
+    EXPECT_TRUE(curve->setName("Curve " + suffix));
+    EXPECT_TRUE(curve->setDouble(Curve_QuadraticFields::Coefficient1Constant, i / 3.0));
+    EXPECT_TRUE(curve->setDouble(Curve_QuadraticFields::MinimumValueofx, 0.0));
+    EXPECT_TRUE(curve->setDouble(Curve_QuadraticFields::MaximumValueofx, 1.0));
+
+    if (i % 10 == 0){
+      OptionalWorkspaceObject construction = inWorkspace.addObject(IdfObject(IddObjectType::Construction));
+      ASSERT_TRUE(construction);
+      EXPECT_TRUE(construction->setName("Construction " + suffix));
+      EXPECT_TRUE(construction->setString(ConstructionFields::OutsideLayer, "Material " + suffix));
+    }
+  }
+
+  // handles differ between translations, pointers are compared by the name getString returns
+  auto describe = [](const Model& model) {
+    std::vector<std::string> result;
+    for (const ModelObject& object : model.modelObjects()){
+      std::stringstream ss;
+      ss << object.iddObject().name();
+      unsigned first = object.iddObject().hasHandleField() ? 1u : 0u;
+      for (unsigned i = first, n = object.numFields(); i < n; ++i){
+        ss << "," << object.getString(i, false, true).get_value_or("");
+      }
+      result.push_back(ss.str());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  int maxThreadCount = QThreadPool::globalInstance()->maxThreadCount();
+
+  QThreadPool::globalInstance()->setMaxThreadCount(1);
+  ReverseTranslator serialTranslator;
+  Model serial = serialTranslator.translateWorkspace(inWorkspace);
+
+  QThreadPool::globalInstance()->setMaxThreadCount(4);
+  ReverseTranslator stagedTranslator;
+  Model staged = stagedTranslator.translateWorkspace(inWorkspace);
+
+  QThreadPool::globalInstance()->setMaxThreadCount(maxThreadCount);
+
+  EXPECT_EQ(1000u, staged.getModelObjects<StandardOpaqueMaterial>().size());
+  EXPECT_EQ(100u, staged.getModelObjects<Construction>().size());
+  EXPECT_EQ(describe(serial), describe(staged));
+  EXPECT_EQ(serialTranslator.untranslatedIdfObjects().size(), stagedTranslator.untranslatedIdfObjects().size());
+  EXPECT_EQ(serialTranslator.warnings().size(), stagedTranslator.warnings().size());
+  EXPECT_EQ(serialTranslator.errors().size(), stagedTranslator.errors().size());
+
+  // staged materials are the ones the constructions use
+  for (const Construction& construction : staged.getModelObjects<Construction>()){
+    std::vector<Material> layers = construction.layers();
+    ASSERT_EQ(1u, layers.size());
+    EXPECT_EQ(construction.name().get().substr(13), layers[0].name().get().substr(9));
+  }
+}
+
+TEST_F(EnergyPlusFixture,ReverseTranslator_UntranslatedObjectsAreUnique) {
+  openstudio::path idfPath = resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf");
+  OptionalIdfFile idfFile = IdfFile::load(idfPath, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  Workspace inWorkspace(*idfFile);
+
+  ReverseTranslator reverseTranslator;
+  Model model = reverseTranslator.translateWorkspace(inWorkspace);
+
+  std::vector<IdfObject> untranslated = reverseTranslator.untranslatedIdfObjects();
+  EXPECT_FALSE(untranslated.empty());
+  std::set<Handle> handles;
+  for (const IdfObject& object : untranslated){
+    EXPECT_TRUE(handles.insert(object.handle()).second);
+  }
+}
@@ -41,7 +41,7 @@
 namespace openstudio {
 namespace gbxml {
  
-    boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model)
+    boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
     {
         // Krishnan, this constructor should only be used for unique objects like Building and Site
         //openstudio::model::Construction construction = model.getUniqueModelObject<openstudio::model::Construction>();
@@ -60,20 +60,16 @@ namespace gbxml {
         QString layerId = layerIdList.at(0).toElement().attribute("layerIdRef");
 
         std::vector<openstudio::model::Material> materials;
-        for (int i = 0; i < layerElements.count(); i++){
-          QDomElement layerElement = layerElements.at(i).toElement();
-          if (layerId == layerElement.attribute("id")){
-            QDomNodeList materialIdElements = layerElement.elementsByTagName("MaterialId");
-            for (int j = 0; j < materialIdElements.count(); j++){
-              QString materialId = materialIdElements.at(j).toElement().attribute("materialIdRef");
-              
-              // we are naming openstudio objects with id to guarantee unique names, there should be a material with this name in the openstudio model
-              std::string materialName = materialId.toStdString();
-              boost::optional<openstudio::model::Material> material = model.getModelObjectByName<openstudio::model::Material>(materialName);
-              OS_ASSERT(material); // Krishnan, what type of error handling do you want?
-              materials.push_back(*material);
-            }
-            break;
+        QDomElement layerElement = findElement("Layer", layerId);
+        if (!layerElement.isNull()){
+          QDomNodeList materialIdElements = layerElement.elementsByTagName("MaterialId");
+          for (int j = 0; j < materialIdElements.count(); j++){
+            QString materialId = materialIdElements.at(j).toElement().attribute("materialIdRef");
+
+            // materials are translated before constructions, there should be a material for this id in the openstudio model
+            boost::optional<openstudio::model::Material> material = findModelObject<openstudio::model::Material>(materialId);
+            OS_ASSERT(material); // Krishnan, what type of error handling do you want?
+            materials.push_back(*material);
           }
         }
 
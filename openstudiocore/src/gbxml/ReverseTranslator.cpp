@@ -142,11 +142,36 @@ namespace gbxml {
     return translateGBXML(doc.documentElement(), doc);
   }
 
+  void ReverseTranslator::indexElements(const QDomElement& element, const QString& tagName)
+  {
+    QDomNodeList elements = element.elementsByTagName(tagName);
+    for (int i = 0; i < elements.count(); i++){
+      QDomElement thisElement = elements.at(i).toElement();
+      QString id = thisElement.attribute("id");
+      if (!id.isEmpty()){
+        // keep the first element with a given id, this is the one a linear search would find
+        m_idToElementMap.insert(std::make_pair(std::make_pair(tagName, id), thisElement));
+      }
+    }
+  }
+
+  QDomElement ReverseTranslator::findElement(const QString& tagName, const QString& id) const
+  {
+    auto it = m_idToElementMap.find(std::make_pair(tagName, id));
+    if (it != m_idToElementMap.end()){
+      return it->second;
+    }
+    return QDomElement();
+  }
+
   boost::optional<model::Model> ReverseTranslator::translateGBXML(const QDomElement& element, const QDomDocument& doc)
   {
     openstudio::model::Model model;
     model.setFastNaming(true);
 
+    m_idToElementMap.clear();
+    m_idToModelObjectMap.clear();
+
     // gbXML attributes not mapped directly to IDF, but needed to map
 
     // {F, C, K, R}
@@ -221,6 +246,7 @@ namespace gbxml {
       QDomElement materialElement = materialElements.at(i).toElement();
       boost::optional<model::ModelObject> material = translateMaterial(materialElement, doc, model);
       OS_ASSERT(material); // Krishnan, what type of error handling do you want?
+      m_idToModelObjectMap.insert(std::make_pair(materialElement.attribute("id"), *material));
       
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -228,7 +254,7 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    QDomNodeList layerElements = element.elementsByTagName("Layer");
+    indexElements(element, "Layer");
     QDomNodeList constructionElements = element.elementsByTagName("Construction");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
@@ -239,8 +265,9 @@ namespace gbxml {
 
     for (int i = 0; i < constructionElements.count(); i++){
       QDomElement constructionElement = constructionElements.at(i).toElement();
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, doc, model);
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, doc, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
+      m_idToModelObjectMap.insert(std::make_pair(constructionElement.attribute("id"), *construction));
       
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -248,6 +275,8 @@ namespace gbxml {
     }
 
     // do schedules before loads
+    indexElements(element, "DaySchedule");
+    indexElements(element, "WeekSchedule");
     QDomNodeList scheduleElements = element.elementsByTagName("Schedule");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Schedules"));
@@ -279,6 +308,7 @@ namespace gbxml {
       QDomElement zoneElement = zoneElements.at(i).toElement();
       boost::optional<model::ModelObject> zone = translateThermalZone(zoneElement, doc, model);
       OS_ASSERT(zone); // Krishnan, what type of error handling do you want?
+      m_idToModelObjectMap.insert(std::make_pair(zoneElement.attribute("id"), *zone));
       
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -293,6 +323,9 @@ namespace gbxml {
 
     model.setFastNaming(false);
 
+    m_idToElementMap.clear();
+    m_idToModelObjectMap.clear();
+
     return model;
   }
 
@@ -346,8 +379,10 @@ namespace gbxml {
     }
 
     for (int i = 0; i < storyElements.count(); ++i){
-      boost::optional<model::ModelObject> story = translateBuildingStory(storyElements.at(i).toElement(), doc, model);
+      QDomElement storyElement = storyElements.at(i).toElement();
+      boost::optional<model::ModelObject> story = translateBuildingStory(storyElement, doc, model);
       OS_ASSERT(story);
+      m_idToModelObjectMap.insert(std::make_pair(storyElement.attribute("id"), *story));
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -363,8 +398,10 @@ namespace gbxml {
     }
 
     for (int i = 0; i < spaceElements.count(); ++i){
-      boost::optional<model::ModelObject> space = translateSpace(spaceElements.at(i).toElement(), doc, model);
+      QDomElement spaceElement = spaceElements.at(i).toElement();
+      boost::optional<model::ModelObject> space = translateSpace(spaceElement, doc, model);
       OS_ASSERT(space);
+      m_idToModelObjectMap.insert(std::make_pair(spaceElement.attribute("id"), *space));
 
       if (m_progressBar){
         m_progressBar->setValue(m_progressBar->value() + 1);
@@ -408,23 +445,18 @@ namespace gbxml {
     QString id = element.attribute("id");
     space.setName(escapeName(id));
 
-    //DLM: we should be using a map of id to model object to get this, not relying on name
     QString storyId = element.attribute("buildingStoreyIdRef");
-    boost::optional<WorkspaceObject> story = model.getObjectByTypeAndName(openstudio::model::BuildingStory::iddObjectType(), escapeName(storyId));
+    boost::optional<openstudio::model::BuildingStory> story = findModelObject<openstudio::model::BuildingStory>(storyId);
     if (story){
-      if (story->optionalCast<openstudio::model::BuildingStory>()){
-        space.setBuildingStory(story->cast<openstudio::model::BuildingStory>());
-      }
+      space.setBuildingStory(*story);
     }
 
     // if space doesn't have story assigned should we warn the user?
 
     QString zoneId = element.attribute("zoneIdRef");
-    boost::optional<WorkspaceObject> zone = model.getObjectByTypeAndName(openstudio::model::ThermalZone::iddObjectType(), escapeName(zoneId));
-    if (zone){
-      if (boost::optional<openstudio::model::ThermalZone> thermalZone = zone->optionalCast<openstudio::model::ThermalZone>()){
-        space.setThermalZone(thermalZone.get());
-      }
+    boost::optional<openstudio::model::ThermalZone> thermalZone = findModelObject<openstudio::model::ThermalZone>(zoneId);
+    if (thermalZone){
+      space.setThermalZone(*thermalZone);
     }
 
     if (!space.thermalZone()){
@@ -572,8 +604,7 @@ namespace gbxml {
       // translate construction
       QString constructionIdRef = element.attribute("constructionIdRef");
       if (!constructionIdRef.isEmpty()){
-        std::string constructionName = escapeName(constructionIdRef);
-        boost::optional<model::ConstructionBase> construction = model.getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = findModelObject<model::ConstructionBase>(constructionIdRef);
         if (construction){
           surface.setConstruction(*construction);
         }
@@ -590,11 +621,9 @@ namespace gbxml {
       }
 
       QString spaceId = adjacentSpaceElements.at(0).toElement().attribute("spaceIdRef");
-      std::string spaceName = toString(spaceId);
-
-      boost::optional<openstudio::WorkspaceObject> workspaceObject = model.getObjectByTypeAndName(IddObjectType::OS_Space, spaceName);
-      if (workspaceObject && workspaceObject->optionalCast<openstudio::model::Space>()){
-        surface.setSpace(workspaceObject->cast<openstudio::model::Space>());
+      boost::optional<openstudio::model::Space> thisSpace = findModelObject<openstudio::model::Space>(spaceId);
+      if (thisSpace){
+        surface.setSpace(*thisSpace);
       }
 
       boost::optional<openstudio::model::Space> space = surface.space();
@@ -604,11 +633,9 @@ namespace gbxml {
 
       if (space && adjacentSpaceElements.size() == 2){
 
-        QString spaceId = adjacentSpaceElements.at(1).toElement().attribute("spaceIdRef");
-        std::string spaceName = toString(spaceId);
-
-        boost::optional<openstudio::WorkspaceObject> workspaceObject = model.getObjectByTypeAndName(IddObjectType::OS_Space, spaceName);
-        if (workspaceObject && workspaceObject->optionalCast<openstudio::model::Space>()){
+        QString adjacentSpaceId = adjacentSpaceElements.at(1).toElement().attribute("spaceIdRef");
+        boost::optional<openstudio::model::Space> adjacentSpace = findModelObject<openstudio::model::Space>(adjacentSpaceId);
+        if (adjacentSpace){
 
           // DLM: we have issues if interior ceilings/floors are mislabeled, override surface type for adjacent surfaces 
           // http://code.google.com/p/cbecc/issues/detail?id=471
@@ -619,10 +646,9 @@ namespace gbxml {
           }
 
           // clone the surface and sub surfaces and reverse vertices
-          model::Space adjacentSpace = workspaceObject->cast<openstudio::model::Space>();
-          boost::optional<openstudio::model::Surface> otherSurface = surface.createAdjacentSurface(adjacentSpace);
+          boost::optional<openstudio::model::Surface> otherSurface = surface.createAdjacentSurface(*adjacentSpace);
           if(!otherSurface){
-            LOG(Error, "Could not create adjacent surface in adjacent space '" << adjacentSpace.name().get() << "' for surface '" << surface.name().get() << "' in space '" << space->name().get() << "'");
+            LOG(Error, "Could not create adjacent surface in adjacent space '" << adjacentSpace->name().get() << "' for surface '" << surface.name().get() << "' in space '" << space->name().get() << "'");
           }
         }
       }
@@ -677,8 +703,7 @@ namespace gbxml {
     // translate construction
     QString constructionIdRef = element.attribute("constructionIdRef");
     if (!constructionIdRef.isEmpty()){
-      std::string constructionName = escapeName(constructionIdRef);
-      boost::optional<model::ConstructionBase> construction = model.getModelObjectByName<model::ConstructionBase>(constructionName);
+      boost::optional<model::ConstructionBase> construction = findModelObject<model::ConstructionBase>(constructionIdRef);
       if (construction){
         surface.setConstruction(*construction);
       }
@@ -31,8 +31,13 @@
 
 #include "../utilities/units/Unit.hpp"
 
+#include "../model/ModelObject.hpp"
+
+#include <QDomElement>
+
+#include <map>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
 
 namespace openstudio {
@@ -80,7 +85,7 @@ namespace gbxml {
     boost::optional<openstudio::model::ModelObject> translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateScheduleWeek(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
@@ -88,7 +93,32 @@ namespace gbxml {
     boost::optional<openstudio::model::ModelObject> translateSpace(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateSurface(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateSubSurface(const QDomElement& element, const QDomDocument& doc, openstudio::model::Surface& surface);
-      
+
+    // index all elements of type tagName below element by their id attribute
+    void indexElements(const QDomElement& element, const QString& tagName);
+
+    // returns the element of type tagName with this id, null element if not found
+    QDomElement findElement(const QString& tagName, const QString& id) const;
+
+    // returns the model object translated from the element with this id
+    template <typename T>
+    boost::optional<T> findModelObject(const QString& id) const
+    {
+      auto range = m_idToModelObjectMap.equal_range(id);
+      for (auto it = range.first; it != range.second; ++it){
+        if (boost::optional<T> result = it->second.optionalCast<T>()){
+          return result;
+        }
+      }
+      return boost::none;
+    }
+
+    // gbXML elements keyed by tag name and id, avoids repeated searches of the whole document
+    std::map<std::pair<QString, QString>, QDomElement> m_idToElementMap;
+
+    // translated model objects keyed by gbXML id, avoids linear searches of the model by name
+    std::multimap<QString, openstudio::model::ModelObject> m_idToModelObjectMap;
+
     StringStreamLogSink m_logSink;
 
     ProgressBar* m_progressBar;
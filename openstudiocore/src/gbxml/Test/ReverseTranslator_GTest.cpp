@@ -30,18 +30,25 @@
 #include "../../model/Facility_Impl.hpp"
 #include "../../model/Building.hpp"
 #include "../../model/Building_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
 #include "../../model/Space_Impl.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/Surface_Impl.hpp"
+#include "../../model/ConstructionBase.hpp"
+#include "../../model/ConstructionBase_Impl.hpp"
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
 
 #include <resources.hxx>
 
+#include <boost/timer.hpp>
+
+#include <fstream>
 #include <sstream>
 
 using namespace openstudio::energyplus;
@@ -131,3 +138,109 @@ TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane)
   bool test = forwardTranslator.modelToGbXML(*model, outputPath);
   EXPECT_TRUE(test);
 }
+
+// writes a gbXML file with numSpaces box shaped spaces, each with its own zone and six surfaces
+void writeSyntheticGbXML(const openstudio::path& path, unsigned numSpaces)
+{
+  std::ofstream os(openstudio::toString(path).c_str());
+
+  os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
+  os << "<gbXML temperatureUnit=\"C\" lengthUnit=\"Meters\" areaUnit=\"SquareMeters\" volumeUnit=\"CubicMeters\" useSIUnitsForResults=\"true\">" << std::endl;
+  os << "<Campus id=\"cmps-1\">" << std::endl;
+  os << "<Building id=\"bldg-1\" buildingType=\"Office\">" << std::endl;
+  os << "<BuildingStorey id=\"story-1\"><Level>0</Level></BuildingStorey>" << std::endl;
+  for (unsigned i = 0; i < numSpaces; ++i){
+    os << "<Space id=\"sp-" << i << "\" zoneIdRef=\"zone-" << i << "\" buildingStoreyIdRef=\"story-1\"/>" << std::endl;
+  }
+  os << "</Building>" << std::endl;
+
+  // each surface is a list of corner indices into the box corners below
+  const char* surfaceTypes[] = {"SlabOnGrade", "Roof", "ExteriorWall", "ExteriorWall", "ExteriorWall", "ExteriorWall"};
+  const int corners[6][4] = {{0,3,2,1}, {4,5,6,7}, {0,1,5,4}, {1,2,6,5}, {2,3,7,6}, {3,0,4,7}};
+  for (unsigned i = 0; i < numSpaces; ++i){
+    double x0 = 10.0 * i;
+    double points[8][3] = {{x0,0,0}, {x0+10,0,0}, {x0+10,10,0}, {x0,10,0},
+                           {x0,0,3}, {x0+10,0,3}, {x0+10,10,3}, {x0,10,3}};
+    for (unsigned j = 0; j < 6; ++j){
+      os << "<Surface id=\"su-" << i << "-" << j << "\" surfaceType=\"" << surfaceTypes[j] << "\" constructionIdRef=\"cons-" << j % 2 << "\"";
+      os << " exposedToSun=\"" << (j == 0 ? "false" : "true") << "\">" << std::endl;
+      os << "<AdjacentSpaceId spaceIdRef=\"sp-" << i << "\"/>" << std::endl;
+      os << "<PlanarGeometry><PolyLoop>" << std::endl;
+      for (unsigned k = 0; k < 4; ++k){
+        const double* point = points[corners[j][k]];
+        os << "<CartesianPoint><Coordinate>" << point[0] << "</Coordinate><Coordinate>" << point[1] << "</Coordinate><Coordinate>" << point[2] << "</Coordinate></CartesianPoint>" << std::endl;
+      }
+      os << "</PolyLoop></PlanarGeometry>" << std::endl;
+      os << "</Surface>" << std::endl;
+    }
+  }
+  os << "</Campus>" << std::endl;
+
+  for (unsigned j = 0; j < 2; ++j){
+    os << "<Construction id=\"cons-" << j << "\"><LayerId layerIdRef=\"layer-" << j << "\"/></Construction>" << std::endl;
+    os << "<Layer id=\"layer-" << j << "\"><MaterialId materialIdRef=\"mat-" << j << "\"/></Layer>" << std::endl;
+    os << "<Material id=\"mat-" << j << "\"><R-value unit=\"SquareMeterKPerW\">" << j + 1 << "</R-value></Material>" << std::endl;
+  }
+
+  for (unsigned i = 0; i < numSpaces; ++i){
+    os << "<Zone id=\"zone-" << i << "\"/>" << std::endl;
+  }
+
+  os << "</gbXML>" << std::endl;
+  os.close();
+}
+
+TEST_F(gbXMLFixture, ReverseTranslator_SyntheticCampus)
+{
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/SyntheticCampus.xml");
+
+  for (unsigned numSpaces : {10u, 100u}){
+    writeSyntheticGbXML(inputPath, numSpaces);
+
+    openstudio::gbxml::ReverseTranslator reverseTranslator;
+    boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+    ASSERT_TRUE(model);
+
+    ASSERT_EQ(1u, model->getModelObjects<BuildingStory>().size());
+    ASSERT_EQ(numSpaces, model->getModelObjects<Space>().size());
+    ASSERT_EQ(numSpaces, model->getModelObjects<ThermalZone>().size());
+    ASSERT_EQ(6*numSpaces, model->getModelObjects<Surface>().size());
+
+    // references are resolved by id
+    OptionalSpace space = model->getModelObjectByName<Space>("sp-7");
+    ASSERT_TRUE(space);
+    ASSERT_TRUE(space->thermalZone());
+    EXPECT_EQ("zone-7", space->thermalZone()->name().get());
+    ASSERT_TRUE(space->buildingStory());
+    EXPECT_EQ("story-1", space->buildingStory()->name().get());
+
+    OptionalSurface surface = model->getModelObjectByName<Surface>("su-7-1");
+    ASSERT_TRUE(surface);
+    ASSERT_TRUE(surface->space());
+    EXPECT_EQ(space->handle(), surface->space()->handle());
+    ASSERT_TRUE(surface->construction());
+    EXPECT_EQ("cons-1", surface->construction()->name().get());
+  }
+}
+
+TEST_F(gbXMLFixture, ReverseTranslator_SyntheticCampus_Benchmark)
+{
+  // logs import times as the campus grows, asserts nothing about them
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/SyntheticCampusBenchmark.xml");
+
+  std::stringstream timings;
+  for (unsigned numSpaces : {100u, 400u, 1600u}){
+    writeSyntheticGbXML(inputPath, numSpaces);
+
+    boost::timer t;
+    openstudio::gbxml::ReverseTranslator reverseTranslator;
+    boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+    double importTime = t.elapsed();
+    ASSERT_TRUE(model);
+    EXPECT_EQ(numSpaces, model->getModelObjects<Space>().size());
+
+    timings << " " << numSpaces << " spaces: " << importTime << " s;";
+  }
+
+  LOG(Info, "Imported synthetic gbXML with" << timings.str());
+}
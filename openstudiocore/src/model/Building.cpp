@@ -68,7 +68,9 @@ namespace model {
 namespace detail {
 
   Building_Impl::Building_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-    : ParentObject_Impl(idfObject, model, keepHandle)
+    : ParentObject_Impl(idfObject, model, keepHandle),
+      m_cachedAggregatesVersion(0),
+      m_conditionedFloorAreaCached(false)
   {
     OS_ASSERT(idfObject.iddObject().type() == Building::iddObjectType());
   }
@@ -76,7 +78,9 @@ namespace detail {
   Building_Impl::Building_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
                                Model_Impl* model,
                                bool keepHandle)
-    : ParentObject_Impl(other,model,keepHandle)
+    : ParentObject_Impl(other,model,keepHandle),
+      m_cachedAggregatesVersion(0),
+      m_conditionedFloorAreaCached(false)
   {
     OS_ASSERT(other.iddObject().type() == Building::iddObjectType());
   }
@@ -84,7 +88,9 @@ namespace detail {
   Building_Impl::Building_Impl(const Building_Impl& other,
                                Model_Impl* model,
                                bool keepHandle)
-    : ParentObject_Impl(other,model,keepHandle)
+    : ParentObject_Impl(other,model,keepHandle),
+      m_cachedAggregatesVersion(0),
+      m_conditionedFloorAreaCached(false)
   {}
 
   boost::optional<ParentObject> Building_Impl::parent() const
@@ -547,6 +553,11 @@ namespace detail {
 
   double Building_Impl::floorArea() const
   {
+    checkCachedAggregates();
+    if (m_cachedFloorArea){
+      return m_cachedFloorArea.get();
+    }
+
     double result = 0;
     for (const Space& space : spaces()){
       bool partofTotalFloorArea = space.partofTotalFloorArea();
@@ -554,11 +565,19 @@ namespace detail {
         result += space.multiplier() * space.floorArea();
       }
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedFloorArea = result;
     return result;
   }
 
   boost::optional<double> Building_Impl::conditionedFloorArea() const
   {
+    // boost::none is a valid result, so a flag marks it as cached
+    checkCachedAggregates();
+    if (m_conditionedFloorAreaCached){
+      return m_cachedConditionedFloorArea;
+    }
+
     boost::optional<double> result;
 
     for (const ThermalZone& thermalZone : thermalZones()){
@@ -581,10 +600,18 @@ namespace detail {
       }
     }
 
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedConditionedFloorArea = result;
+    m_conditionedFloorAreaCached = true;
     return result;
   }
 
   double Building_Impl::exteriorSurfaceArea() const {
+    checkCachedAggregates();
+    if (m_cachedExteriorSurfaceArea){
+      return m_cachedExteriorSurfaceArea.get();
+    }
+
     double result(0.0);
     for (const Surface& surface : model().getModelObjects<Surface>()) {
       OptionalSpace space = surface.space();
@@ -593,32 +620,55 @@ namespace detail {
         result += surface.grossArea() * space->multiplier();
       }
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedExteriorSurfaceArea = result;
     return result;
   }
 
   double Building_Impl::exteriorWallArea() const {
+    checkCachedAggregates();
+    if (m_cachedExteriorWallArea){
+      return m_cachedExteriorWallArea.get();
+    }
+
     double result(0.0);
     for (const Surface& exteriorWall : exteriorWalls()) {
       if (OptionalSpace space = exteriorWall.space()) {
         result += exteriorWall.grossArea() * space->multiplier();
       }
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedExteriorWallArea = result;
     return result;
   }
 
   double Building_Impl::airVolume() const {
+    checkCachedAggregates();
+    if (m_cachedAirVolume){
+      return m_cachedAirVolume.get();
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.volume() * space.multiplier();
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedAirVolume = result;
     return result;
   }
 
   double Building_Impl::numberOfPeople() const {
+    checkCachedAggregates();
+    if (m_cachedNumberOfPeople){
+      return m_cachedNumberOfPeople.get();
+    }
+
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.numberOfPeople() * space.multiplier();
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedNumberOfPeople = result;
     return result;
   }
 
@@ -647,10 +697,17 @@ namespace detail {
   }
   
   double Building_Impl::lightingPower() const {
+    checkCachedAggregates();
+    if (m_cachedLightingPower){
+      return m_cachedLightingPower.get();
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.multiplier() * space.lightingPower();
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedLightingPower = result;
     return result;
   }
 
@@ -685,10 +742,17 @@ namespace detail {
   }
 
   double Building_Impl::electricEquipmentPower() const {
+    checkCachedAggregates();
+    if (m_cachedElectricEquipmentPower){
+      return m_cachedElectricEquipmentPower.get();
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.multiplier() * space.electricEquipmentPower();
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedElectricEquipmentPower = result;
     return result;
   }
 
@@ -723,10 +787,17 @@ namespace detail {
   }
 
   double Building_Impl::gasEquipmentPower() const {
+    checkCachedAggregates();
+    if (m_cachedGasEquipmentPower){
+      return m_cachedGasEquipmentPower.get();
+    }
+
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.multiplier() * space.gasEquipmentPower();
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedGasEquipmentPower = result;
     return result;
   }
 
@@ -839,6 +910,25 @@ namespace detail {
     return openstudio::model::generateSkylightPattern(this->spaces(), 0.0, skylightToProjectedFloorRatio, desiredWidth, desiredHeight);
   }
 
+  void Building_Impl::checkCachedAggregates() const
+  {
+    // read the version before computing, anything the computation creates invalidates the results
+    unsigned version = model().getImpl<Model_Impl>()->spaceAggregatesVersion();
+    if (version != m_cachedAggregatesVersion){
+      m_cachedFloorArea.reset();
+      m_conditionedFloorAreaCached = false;
+      m_cachedConditionedFloorArea.reset();
+      m_cachedExteriorSurfaceArea.reset();
+      m_cachedExteriorWallArea.reset();
+      m_cachedAirVolume.reset();
+      m_cachedNumberOfPeople.reset();
+      m_cachedLightingPower.reset();
+      m_cachedElectricEquipmentPower.reset();
+      m_cachedGasEquipmentPower.reset();
+      m_cachedAggregatesVersion = version;
+    }
+  }
+
   openstudio::Quantity Building_Impl::northAxis_SI() const
   {
     OSOptionalQuantity value = getQuantity(OS_BuildingFields::NorthAxis,true,false);
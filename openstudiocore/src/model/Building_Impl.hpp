@@ -249,6 +249,21 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Building");
 
+    // valid while m_cachedAggregatesVersion matches Model_Impl::spaceAggregatesVersion
+    mutable unsigned m_cachedAggregatesVersion;
+    mutable boost::optional<double> m_cachedFloorArea;
+    mutable bool m_conditionedFloorAreaCached;
+    mutable boost::optional<double> m_cachedConditionedFloorArea;
+    mutable boost::optional<double> m_cachedExteriorSurfaceArea;
+    mutable boost::optional<double> m_cachedExteriorWallArea;
+    mutable boost::optional<double> m_cachedAirVolume;
+    mutable boost::optional<double> m_cachedNumberOfPeople;
+    mutable boost::optional<double> m_cachedLightingPower;
+    mutable boost::optional<double> m_cachedElectricEquipmentPower;
+    mutable boost::optional<double> m_cachedGasEquipmentPower;
+
+    void checkCachedAggregates() const;
+
     openstudio::Quantity northAxis_SI() const;
     openstudio::Quantity northAxis_IP() const;
     bool setNorthAxis(const Quantity& northAxis);   
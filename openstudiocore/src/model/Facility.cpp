@@ -22,6 +22,7 @@
 
 #include "Model.hpp"
 #include "Model_Impl.hpp"
+#include "SqlResultIndex.hpp"
 #include "Building.hpp"
 #include "Building_Impl.hpp"
 #include "LifeCycleCost.hpp"
@@ -65,6 +66,55 @@ namespace model {
 
 namespace detail {
 
+  namespace {
+
+    // same lookup and warning as the SqlFile query, read from the index
+    boost::optional<double> siteAndSourceEnergy(const SqlResultIndex& sqlResults, const std::string& rowName)
+    {
+      boost::optional<double> result = sqlResults.doubleValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                                                              "Site and Source Energy", rowName, "Total Energy", "GJ");
+      if (result){
+        boost::optional<double> hours = sqlResults.hoursSimulated();
+        if (!hours){
+          LOG_FREE(Warn, "openstudio.model.Facility", "Reporting " << rowName << " with unknown number of simulation hours");
+        }else if(*hours != 8760){
+          LOG_FREE(Warn, "openstudio.model.Facility", "Reporting " << rowName << " with " << *hours << " hrs");
+        }
+      }
+      return result;
+    }
+
+    // rowName in units, or the older "rowName (units)" row, of the Annual Cost table
+    boost::optional<double> annualCost(const SqlResultIndex& sqlResults, const FuelType& fuel,
+                                       const std::string& rowName, const std::string& units,
+                                       const std::string& combinedRowName)
+    {
+      std::string columnName;
+      if (fuel == FuelType::Electricity){
+        columnName = "Electric";
+      } else if (fuel == FuelType::Gas){
+        columnName = "Gas";
+      } else if (fuel == FuelType::DistrictCooling){
+        columnName = "District Cooling";
+      } else if (fuel == FuelType::DistrictHeating){
+        columnName = "District Heating";
+      } else if (fuel == FuelType::Water){
+        columnName = "Water";
+      } else{
+        columnName = "Other";
+      }
+
+      boost::optional<double> result = sqlResults.doubleValue("Economics Results Summary Report", "Entire Facility", "Annual Cost",
+                                                              rowName, columnName, units);
+      if (!result){
+        result = sqlResults.doubleValue("Economics Results Summary Report", "Entire Facility", "Annual Cost",
+                                        combinedRowName, columnName);
+      }
+      return result;
+    }
+
+  }
+
   Facility_Impl::Facility_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ParentObject_Impl(idfObject,model,keepHandle)
   {
@@ -184,6 +234,14 @@ namespace detail {
 
   OptionalDouble Facility_Impl::totalSiteEnergy() const
   {
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = siteAndSourceEnergy(*sqlResults, "Total Site Energy");
+      if (result){
+        return result;
+      }
+    }
+
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -194,6 +252,15 @@ namespace detail {
 
   OptionalDouble Facility_Impl::netSiteEnergy() const
   {
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = siteAndSourceEnergy(*sqlResults, "Net Site Energy");
+      if (result){
+        return result;
+      }
+    }
+
+    // SqlFile sums the meters when the tabular value is missing
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -204,6 +271,14 @@ namespace detail {
 
   OptionalDouble Facility_Impl::totalSourceEnergy() const
   {
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = siteAndSourceEnergy(*sqlResults, "Total Source Energy");
+      if (result){
+        return result;
+      }
+    }
+
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -214,6 +289,14 @@ namespace detail {
 
   OptionalDouble Facility_Impl::netSourceEnergy() const
   {
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = siteAndSourceEnergy(*sqlResults, "Net Source Energy");
+      if (result){
+        return result;
+      }
+    }
+
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -225,6 +308,14 @@ namespace detail {
    // pass in "Electric", "Gas", or "Other"
   OptionalDouble Facility_Impl::annualTotalCost(const FuelType& fuel) const
   {
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = annualCost(*sqlResults, fuel, "Cost", "~~$~~", "Cost (~~$~~)");
+      if (result){
+        return result;
+      }
+    }
+
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -235,6 +326,15 @@ namespace detail {
 
   OptionalDouble Facility_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
   {
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = annualCost(*sqlResults, fuel, "Cost per Total Building Area", "~~$~~/m2",
+                                         "Cost per Total Building Area (~~$~~/m2)");
+      if (result){
+        return result;
+      }
+    }
+
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -245,6 +345,16 @@ namespace detail {
 
   OptionalDouble Facility_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
   {
+    // the older combined row is the total building area one, as in SqlFile
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
+    if (sqlResults){
+      OptionalDouble result = annualCost(*sqlResults, fuel, "Cost per Net Conditioned Building Area", "~~$~~/m2",
+                                         "Cost per Total Building Area (~~$~~/m2)");
+      if (result){
+        return result;
+      }
+    }
+
     OptionalSqlFile mySqlFile = model().sqlFile();
     if (mySqlFile && mySqlFile->connectionOpen())
     {
@@ -256,12 +366,22 @@ namespace detail {
 
   boost::optional<double> Facility_Impl::annualTotalUtilityCost() const
   {
-    OptionalSqlFile mySqlFile = model().sqlFile();
-    if (mySqlFile && mySqlFile->connectionOpen())
-    {
-      return mySqlFile->annualTotalUtilityCost();
+    // sums the same fuels as SqlFile::annualTotalUtilityCost, through the index
+    std::vector<FuelType> fuels;
+    fuels.push_back(FuelType::Electricity);
+    fuels.push_back(FuelType::Gas);
+    fuels.push_back(FuelType::DistrictCooling);
+    fuels.push_back(FuelType::DistrictHeating);
+    fuels.push_back(FuelType::Water);
+
+    OptionalDouble result;
+    for (const FuelType& fuel : fuels){
+      OptionalDouble cost = annualTotalCost(fuel);
+      if (cost){
+        result = (result ? *result : 0.0) + *cost;
+      }
     }
-    return OptionalDouble();
+    return result;
   }
 
   boost::optional<double> Facility_Impl::annualElectricTotalCost() const
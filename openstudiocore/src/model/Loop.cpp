@@ -40,39 +40,77 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 namespace model {
 
 namespace detail {
   Loop_Impl::Loop_Impl(IddObjectType type, Model_Impl* model)
-    : ParentObject_Impl(type,model)
+    : ParentObject_Impl(type,model),
+      m_cachedTopologyVersion(model->topologyVersion())
   {
+    // connect signals
+    connect(model, &openstudio::detail::Workspace_Impl::onChange, this, &Loop_Impl::clearCachedTopology);
   }
 
   Loop_Impl::Loop_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-    : ParentObject_Impl(idfObject, model, keepHandle)
+    : ParentObject_Impl(idfObject, model, keepHandle),
+      m_cachedTopologyVersion(model->topologyVersion())
   { 
+    // connect signals
+    connect(model, &openstudio::detail::Workspace_Impl::onChange, this, &Loop_Impl::clearCachedTopology);
   }
 
   Loop_Impl::Loop_Impl(
       const openstudio::detail::WorkspaceObject_Impl& other, 
       Model_Impl* model, 
       bool keepHandle)
-    : ParentObject_Impl(other,model,keepHandle)
+    : ParentObject_Impl(other,model,keepHandle),
+      m_cachedTopologyVersion(model->topologyVersion())
   {
+    // connect signals
+    connect(model, &openstudio::detail::Workspace_Impl::onChange, this, &Loop_Impl::clearCachedTopology);
   }
 
   Loop_Impl::Loop_Impl(const Loop_Impl& other, 
       Model_Impl* model, 
       bool keepHandles)
-    : ParentObject_Impl(other,model,keepHandles)
+    : ParentObject_Impl(other,model,keepHandles),
+      m_cachedTopologyVersion(model->topologyVersion())
+  {
+    // connect signals
+    connect(model, &openstudio::detail::Workspace_Impl::onChange, this, &Loop_Impl::clearCachedTopology);
+  }
+
+  void Loop_Impl::clearCachedTopology()
+  {
+    resetCachedTopology();
+  }
+
+  void Loop_Impl::checkCachedTopology() const
+  {
+    unsigned topologyVersion = this->model().getImpl<Model_Impl>()->topologyVersion();
+    if( topologyVersion != m_cachedTopologyVersion )
+    {
+      resetCachedTopology();
+      m_cachedTopologyVersion = topologyVersion;
+    }
+  }
+
+  void Loop_Impl::resetCachedTopology() const
   {
+    m_cachedSupplyPaths.clear();
+    m_cachedDemandPaths.clear();
+    m_cachedSupplyComponentMap.reset();
+    m_cachedDemandComponentMap.reset();
   }
 
   const std::vector<std::string>& Loop_Impl::outputVariableNames() const
@@ -106,33 +144,32 @@ namespace detail {
     return ParentObject_Impl::remove();
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // searches all paths of nodes between the source and sink until a handle match is found
-  boost::optional<ModelObject> findModelObject(const openstudio::Handle & handle, const HVACComponent & sink, std::vector<HVACComponent> & visited, bool isDemandComponents)
+  // Depth first search
+  // collects every component reachable from source without passing through sink
+  void findReachableModelObjects(const HVACComponent & source, const HVACComponent & sink, std::map<Handle, ModelObject> & reachable, bool isDemandComponents)
   {
-    HVACComponent hvacComponent = visited.back();
-    if( handle == hvacComponent.handle() ) { 
-      return hvacComponent;
-    }
-    std::vector<HVACComponent> nodes = hvacComponent.getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
+    std::vector<HVACComponent> stack;
+    stack.push_back(source);
+    reachable.insert(std::make_pair(source.handle(), source));
 
-    for(std::vector<HVACComponent>::iterator it = nodes.begin();
-        it != nodes.end();
-        it++)
+    while( ! stack.empty() )
     {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(), visited.end(), *it) != visited.end() ||
-          *it == sink )
+      HVACComponent hvacComponent = stack.back();
+      stack.pop_back();
+
+      std::vector<HVACComponent> nodes = hvacComponent.getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
+      for( const auto & node : nodes )
       {
-        continue; 
+        if( node == sink )
+        {
+          continue;
+        }
+        if( reachable.insert(std::make_pair(node.handle(), node)).second )
+        {
+          stack.push_back(node);
+        }
       }
-      visited.push_back(*it);
-      boost::optional<ModelObject> foundHandle = findModelObject(handle, sink, visited, isDemandComponents);
-      if( foundHandle ) { return *foundHandle; }
-      visited.pop_back();
     }
-    return boost::none;
   }
 
   OptionalModelObject Loop_Impl::component(openstudio::Handle handle)
@@ -142,26 +179,39 @@ namespace detail {
     return this->demandComponent(handle);
   }
 
+  boost::optional<ModelObject> Loop_Impl::cachedComponent(const openstudio::Handle & handle, bool isDemandComponents) const
+  {
+    checkCachedTopology();
+
+    boost::optional<std::map<Handle, ModelObject> > & componentMap = isDemandComponents ? m_cachedDemandComponentMap : m_cachedSupplyComponentMap;
+
+    if( ! componentMap )
+    {
+      Node inletComp = isDemandComponents ? this->demandInletNode() : this->supplyInletNode();
+      Node outletComp = isDemandComponents ? this->demandOutletNode() : this->supplyOutletNode();
+
+      std::map<Handle, ModelObject> reachable;
+      findReachableModelObjects(inletComp, outletComp, reachable, isDemandComponents);
+      reachable.insert(std::make_pair(outletComp.handle(), outletComp));
+      componentMap = reachable;
+    }
+
+    auto it = componentMap->find(handle);
+    if( it != componentMap->end() )
+    {
+      return it->second;
+    }
+    return boost::none;
+  }
+
   boost::optional<ModelObject> Loop_Impl::demandComponent(openstudio::Handle handle) const
   {
-    Node inletComp = this->demandInletNode();
-    Node outletComp = this->demandOutletNode();
-    if( handle == inletComp.handle() ) { return inletComp; }
-    if( handle == outletComp.handle() ) { return outletComp; }
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    return findModelObject(handle, outletComp, visited, true);
+    return cachedComponent(handle, true);
   }
 
   boost::optional<ModelObject> Loop_Impl::supplyComponent(openstudio::Handle handle) const
   {
-    Node inletComp = this->supplyInletNode();
-    Node outletComp = this->supplyOutletNode();
-    if( handle == inletComp.handle() ) { return inletComp; }
-    if( handle == outletComp.handle() ) { return outletComp; }
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    return findModelObject(handle, outletComp, visited, false);
+    return cachedComponent(handle, false);
   }
 
   ModelObject Loop_Impl::clone(Model model) const
@@ -233,14 +283,20 @@ namespace detail {
   // Recursive depth first search
   // start algorithm with one source node in the visited vector
   // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
+  // visitedHandles and pathHandles mirror visited and paths for constant time membership tests
+  void findModelObjects(const HVACComponent & sink,
+                        std::vector<HVACComponent> & visited,
+                        std::set<Handle> & visitedHandles,
+                        std::vector<HVACComponent> & paths,
+                        std::set<Handle> & pathHandles,
+                        bool isDemandComponents)
   {
     std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
 
     for(const auto & node : nodes)
     {
       // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
+      if( visitedHandles.find(node.handle()) != visitedHandles.end() )
       {
         continue; 
       }
@@ -248,18 +304,11 @@ namespace detail {
       {
         visited.push_back(node);
         // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
-        {
-          paths.insert(paths.end(), visited.begin(), visited.end());
-        }
-        else
+        for( const auto & visitedit : visited )
         {
-          for( const auto & visitedit : visited )
+          if( pathHandles.insert(visitedit.handle()).second )
           {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
-            }
+            paths.push_back(visitedit);
           }
         }
         visited.pop_back();
@@ -269,48 +318,79 @@ namespace detail {
     for(const auto & node : nodes)
     {
       // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
+      if( visitedHandles.find(node.handle()) != visitedHandles.end() ||
           node == sink )
       {
         continue;
       }
       visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
+      visitedHandles.insert(node.handle());
+      findModelObjects(sink, visited, visitedHandles, paths, pathHandles, isDemandComponents);
+      visitedHandles.erase(node.handle());
       visited.pop_back();
     }
   }
 
-  std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
-                                                        HVACComponent outletComp,
-                                                        openstudio::IddObjectType type ) const
+  const std::vector<ModelObject> & Loop_Impl::cachedComponents(const HVACComponent & inletComp,
+                                                               const HVACComponent & outletComp,
+                                                               openstudio::IddObjectType type,
+                                                               bool isDemandComponents) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
+    checkCachedTopology();
 
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
+    ComponentPathMap & pathMap = isDemandComponents ? m_cachedDemandPaths : m_cachedSupplyPaths;
+
+    auto key = std::make_pair(inletComp.handle(), outletComp.handle());
+    auto it = pathMap.find(key);
+    if( it == pathMap.end() )
+    {
+      std::vector<HVACComponent> allPaths;
+
+      if( inletComp == outletComp ) {
+        allPaths.push_back(inletComp);
+      }
+      else {
+        std::vector<HVACComponent> visited;
+        visited.push_back(inletComp);
+        std::set<Handle> visitedHandles;
+        visitedHandles.insert(inletComp.handle());
+        std::set<Handle> pathHandles;
+        findModelObjects(outletComp, visited, visitedHandles, allPaths, pathHandles, isDemandComponents);
+      }
+
+      it = pathMap.insert(std::make_pair(key, ComponentPath())).first;
+      it->second.components = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
     }
-    std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
-    // Filter modelObjects for type
     if( type == IddObjectType::Catchall ) {
-      return _demandComponents;
+      return it->second.components;
     }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & demandComponent : _demandComponents)
+
+    // Filter modelObjects for type, once per type
+    auto typeIt = it->second.componentsByType.find(type.value());
+    if( typeIt == it->second.componentsByType.end() )
     {
-      if( type == demandComponent.iddObject().type() )
+      std::vector<ModelObject> reducedModelObjects;
+
+      for(const auto & component : it->second.components)
       {
-        reducedModelObjects.push_back(demandComponent);
+        if( type == component.iddObject().type() )
+        {
+          reducedModelObjects.push_back(component);
+        }
       }
+
+      typeIt = it->second.componentsByType.insert(std::make_pair(type.value(), reducedModelObjects)).first;
     }
 
-    return reducedModelObjects;
+    return typeIt->second;
+  }
+
+  std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
+                                                        HVACComponent outletComp,
+                                                        openstudio::IddObjectType type ) const
+  {
+    return cachedComponents(inletComp, outletComp, type, true);
   }
 
   std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const
@@ -343,33 +423,7 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
-    }
-    std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
-
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _supplyComponents;
-    }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & supplyComponent : _supplyComponents)
-    {
-      if( type == supplyComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(supplyComponent);
-      }
-    }
-
-    return reducedModelObjects;
+    return cachedComponents(inletComp, outletComp, type, false);
   }
 
   std::vector<ModelObject> Loop_Impl::components(HVACComponent inletComp,
@@ -22,6 +22,8 @@
 
 #include "ParentObject_Impl.hpp"
 
+#include <map>
+
 namespace openstudio {
 
 namespace model {
@@ -111,6 +113,10 @@ namespace detail {
 
     virtual Mixer demandMixer() = 0;
 
+  private slots:
+
+    void clearCachedTopology();
+
   private:
 
     REGISTER_LOGGER("openstudio.model.Loop");
@@ -121,6 +127,38 @@ namespace detail {
     boost::optional<ModelObject> demandInletNodeAsModelObject();
     boost::optional<ModelObject> demandOutletNodeAsModelObject();
 
+    // Components on the paths between an inlet and an outlet component, in traversal order,
+    // along with the same list filtered by IddObjectType value as those filters are requested.
+    struct ComponentPath {
+      std::vector<ModelObject> components;
+      std::map<int, std::vector<ModelObject> > componentsByType;
+    };
+
+    typedef std::map<std::pair<Handle, Handle>, ComponentPath> ComponentPathMap;
+
+    const std::vector<ModelObject> & cachedComponents(const HVACComponent & inletComp,
+                                                      const HVACComponent & outletComp,
+                                                      openstudio::IddObjectType type,
+                                                      bool isDemandComponents) const;
+
+    boost::optional<ModelObject> cachedComponent(const openstudio::Handle & handle, bool isDemandComponents) const;
+
+    // Clears the cache if the model topology changed since it was filled, even if no signal was emitted.
+    void checkCachedTopology() const;
+
+    void resetCachedTopology() const;
+
+    // The loop topology is derived from Connection objects and port fields, it is traversed once
+    // and cached here.  Any change to the model clears the cache, see clearCachedTopology, as does
+    // any connection or removal made while signals are blocked, see Model_Impl::topologyVersion.
+    mutable unsigned m_cachedTopologyVersion;
+    mutable ComponentPathMap m_cachedSupplyPaths;
+    mutable ComponentPathMap m_cachedDemandPaths;
+
+    // All components reachable from the inlet node without passing through the outlet node, by handle
+    mutable boost::optional<std::map<Handle, ModelObject> > m_cachedSupplyComponentMap;
+    mutable boost::optional<std::map<Handle, ModelObject> > m_cachedDemandComponentMap;
+
   };
 
 } // detail
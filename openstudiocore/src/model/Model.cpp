@@ -27,6 +27,9 @@
 #include "ModelObject_Impl.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
+#include "SqlResultIndex.hpp"
+#include "SpaceLoadInstance.hpp"
+#include "SpaceLoadInstance_Impl.hpp"
 
 // central list of all concrete ModelObject header files (_Impl and non-_Impl)
 // needed here for ::createObject
@@ -53,6 +56,7 @@
 #include "../utilities/sql/SqlFile.hpp"
 
 #include <boost/regex.hpp>
+#include <boost/filesystem/fstream.hpp>
 
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
@@ -64,15 +68,57 @@ namespace model {
 
 namespace detail {
 
+  namespace {
+
+    // types of the objects whose fields feed the people, lighting and equipment totals cached by Space_Impl,
+    // space type and plenum assignment included
+    bool isSpaceLoadsType(const IddObjectType& iddObjectType)
+    {
+      switch (iddObjectType.value()) {
+        case IddObjectType::OS_Space :
+        case IddObjectType::OS_SpaceType :
+        case IddObjectType::OS_Building :
+        case IddObjectType::OS_ThermalZone :
+        case IddObjectType::OS_AirLoopHVAC_SupplyPlenum :
+        case IddObjectType::OS_AirLoopHVAC_ReturnPlenum :
+        case IddObjectType::OS_People :
+        case IddObjectType::OS_People_Definition :
+        case IddObjectType::OS_Lights :
+        case IddObjectType::OS_Lights_Definition :
+        case IddObjectType::OS_Luminaire :
+        case IddObjectType::OS_Luminaire_Definition :
+        case IddObjectType::OS_ElectricEquipment :
+        case IddObjectType::OS_ElectricEquipment_Definition :
+        case IddObjectType::OS_GasEquipment :
+        case IddObjectType::OS_GasEquipment_Definition :
+          return true;
+        default:
+          return false;
+      }
+    }
+
+  }
+
   // default constructor
   Model_Impl::Model_Impl()
-    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
+    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio),
+      m_spaceLoadsTracked(false),
+      m_spaceLoadsVersion(0),
+      m_spaceAggregatesVersion(0),
+      m_numSpaceAggregateComputations(0),
+      m_topologyVersion(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    mf_trackSpaceAggregates();
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
-    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft))
+    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft)),
+      m_spaceLoadsTracked(false),
+      m_spaceLoadsVersion(0),
+      m_spaceAggregatesVersion(0),
+      m_numSpaceAggregateComputations(0),
+      m_topologyVersion(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -80,11 +126,17 @@ namespace detail {
           << "data schema. (Attempted construction from IdfFile with IddFileType "
           << idfFile.iddFileType().valueDescription() << ".)");
     }
+    mf_trackSpaceAggregates();
   }
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
                          bool keepHandles)
-    : openstudio::detail::Workspace_Impl(workspace,keepHandles)
+    : openstudio::detail::Workspace_Impl(workspace,keepHandles),
+      m_spaceLoadsTracked(false),
+      m_spaceLoadsVersion(0),
+      m_spaceAggregatesVersion(0),
+      m_numSpaceAggregateComputations(0),
+      m_topologyVersion(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -92,15 +144,23 @@ namespace detail {
         << "data schema. (Attempted construction from Workspace with IddFileType "
         << workspace.iddFileType().valueDescription() << ".)");
     }
+    mf_trackSpaceAggregates();
   }
 
   // copy constructor, used for clone
   Model_Impl::Model_Impl(const Model_Impl& other, bool keepHandles)
     : Workspace_Impl(other, keepHandles),
-      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile))
+      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
+      m_sqlResultIndex(other.m_sqlResultIndex),
+      m_spaceLoadsTracked(false),
+      m_spaceLoadsVersion(0),
+      m_spaceAggregatesVersion(0),
+      m_numSpaceAggregateComputations(0),
+      m_topologyVersion(0)
   {
     // notice we are cloning the sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    mf_trackSpaceAggregates();
   }
 
   // copy constructor used for cloneSubset
@@ -109,9 +169,16 @@ namespace detail {
                          bool keepHandles,
                          StrictnessLevel level)
     : Workspace_Impl(other,hs,keepHandles,level),
-      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile))
+      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
+      m_sqlResultIndex(other.m_sqlResultIndex),
+      m_spaceLoadsTracked(false),
+      m_spaceLoadsVersion(0),
+      m_spaceAggregatesVersion(0),
+      m_numSpaceAggregateComputations(0),
+      m_topologyVersion(0)
   {
     // notice we are cloning the sqlfile too, if necessary
+    mf_trackSpaceAggregates();
   }
   Workspace Model_Impl::clone(bool keepHandles) const {
     // copy everything but objects
@@ -150,6 +217,10 @@ namespace detail {
     m_sqlFile = otherImpl->m_sqlFile;
     otherImpl->m_sqlFile = tsf;
 
+    std::shared_ptr<SqlResultIndex> tsri = m_sqlResultIndex;
+    m_sqlResultIndex = otherImpl->m_sqlResultIndex;
+    otherImpl->m_sqlResultIndex = tsri;
+
     ComponentWatcherVector tcw = m_componentWatchers;
     m_componentWatchers = otherImpl->m_componentWatchers;
     otherImpl->m_componentWatchers = tcw;
@@ -161,6 +232,12 @@ namespace detail {
     OptionalLifeCycleCostParameters tclccp = m_cachedLifeCycleCostParameters;
     m_cachedLifeCycleCostParameters = otherImpl->m_cachedLifeCycleCostParameters;
     otherImpl->m_cachedLifeCycleCostParameters = tclccp;
+
+    // objects are connected to the Model_Impl they were in, reconnect them on next use
+    m_spaceLoadsTracked = false;
+    otherImpl->m_spaceLoadsTracked = false;
+    m_spaceLoadDependents.clear();
+    otherImpl->m_spaceLoadDependents.clear();
   }
 
   void Model_Impl::createComponentWatchers() {
@@ -981,11 +1058,68 @@ if (_className::iddObjectType() == typeToCreate) { \
     }
   }
 
+  std::shared_ptr<const SqlResultIndex> Model_Impl::sqlResultIndex() const
+  {
+    return m_sqlResultIndex;
+  }
+
+  unsigned Model_Impl::spaceLoadsVersion() const
+  {
+    if (!m_spaceLoadsTracked){
+      for (const WorkspaceObject& object : objects()){
+        if (isSpaceLoadsType(object.iddObject().type())){
+          QObject::connect(object.getImpl<WorkspaceObject_Impl>().get(), &WorkspaceObject_Impl::onChange,
+                           this, &Model_Impl::spaceLoadObjectChanged, Qt::UniqueConnection);
+        }
+      }
+      m_spaceLoadsTracked = true;
+
+      // anything cached before tracking started may be stale
+      ++m_spaceLoadsVersion;
+      ++m_spaceAggregatesVersion;
+      m_spaceLoadDependents.clear();
+    }
+    return m_spaceLoadsVersion;
+  }
+
+  void Model_Impl::setSpaceLoadDependencies(const Handle& space, const std::vector<Handle>& dependencies) const
+  {
+    for (const Handle& dependency : dependencies){
+      m_spaceLoadDependents[dependency].insert(space);
+    }
+  }
+
+  unsigned Model_Impl::spaceAggregatesVersion() const
+  {
+    spaceLoadsVersion();
+    return m_spaceAggregatesVersion;
+  }
+
+  unsigned Model_Impl::topologyVersion() const
+  {
+    return m_topologyVersion;
+  }
+
+  bool Model_Impl::removeObject(const Handle& handle)
+  {
+    ++m_topologyVersion;
+    return Workspace_Impl::removeObject(handle);
+  }
+
+  bool Model_Impl::removeObjects(const std::vector<Handle>& handles)
+  {
+    ++m_topologyVersion;
+    return Workspace_Impl::removeObjects(handles);
+  }
+
   /// set the sql file
   bool Model_Impl::setSqlFile(const openstudio::SqlFile& sqlFile)
   {
     bool result = true;
     m_sqlFile = std::shared_ptr<openstudio::SqlFile>(new openstudio::SqlFile(sqlFile));
+    m_sqlResultIndex = std::shared_ptr<SqlResultIndex>(new SqlResultIndex(sqlFile));
+    // conditioned floor area reads the results
+    ++m_spaceAggregatesVersion;
     return result;
   }
 
@@ -994,6 +1128,8 @@ if (_className::iddObjectType() == typeToCreate) { \
   {
     bool result = true;
     m_sqlFile.reset();
+    m_sqlResultIndex.reset();
+    ++m_spaceAggregatesVersion;
     return result;
   }
 
@@ -1062,6 +1198,8 @@ if (_className::iddObjectType() == typeToCreate) { \
                            ModelObject targetObject,
                            unsigned targetPort)
   {
+    ++m_topologyVersion;
+
     disconnect(sourceObject,sourcePort);
     disconnect(targetObject,targetPort);
 
@@ -1078,6 +1216,8 @@ if (_className::iddObjectType() == typeToCreate) { \
   void Model_Impl::disconnect(ModelObject object,
                               unsigned port)
   {
+    ++m_topologyVersion;
+
     if( boost::optional<HVACComponent> hvacComponent = object.optionalCast<HVACComponent>() )
     {
       std::shared_ptr<HVACComponent_Impl> hvacComponentImpl;
@@ -1232,6 +1372,109 @@ if (_className::iddObjectType() == typeToCreate) { \
   {
     m_cachedWeatherFile.reset();
   }
+
+  void Model_Impl::spaceLoadObjectChanged()
+  {
+    auto objectImpl = qobject_cast<WorkspaceObject_Impl*>(sender());
+    if (objectImpl && objectImpl->initialized()){
+      clearCachedSpaceLoads(objectImpl->getObject<WorkspaceObject>());
+    }
+  }
+
+  void Model_Impl::clearCachedSpaceLoads(const WorkspaceObject& object)
+  {
+    IddObjectType iddObjectType = object.iddObject().type();
+    if ((iddObjectType == IddObjectType::OS_Building) ||
+        (iddObjectType == IddObjectType::OS_AirLoopHVAC_SupplyPlenum) ||
+        (iddObjectType == IddObjectType::OS_AirLoopHVAC_ReturnPlenum))
+    {
+      // the building's space type and the plenums decide the space type of any space without one
+      ++m_spaceLoadsVersion;
+      m_spaceLoadDependents.clear();
+    }else{
+      clearSpaceLoadDependents(object.handle());
+
+      // a load instance also changes the totals of its parent's spaces, which may not have used it yet
+      if (boost::optional<SpaceLoadInstance> instance = object.optionalCast<SpaceLoadInstance>()){
+        if (OptionalSpace space = instance->space()){
+          clearSpaceLoadDependents(space->handle());
+        }
+        if (OptionalSpaceType spaceType = instance->spaceType()){
+          clearSpaceLoadDependents(spaceType->handle());
+        }
+      }
+    }
+    ++m_spaceAggregatesVersion;
+  }
+
+  void Model_Impl::clearSpaceLoadDependents(const Handle& handle)
+  {
+    auto it = m_spaceLoadDependents.find(handle);
+    if (it == m_spaceLoadDependents.end()){
+      return;
+    }
+
+    // spaces record their dependencies again when they recompute
+    std::set<Handle> spaces;
+    spaces.swap(it->second);
+    m_spaceLoadDependents.erase(it);
+    for (const Handle& spaceHandle : spaces){
+      if (OptionalWorkspaceObject object = getObject(spaceHandle)){
+        if (OptionalSpace space = object->optionalCast<Space>()){
+          space->getImpl<Space_Impl>()->clearCachedLoads();
+        }
+      }
+    }
+  }
+
+  void Model_Impl::clearCachedSpaceAggregates()
+  {
+    ++m_spaceAggregatesVersion;
+  }
+
+  unsigned Model_Impl::numSpaceAggregateComputations() const
+  {
+    return m_numSpaceAggregateComputations;
+  }
+
+  void Model_Impl::countSpaceAggregateComputation() const
+  {
+    ++m_numSpaceAggregateComputations;
+  }
+
+  void Model_Impl::spaceAggregateObjectAdded(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType)
+  {
+    if (iddObjectType == IddObjectType::OS_Surface){
+      // surface may be added with its space already set, e.g. when cloned or inserted from a component
+      if (OptionalSpace space = object.cast<Surface>().space()){
+        space->getImpl<Space_Impl>()->clearCachedGeometry();
+      }
+    }else if (m_spaceLoadsTracked && isSpaceLoadsType(iddObjectType)){
+      QObject::connect(object.getImpl<WorkspaceObject_Impl>().get(), &WorkspaceObject_Impl::onChange,
+                       this, &Model_Impl::spaceLoadObjectChanged, Qt::UniqueConnection);
+      clearCachedSpaceLoads(object);
+    }
+  }
+
+  void Model_Impl::spaceAggregateObjectRemoved(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType)
+  {
+    // called before the object is removed, so its relationships are still intact
+    if (iddObjectType == IddObjectType::OS_Surface){
+      if (OptionalSpace space = object.cast<Surface>().space()){
+        space->getImpl<Space_Impl>()->clearCachedGeometry();
+      }
+    }else if (m_spaceLoadsTracked && isSpaceLoadsType(iddObjectType)){
+      clearCachedSpaceLoads(object);
+    }
+  }
+
+  void Model_Impl::mf_trackSpaceAggregates()
+  {
+    QObject::connect(this, static_cast<void (Model_Impl::*)(const WorkspaceObject&, const openstudio::IddObjectType&, const openstudio::UUID&) const>(&Model_Impl::addWorkspaceObject),
+                     this, &Model_Impl::spaceAggregateObjectAdded);
+    QObject::connect(this, static_cast<void (Model_Impl::*)(const WorkspaceObject&, const openstudio::IddObjectType&, const openstudio::UUID&) const>(&Model_Impl::removeWorkspaceObject),
+                     this, &Model_Impl::spaceAggregateObjectRemoved);
+  }
 } // detail
 
 Model::Model()
@@ -1294,6 +1537,38 @@ boost::optional<Model> Model::load(const path& p) {
   return result;
 }
 
+boost::optional<Model> Model::loadBinary(const path& p) {
+  boost::filesystem::ifstream inFile(p, std::ios_base::in | std::ios_base::binary);
+  if (!inFile) {
+    LOG(Error,"Unable to open file at path '" << toString(p) << "'.");
+    return boost::none;
+  }
+  return loadBinary(inFile);
+}
+
+boost::optional<Model> Model::loadBinary(std::istream& is) {
+  IddFileType iddFileType(IddFileType::OpenStudio);
+  std::string iddVersion;
+  if (!openstudio::detail::Workspace_Impl::loadBinaryPreamble(is,iddFileType,iddVersion)) {
+    return boost::none;
+  }
+  if (iddFileType != IddFileType::OpenStudio) {
+    LOG(Error,"Models must be loaded from binary Workspaces saved with the OpenStudio Idd, "
+        << "not the " << iddFileType.valueDescription() << " Idd.");
+    return boost::none;
+  }
+
+  // objects are created through Model_Impl::createObject, so they are ModelObjects
+  std::shared_ptr<detail::Model_Impl> impl(new detail::Model_Impl());
+  if (!impl->loadBinaryObjects(is,iddVersion)) {
+    return boost::none;
+  }
+  Model result(impl);
+  // watch loaded components
+  impl->createComponentWatchers();
+  return result;
+}
+
 Model::Model(std::shared_ptr<detail::Model_Impl> p)
   : Workspace(p)
 {}
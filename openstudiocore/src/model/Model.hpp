@@ -325,6 +325,13 @@ class MODEL_API Model : public openstudio::Workspace {
   /** Load Model from file. */
   static boost::optional<Model> load(const path& p);
 
+  /** Load Model from a file saved with Workspace::saveBinary. Returns boost::none if p is not a
+   *  binary Workspace saved with the current version of the OpenStudio Idd. */
+  static boost::optional<Model> loadBinary(const path& p);
+
+  /** Load Model written with Workspace::saveBinary from is, which should be opened in binary mode. */
+  static boost::optional<Model> loadBinary(std::istream& is);
+
   /// Equality test, tests if this Model shares the same implementation object with other.
   bool operator==(const Model& other) const;
 
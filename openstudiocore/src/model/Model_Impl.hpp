@@ -34,6 +34,8 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
+#include <set>
 #include <vector>
 
 namespace openstudio {
@@ -60,6 +62,7 @@ class SpaceType;
 namespace detail {
 
   class ModelObject_Impl;
+  class SqlResultIndex;
 
   /** Container for the OpenStudio Building Model hierarchy. */
   class MODEL_API Model_Impl : public openstudio::detail::Workspace_Impl {
@@ -119,6 +122,22 @@ namespace detail {
     /// Get the sql file
     boost::optional<openstudio::SqlFile> sqlFile() const;
 
+    /** Get the index of tabular results loaded from the sql file, empty if there is no sql file. */
+    std::shared_ptr<const SqlResultIndex> sqlResultIndex() const;
+
+    /** Returns a counter that changes whenever the people, lighting and equipment totals cached by
+     *  every Space_Impl may have changed, i.e. when tracking starts or the Building or a plenum
+     *  changes. Other changes only clear the spaces recorded by setSpaceLoadDependencies. */
+    unsigned spaceLoadsVersion() const;
+
+    /** Records that the load totals cached by space were computed from the objects in dependencies,
+     *  so that Model_Impl clears them when one of those objects changes or is removed. */
+    void setSpaceLoadDependencies(const Handle& space, const std::vector<Handle>& dependencies) const;
+
+    /** Returns a counter that changes whenever any aggregate cached by Space_Impl may have changed.
+     *  Building_Impl uses it to validate its cached totals. */
+    unsigned spaceAggregatesVersion() const;
+
     /** Get the Building object if there is one, this implementation uses a cached reference to the Building
      *  object which can be significantly faster than calling getOptionalUniqueModelObject<Building>(). */
     boost::optional<Building> building() const;
@@ -193,6 +212,26 @@ namespace detail {
 
     void disconnect(ModelObject object, unsigned port);
 
+    /** Called by Space_Impl when the geometry of one of its surfaces changes. */
+    void clearCachedSpaceAggregates();
+
+    /** Returns the number of Space and Building aggregates computed rather than read from their
+     *  caches. */
+    unsigned numSpaceAggregateComputations() const;
+
+    /** Called by Space_Impl and Building_Impl each time they compute a cached aggregate. */
+    void countSpaceAggregateComputation() const;
+
+    /** Incremented whenever objects are removed or ports are connected or disconnected,
+     *  including while signals are blocked. Loop_Impl compares it before using its cached topology. */
+    unsigned topologyVersion() const;
+
+    /** Override to increment topologyVersion. */
+    virtual bool removeObject(const Handle& handle);
+
+    /** Override to increment topologyVersion. */
+    virtual bool removeObjects(const std::vector<Handle>& handles);
+
    public slots :
 
     virtual void obsoleteComponentWatcher(const ComponentWatcher& watcher);
@@ -220,10 +259,20 @@ namespace detail {
     // Make this a shared_ptr to avoid having to #include SqlFile.hpp in all Model objects
     std::shared_ptr<openstudio::SqlFile> m_sqlFile;
 
+    // built from m_sqlFile when it is set, never modified afterwards so clones may share it
+    std::shared_ptr<SqlResultIndex> m_sqlResultIndex;
+
     std::vector<ComponentWatcher> m_componentWatchers;
 
     void mf_createComponentWatcher(ComponentData& componentData);
 
+    void mf_trackSpaceAggregates();
+
+    // clears the load totals of the spaces that depend on object, or of all spaces
+    void clearCachedSpaceLoads(const WorkspaceObject& object);
+
+    void clearSpaceLoadDependents(const Handle& handle);
+
   private:
 
     mutable boost::optional<Building> m_cachedBuilding;
@@ -232,6 +281,17 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    // objects feeding the Space load totals are only connected once spaceLoadsVersion is first called
+    mutable bool m_spaceLoadsTracked;
+    mutable unsigned m_spaceLoadsVersion;
+    // spaces whose cached load totals were computed from each object, see setSpaceLoadDependencies
+    mutable std::map<Handle, std::set<Handle> > m_spaceLoadDependents;
+    mutable unsigned m_spaceAggregatesVersion;
+    mutable unsigned m_numSpaceAggregateComputations;
+
+    // not tied to signals, ThermalZone_Impl::remove and others edit loops with signals blocked
+    unsigned m_topologyVersion;
+
   private slots:
 
     void clearCachedBuilding();
@@ -239,6 +299,9 @@ namespace detail {
     void clearCachedRunPeriod();
     void clearCachedYearDescription();
     void clearCachedWeatherFile();
+    void spaceLoadObjectChanged();
+    void spaceAggregateObjectAdded(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType);
+    void spaceAggregateObjectRemoved(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType);
 
   };
 
@@ -20,6 +20,7 @@
 #include "PlanarSurface.hpp"
 #include "PlanarSurface_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "PlanarSurfaceGroup.hpp"
 #include "Space.hpp"
@@ -33,6 +34,7 @@
 #include "AirWallMaterial_Impl.hpp"
 #include "SubSurface.hpp"
 #include "SubSurface_Impl.hpp"
+#include "SqlResultIndex.hpp"
 
 #include "../utilities/sql/SqlFile.hpp"
 
@@ -403,7 +405,7 @@ namespace model {
     boost::optional<double> PlanarSurface_Impl::visibleTransmittance() const
     {
       OptionalDouble result;
-      OptionalSqlFile sqlFile = model().sqlFile();
+      std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
       OptionalConstructionBase oConstruction = this->construction();
 
       if (oConstruction) {
@@ -412,26 +414,16 @@ namespace model {
 
         // from output
         OptionalDouble outputResult;
-        if (sqlFile) {
+        if (sqlResults) {
           OptionalString constructionName = oConstruction->name();
           if (constructionName){
-            std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-            OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+            OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", "Construction", to_upper_copy(*constructionName));
             if (rowId) {
-              std::stringstream ss;
-              ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Exterior Fenestration' AND RowId='";
-              ss << *rowId << "' AND ColumnName='Glass Visible Transmittance'";
-              query = ss.str();
-              outputResult = sqlFile->execAndReturnFirstDouble(query);
+              outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowId, "Glass Visible Transmittance");
             }else{
-              query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Interior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-              rowId = sqlFile->execAndReturnFirstInt(query);
+              rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Interior Fenestration", "Construction", to_upper_copy(*constructionName));
               if (rowId) {
-                std::stringstream ss;
-                ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Interior Fenestration' AND RowId='";
-                ss << *rowId << "' AND ColumnName='Glass Visible Transmittance'";
-                query = ss.str();
-                outputResult = sqlFile->execAndReturnFirstDouble(query);
+                outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Interior Fenestration", *rowId, "Glass Visible Transmittance");
               }
             }
 
@@ -32,12 +32,85 @@
 #include "../utilities/units/ScaleFactory.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/data/Vector.hpp"
+#include "../utilities/time/Time.hpp"
+
+#include <QtConcurrentMap>
+
+#include <numeric>
 
 namespace openstudio {
 namespace model {
 
 namespace detail {
 
+  // evaluate one day profile at the given fractions of a day, consistent with ScheduleDay_Impl::getValue
+  static std::vector<double> evaluateDayProfile(const DayProfileData& profile, const Vector& xi)
+  {
+    unsigned N = profile.untilDays.size();
+    OS_ASSERT(profile.values.size() == N);
+
+    if (N == 0){
+      return std::vector<double>(xi.size(), 0.0);
+    }
+
+    openstudio::Vector x(N + 2);
+    openstudio::Vector y(N + 2);
+
+    x[0] = -0.000001;
+    y[0] = 0.0;
+
+    for (unsigned i = 0; i < N; ++i){
+      x[i + 1] = profile.untilDays[i];
+      y[i + 1] = profile.values[i];
+    }
+
+    x[N + 1] = 1.000001;
+    y[N + 1] = 0.0;
+
+    InterpMethod interpMethod;
+    if (profile.interpolate){
+      interpMethod = LinearInterp;
+    }else{
+      interpMethod = HoldNextInterp;
+    }
+
+    Vector yi = interp(x, y, xi, interpMethod, NoneExtrap);
+    return std::vector<double>(yi.begin(), yi.end());
+  }
+
+  std::vector<double> evaluateAnnualProfile(const AnnualProfileData& data, const openstudio::Time& timestep)
+  {
+    std::vector<double> result;
+
+    int secondsPerStep = timestep.totalSeconds();
+    if (secondsPerStep <= 0 || secondsPerStep > 86400 || (86400 % secondsPerStep) != 0){
+      return result;
+    }
+
+    unsigned numStepsPerDay = 86400 / secondsPerStep;
+
+    // end of each timestep, computed as Time does so values match ScheduleDay_Impl::getValue exactly
+    Vector xi(numStepsPerDay);
+    for (unsigned i = 0; i < numStepsPerDay; ++i){
+      xi[i] = openstudio::Time(0, 0, 0, (i + 1) * secondsPerStep).totalDays();
+    }
+
+    std::vector<std::vector<double> > dayValues;
+    dayValues.reserve(data.dayProfiles.size());
+    for (const DayProfileData& profile : data.dayProfiles){
+      dayValues.push_back(evaluateDayProfile(profile, xi));
+    }
+
+    result.reserve(data.dayProfileIndices.size() * numStepsPerDay);
+    for (unsigned index : data.dayProfileIndices){
+      OS_ASSERT(index < dayValues.size());
+      result.insert(result.end(), dayValues[index].begin(), dayValues[index].end());
+    }
+
+    return result;
+  }
+
   // constructor
   ScheduleBase_Impl::ScheduleBase_Impl(const IdfObject& idfObject,
                                        Model_Impl* model,
@@ -74,6 +147,17 @@ namespace detail {
     return result;
   }
 
+  boost::optional<AnnualProfileData> ScheduleBase_Impl::annualProfileData() const {
+    return boost::none;
+  }
+
+  std::vector<double> ScheduleBase_Impl::annualValues(const openstudio::Time& timestep) const {
+    if (boost::optional<AnnualProfileData> data = annualProfileData()) {
+      return evaluateAnnualProfile(*data, timestep);
+    }
+    return std::vector<double>();
+  }
+
   boost::optional<Quantity> ScheduleBase_Impl::toQuantity(double value, bool returnIP) const {
     OptionalQuantity result;
     if (OptionalScheduleTypeLimits scheduleTypeLimits = this->scheduleTypeLimits()) {
@@ -193,6 +277,10 @@ boost::optional<ScheduleTypeLimits> ScheduleBase::scheduleTypeLimits() const {
   return getImpl<detail::ScheduleBase_Impl>()->scheduleTypeLimits();
 }
 
+std::vector<double> ScheduleBase::annualValues(const openstudio::Time& timestep) const {
+  return getImpl<detail::ScheduleBase_Impl>()->annualValues(timestep);
+}
+
 bool ScheduleBase::setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits) {
   return getImpl<detail::ScheduleBase_Impl>()->setScheduleTypeLimits(scheduleTypeLimits);
 }
@@ -216,6 +304,29 @@ ScheduleBase::ScheduleBase(IddObjectType type, const Model &model)
 {}
 /// @endcond
 
+std::vector<std::vector<double> > annualValues(const std::vector<ScheduleBase>& schedules,
+                                               const openstudio::Time& timestep)
+{
+  // the model is not thread safe, read all day patterns up front
+  std::vector<boost::optional<detail::AnnualProfileData> > data;
+  data.reserve(schedules.size());
+  for (const ScheduleBase& schedule : schedules){
+    data.push_back(schedule.getImpl<detail::ScheduleBase_Impl>()->annualProfileData());
+  }
+
+  std::vector<std::vector<double> > result(schedules.size());
+  std::vector<unsigned> indices(schedules.size());
+  std::iota(indices.begin(), indices.end(), 0u);
+
+  QtConcurrent::blockingMap(indices, [&data, &result, &timestep](unsigned i){
+    if (data[i]){
+      result[i] = detail::evaluateAnnualProfile(*data[i], timestep);
+    }
+  });
+
+  return result;
+}
+
 } // model
 } // openstudio
 
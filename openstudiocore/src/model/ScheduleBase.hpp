@@ -24,6 +24,9 @@
 #include "ResourceObject.hpp"
 
 namespace openstudio {
+
+class Time;
+
 namespace model {
 
 class ScheduleTypeLimits;
@@ -54,6 +57,13 @@ class MODEL_API ScheduleBase : public ResourceObject {
   /** Returns the ScheduleTypeLimits of this object, if set. */
   boost::optional<ScheduleTypeLimits> scheduleTypeLimits() const;
 
+  /** Returns the value of this schedule at the end of each timestep of the year, packed into a
+   *  single vector with (days in year) * (timesteps per day) entries. Each distinct day profile 
+   *  is evaluated once and reused. Values match ScheduleDay::getValue at the same times. Returns
+   *  an empty vector if timestep does not evenly divide a day, or if this type of schedule does
+   *  not support annual evaluation (currently ScheduleRuleset and ScheduleConstant do). */
+  std::vector<double> annualValues(const openstudio::Time& timestep) const;
+
   //@}
   /** @name Setters */
   //@{
@@ -99,6 +109,11 @@ typedef boost::optional<ScheduleBase> OptionalScheduleBase;
 /** \relates ScheduleBase*/
 typedef std::vector<ScheduleBase> ScheduleBaseVector;
 
+/** Returns ScheduleBase::annualValues for each schedule. Day patterns are read from the Model 
+ *  serially, the numeric evaluation then runs concurrently across schedules. \relates ScheduleBase */
+MODEL_API std::vector<std::vector<double> > annualValues(const std::vector<ScheduleBase>& schedules,
+                                                         const openstudio::Time& timestep);
+
 } // model
 } // openstudio
 
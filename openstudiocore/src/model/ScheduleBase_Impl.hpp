@@ -26,6 +26,7 @@
 namespace openstudio {
 
 class OSQuantityVector;
+class Time;
 
 namespace model {
 
@@ -33,6 +34,26 @@ class ScheduleTypeLimits;
 
 namespace detail {
 
+  /** Plain copy of the times and values of a ScheduleDay, captured so that the day can be
+   *  evaluated without touching the Model (for instance, from a worker thread). */
+  struct MODEL_API DayProfileData {
+    std::vector<double> untilDays; // until times as fractions of a day, sorted
+    std::vector<double> values;
+    bool interpolate;
+  };
+
+  /** Plain copy of the day pattern of a schedule over one year. dayProfileIndices has one entry 
+   *  per day of the year, each of which indexes into dayProfiles. */
+  struct MODEL_API AnnualProfileData {
+    std::vector<DayProfileData> dayProfiles;
+    std::vector<unsigned> dayProfileIndices;
+  };
+
+  /** Evaluates data at the end of each timestep of the year. Each distinct day profile is only
+   *  evaluated once. Returns an empty vector if timestep does not evenly divide a day. */
+  MODEL_API std::vector<double> evaluateAnnualProfile(const AnnualProfileData& data, 
+                                                      const openstudio::Time& timestep);
+
   /** ScheduleBase_Impl is a ResourceObject_Impl that is the implementation class for ScheduleBase.*/
   class MODEL_API ScheduleBase_Impl : public ResourceObject_Impl {
     Q_OBJECT;
@@ -65,6 +86,12 @@ namespace detail {
 
     OSQuantityVector getValues(bool returnIP=false) const;
 
+    /** Captures the day pattern of this schedule over one year. Returns boost::none if this 
+     *  type of schedule does not support annual evaluation. */
+    virtual boost::optional<AnnualProfileData> annualProfileData() const;
+
+    std::vector<double> annualValues(const openstudio::Time& timestep) const;
+
     //@}
     /** @name Setters */
     //@{
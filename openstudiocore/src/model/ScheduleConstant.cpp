@@ -20,6 +20,8 @@
 #include "ScheduleConstant.hpp"
 #include "ScheduleConstant_Impl.hpp"
 #include "Model.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
@@ -99,6 +101,25 @@ namespace detail {
     return DoubleVector(1u,value());
   }
 
+  boost::optional<AnnualProfileData> ScheduleConstant_Impl::annualProfileData() const {
+    unsigned numDays = 365;
+    if (boost::optional<YearDescription> yd = model().getOptionalUniqueModelObject<YearDescription>()){
+      if (yd->isLeapYear()){
+        numDays = 366;
+      }
+    }
+
+    DayProfileData profile;
+    profile.untilDays.push_back(1.0);
+    profile.values.push_back(value());
+    profile.interpolate = false;
+
+    AnnualProfileData result;
+    result.dayProfiles.push_back(profile);
+    result.dayProfileIndices = std::vector<unsigned>(numDays, 0u);
+    return result;
+  }
+
   double ScheduleConstant_Impl::value() const {
     boost::optional<double> result = getDouble(OS_Schedule_ConstantFields::Value, true);
     if(!result){
@@ -72,6 +72,8 @@ namespace detail {
 
     virtual std::vector<double> values() const;
 
+    virtual boost::optional<AnnualProfileData> annualProfileData() const;
+
     //@}
     /** @name Getters */
     //@{
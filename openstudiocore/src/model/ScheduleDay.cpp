@@ -242,6 +242,17 @@ namespace detail {
     return result;
   }
 
+  DayProfileData ScheduleDay_Impl::dayProfileData() const
+  {
+    DayProfileData result;
+    for (const openstudio::Time& time : this->times()){
+      result.untilDays.push_back(time.totalDays());
+    }
+    result.values = this->values();
+    result.interpolate = this->interpolatetoTimestep();
+    return result;
+  }
+
   boost::optional<Quantity> ScheduleDay_Impl::getValueAsQuantity(const openstudio::Time& time, bool returnIP) const {
     return toQuantity(getValue(time),returnIP);
   }
@@ -91,6 +91,9 @@ namespace detail {
     /// Returns the value in effect at the given time.  If time is less than 0 days or greater than 1 day, 0 is returned.
     double getValue(const openstudio::Time& time) const;
 
+    /// Returns a copy of times and values that can be evaluated without the Model.
+    DayProfileData dayProfileData() const;
+
     boost::optional<Quantity> getValueAsQuantity(const openstudio::Time& time, bool returnIP=false) const;
 
     //@}
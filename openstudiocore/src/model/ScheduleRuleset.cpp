@@ -465,6 +465,37 @@ namespace detail {
     return result;
   }
 
+  boost::optional<AnnualProfileData> ScheduleRuleset_Impl::annualProfileData() const
+  {
+    openstudio::Date jan1(MonthOfYear::Jan, 1);
+    openstudio::Date dec31(MonthOfYear::Dec, 31);
+    if (boost::optional<YearDescription> yd = this->model().getOptionalUniqueModelObject<YearDescription>()){
+      jan1 = yd->makeDate(MonthOfYear::Jan, 1);
+      dec31 = yd->makeDate(MonthOfYear::Dec, 31);
+    }
+
+    ScheduleDay defaultDaySchedule = this->defaultDaySchedule();
+    std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
+    std::vector<int> activeRuleIndices = this->getActiveRuleIndices(jan1, dec31);
+
+    AnnualProfileData result;
+    result.dayProfileIndices.reserve(activeRuleIndices.size());
+
+    // map from active rule index (-1 for default) to index in dayProfiles
+    std::map<int, unsigned> profileIndices;
+    for (int i : activeRuleIndices){
+      auto it = profileIndices.find(i);
+      if (it == profileIndices.end()){
+        ScheduleDay daySchedule = (i == -1) ? defaultDaySchedule : scheduleRules[i].daySchedule();
+        it = profileIndices.insert(std::make_pair(i, static_cast<unsigned>(result.dayProfiles.size()))).first;
+        result.dayProfiles.push_back(daySchedule.getImpl<ScheduleDay_Impl>()->dayProfileData());
+      }
+      result.dayProfileIndices.push_back(it->second);
+    }
+
+    return result;
+  }
+
   bool ScheduleRuleset_Impl::moveToEnd(ScheduleRule& scheduleRule)
   {
     std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
@@ -73,6 +73,10 @@ namespace detail {
      *  bounds. */
     virtual std::vector<double> values() const;
 
+    /** Resolves the active rule once per day of the year and captures each distinct ScheduleDay
+     *  once. */
+    virtual boost::optional<AnnualProfileData> annualProfileData() const;
+
     virtual bool setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits);
 
     virtual bool resetScheduleTypeLimits();
@@ -68,6 +68,10 @@
 #include "Luminaire_Impl.hpp"
 #include "LuminaireDefinition.hpp"
 #include "LuminaireDefinition_Impl.hpp"
+#include "SpaceLoadInstance.hpp"
+#include "SpaceLoadInstance_Impl.hpp"
+#include "SpaceLoadDefinition.hpp"
+#include "SpaceLoadDefinition_Impl.hpp"
 #include "ElectricEquipment.hpp"
 #include "ElectricEquipment_Impl.hpp"
 #include "ElectricEquipmentDefinition.hpp"
@@ -128,7 +132,8 @@ namespace model {
 namespace detail {
 
   Space_Impl::Space_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-    : PlanarSurfaceGroup_Impl(idfObject,model,keepHandle)
+    : PlanarSurfaceGroup_Impl(idfObject,model,keepHandle),
+      m_cachedLoadsVersion(0)
   {
     OS_ASSERT(idfObject.iddObject().type() == Space::iddObjectType());
   }
@@ -136,7 +141,8 @@ namespace detail {
   Space_Impl::Space_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
                          Model_Impl* model,
                          bool keepHandle)
-    : PlanarSurfaceGroup_Impl(other,model,keepHandle)
+    : PlanarSurfaceGroup_Impl(other,model,keepHandle),
+      m_cachedLoadsVersion(0)
   {
     OS_ASSERT(other.iddObject().type() == Space::iddObjectType());
   }
@@ -144,7 +150,8 @@ namespace detail {
   Space_Impl::Space_Impl(const Space_Impl& other,
                          Model_Impl* model,
                          bool keepHandle)
-    : PlanarSurfaceGroup_Impl(other,model,keepHandle)
+    : PlanarSurfaceGroup_Impl(other,model,keepHandle),
+      m_cachedLoadsVersion(0)
   {}
 
  boost::optional<ParentObject> Space_Impl::parent() const
@@ -869,6 +876,10 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
+    if (m_cachedFloorArea){
+      return m_cachedFloorArea.get();
+    }
+
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.surfaceType(), "Floor"))
@@ -876,10 +887,16 @@ namespace detail {
         result += surface.grossArea();
       }
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedFloorArea = result;
     return result;
   }
 
   double Space_Impl::exteriorArea() const {
+    if (m_cachedExteriorArea){
+      return m_cachedExteriorArea.get();
+    }
+
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
@@ -887,10 +904,16 @@ namespace detail {
         result += surface.grossArea();
       }
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedExteriorArea = result;
     return result;
   }
 
   double Space_Impl::exteriorWallArea() const {
+    if (m_cachedExteriorWallArea){
+      return m_cachedExteriorWallArea.get();
+    }
+
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
@@ -901,10 +924,16 @@ namespace detail {
         }
       }
     }
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedExteriorWallArea = result;
     return result;
   }
 
   double Space_Impl::volume() const {
+    if (m_cachedVolume){
+      return m_cachedVolume.get();
+    }
+
     double result = 0;
 
     // TODO: need a better method
@@ -932,10 +961,17 @@ namespace detail {
       result = (roofHeight - floorHeight) * this->floorArea();
     }
 
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedVolume = result;
     return result;
   }
 
   double Space_Impl::numberOfPeople() const {
+    checkCachedLoads();
+    if (m_cachedNumberOfPeople){
+      return m_cachedNumberOfPeople.get();
+    }
+
     double result = 0.0;
     double area = floorArea();
 
@@ -949,6 +985,8 @@ namespace detail {
       }
     }
 
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedNumberOfPeople = result;
     return result;
   }
 
@@ -1157,6 +1195,11 @@ namespace detail {
   }
 
   double Space_Impl::lightingPower() const {
+    checkCachedLoads();
+    if (m_cachedLightingPower){
+      return m_cachedLightingPower.get();
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1177,6 +1220,8 @@ namespace detail {
       }
     }
 
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedLightingPower = result;
     return result;
   }
 
@@ -1438,6 +1483,11 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPower() const {
+    checkCachedLoads();
+    if (m_cachedElectricEquipmentPower){
+      return m_cachedElectricEquipmentPower.get();
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1452,6 +1502,8 @@ namespace detail {
       }
     }
 
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedElectricEquipmentPower = result;
     return result;
   }
 
@@ -1683,6 +1735,11 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPower() const {
+    checkCachedLoads();
+    if (m_cachedGasEquipmentPower){
+      return m_cachedGasEquipmentPower.get();
+    }
+
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1697,6 +1754,8 @@ namespace detail {
       }
     }
 
+    model().getImpl<Model_Impl>()->countSpaceAggregateComputation();
+    m_cachedGasEquipmentPower = result;
     return result;
   }
 
@@ -2847,6 +2906,76 @@ namespace detail {
     }
     return result;
   }
+
+  void Space_Impl::clearCachedGeometry()
+  {
+    m_cachedFloorArea.reset();
+    m_cachedExteriorArea.reset();
+    m_cachedExteriorWallArea.reset();
+    m_cachedVolume.reset();
+
+    // load totals scale with floor area
+    clearCachedLoads();
+
+    model().getImpl<Model_Impl>()->clearCachedSpaceAggregates();
+  }
+
+  void Space_Impl::clearCachedLoads()
+  {
+    m_cachedLoadsVersion = 0;
+  }
+
+  void Space_Impl::checkCachedLoads() const
+  {
+    // read the version before computing, anything the computation creates invalidates the results
+    unsigned version = model().getImpl<Model_Impl>()->spaceLoadsVersion();
+    if (version != m_cachedLoadsVersion){
+      m_cachedNumberOfPeople.reset();
+      m_cachedLightingPower.reset();
+      m_cachedElectricEquipmentPower.reset();
+      m_cachedGasEquipmentPower.reset();
+      m_cachedLoadsVersion = version;
+      model().getImpl<Model_Impl>()->setSpaceLoadDependencies(handle(), loadDependencies());
+    }
+  }
+
+  std::vector<Handle> Space_Impl::loadDependencies() const
+  {
+    std::vector<Handle> result;
+    result.push_back(handle());
+
+    // without its own space type, isPlenum decides between the building's and the plenum space type
+    if (!getObject<ModelObject>().getModelObjectTarget<SpaceType>(OS_SpaceFields::SpaceTypeName)){
+      if (boost::optional<ThermalZone> thermalZone = this->thermalZone()){
+        result.push_back(thermalZone->handle());
+      }
+    }
+
+    std::vector<SpaceLoadInstance> instances;
+    auto addInstances = [&instances](const std::vector<SpaceLoadInstance>& other){
+      instances.insert(instances.end(), other.begin(), other.end());
+    };
+    addInstances(castVector<SpaceLoadInstance>(people()));
+    addInstances(castVector<SpaceLoadInstance>(lights()));
+    addInstances(castVector<SpaceLoadInstance>(luminaires()));
+    addInstances(castVector<SpaceLoadInstance>(electricEquipment()));
+    addInstances(castVector<SpaceLoadInstance>(gasEquipment()));
+    if (boost::optional<SpaceType> spaceType = this->spaceType()){
+      result.push_back(spaceType->handle());
+      addInstances(castVector<SpaceLoadInstance>(spaceType->people()));
+      addInstances(castVector<SpaceLoadInstance>(spaceType->lights()));
+      addInstances(castVector<SpaceLoadInstance>(spaceType->luminaires()));
+      addInstances(castVector<SpaceLoadInstance>(spaceType->electricEquipment()));
+      addInstances(castVector<SpaceLoadInstance>(spaceType->gasEquipment()));
+    }
+
+    for (const SpaceLoadInstance& instance : instances){
+      result.push_back(instance.handle());
+      result.push_back(instance.definition().handle());
+    }
+
+    return result;
+  }
   
   // helper function to get a boost polygon point from a Point3d
   boost::tuple<double, double> Space_Impl::point3dToTuple(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) const
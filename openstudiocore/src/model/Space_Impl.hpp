@@ -522,9 +522,35 @@ namespace detail {
 
     bool isPlenum() const;
 
+    /** Clears the floor area, volume and other aggregates cached from this space's surfaces, along
+     *  with the load totals that depend on them. Called when one of those surfaces changes. */
+    void clearCachedGeometry();
+
+    /** Clears the people, lighting and equipment totals cached by this space. Called by Model_Impl
+     *  when one of the objects they were computed from changes. */
+    void clearCachedLoads();
+
    private:
     REGISTER_LOGGER("openstudio.model.Space");
 
+    // cleared by clearCachedGeometry
+    mutable boost::optional<double> m_cachedFloorArea;
+    mutable boost::optional<double> m_cachedExteriorArea;
+    mutable boost::optional<double> m_cachedExteriorWallArea;
+    mutable boost::optional<double> m_cachedVolume;
+
+    // valid while m_cachedLoadsVersion matches Model_Impl::spaceLoadsVersion, zero once cleared
+    mutable unsigned m_cachedLoadsVersion;
+    mutable boost::optional<double> m_cachedNumberOfPeople;
+    mutable boost::optional<double> m_cachedLightingPower;
+    mutable boost::optional<double> m_cachedElectricEquipmentPower;
+    mutable boost::optional<double> m_cachedGasEquipmentPower;
+
+    void checkCachedLoads() const;
+
+    // this space and the zone, instances and definitions its load totals are computed from
+    std::vector<Handle> loadDependencies() const;
+
     openstudio::Quantity directionofRelativeNorth_SI() const;
     openstudio::Quantity directionofRelativeNorth_IP() const;
     bool setDirectionofRelativeNorth(const Quantity& directionofRelativeNorth);   
@@ -0,0 +1,199 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include "SqlResultIndex.hpp"
+
+#include "../utilities/sql/SqlFile.hpp"
+
+#include <cstdlib>
+
+namespace openstudio {
+namespace model {
+
+namespace detail {
+
+  namespace {
+
+    // same conversion sqlite applies when a text Value is read as a double
+    double toDouble(const std::string& value) {
+      return std::strtod(value.c_str(), nullptr);
+    }
+
+  }
+
+  SqlResultIndex::SqlResultIndex(const SqlFile& sqlFile)
+  {
+    if (sqlFile.connectionOpen()) {
+      m_hoursSimulated = sqlFile.hoursSimulated();
+    }
+
+    for (const TableKey& tableKey : indexedTables()) {
+      std::string query = "SELECT RowName, ColumnName, Units, Value, RowId FROM tabulardatawithstrings WHERE ReportName='" +
+          std::get<0>(tableKey) + "' AND ReportForString='" + std::get<1>(tableKey) + "' AND TableName='" + 
+          std::get<2>(tableKey) + "'";
+      boost::optional<std::vector<std::vector<std::string> > > rows = sqlFile.execAndReturnVectorOfRows(query);
+      if (!rows) {
+        continue;
+      }
+
+      // insert keeps the first row for each key, matching the first result of a single-value query
+      Table& table = m_tables[tableKey];
+      for (const std::vector<std::string>& row : *rows) {
+        const std::string& rowName = row[0];
+        const std::string& columnName = row[1];
+        const std::string& units = row[2];
+        const std::string& value = row[3];
+        int rowId = std::atoi(row[4].c_str());
+        table.valuesByRowName.insert(std::make_pair(std::make_pair(rowName, columnName), value));
+        table.valuesByRowNameAndUnits.insert(std::make_pair(std::make_tuple(rowName, columnName, units), value));
+        table.valuesByRowId.insert(std::make_pair(std::make_pair(rowId, columnName), value));
+        table.valuesByRowIdAndUnits.insert(std::make_pair(std::make_tuple(rowId, columnName, units), value));
+        table.rowIdsByValue.insert(std::make_pair(std::make_pair(columnName, value), rowId));
+      }
+      LOG(Debug, "Indexed " << rows->size() << " values of " << std::get<0>(tableKey) << " table '" << std::get<2>(tableKey) << "'");
+    }
+  }
+
+  std::vector<std::tuple<std::string, std::string, std::string> > SqlResultIndex::indexedTables()
+  {
+    std::vector<TableKey> result;
+    result.push_back(TableKey("EnvelopeSummary", "Entire Facility", "Opaque Exterior"));
+    result.push_back(TableKey("EnvelopeSummary", "Entire Facility", "Exterior Fenestration"));
+    result.push_back(TableKey("EnvelopeSummary", "Entire Facility", "Interior Fenestration"));
+    result.push_back(TableKey("InputVerificationandResultsSummary", "Entire Facility", "Zone Summary"));
+    result.push_back(TableKey("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy"));
+    result.push_back(TableKey("Economics Results Summary Report", "Entire Facility", "Annual Cost"));
+    return result;
+  }
+
+  boost::optional<std::string> SqlResultIndex::value(const std::string& reportName,
+                                                     const std::string& reportForString,
+                                                     const std::string& tableName,
+                                                     const std::string& rowName,
+                                                     const std::string& columnName) const
+  {
+    boost::optional<std::string> result;
+    if (const Table* t = table(reportName, reportForString, tableName)) {
+      auto it = t->valuesByRowName.find(std::make_pair(rowName, columnName));
+      if (it != t->valuesByRowName.end()) {
+        result = it->second;
+      }
+    }
+    return result;
+  }
+
+  boost::optional<int> SqlResultIndex::rowId(const std::string& reportName,
+                                             const std::string& reportForString,
+                                             const std::string& tableName,
+                                             const std::string& columnName,
+                                             const std::string& value) const
+  {
+    boost::optional<int> result;
+    if (const Table* t = table(reportName, reportForString, tableName)) {
+      auto it = t->rowIdsByValue.find(std::make_pair(columnName, value));
+      if (it != t->rowIdsByValue.end()) {
+        result = it->second;
+      }
+    }
+    return result;
+  }
+
+  boost::optional<double> SqlResultIndex::doubleValue(const std::string& reportName,
+                                                      const std::string& reportForString,
+                                                      const std::string& tableName,
+                                                      int rowId,
+                                                      const std::string& columnName) const
+  {
+    boost::optional<double> result;
+    if (const Table* t = table(reportName, reportForString, tableName)) {
+      auto it = t->valuesByRowId.find(std::make_pair(rowId, columnName));
+      if (it != t->valuesByRowId.end()) {
+        result = toDouble(it->second);
+      }
+    }
+    return result;
+  }
+
+  boost::optional<double> SqlResultIndex::doubleValue(const std::string& reportName,
+                                                      const std::string& reportForString,
+                                                      const std::string& tableName,
+                                                      int rowId,
+                                                      const std::string& columnName,
+                                                      const std::string& units) const
+  {
+    boost::optional<double> result;
+    if (const Table* t = table(reportName, reportForString, tableName)) {
+      auto it = t->valuesByRowIdAndUnits.find(std::make_tuple(rowId, columnName, units));
+      if (it != t->valuesByRowIdAndUnits.end()) {
+        result = toDouble(it->second);
+      }
+    }
+    return result;
+  }
+
+  boost::optional<double> SqlResultIndex::doubleValue(const std::string& reportName,
+                                                      const std::string& reportForString,
+                                                      const std::string& tableName,
+                                                      const std::string& rowName,
+                                                      const std::string& columnName) const
+  {
+    boost::optional<double> result;
+    if (boost::optional<std::string> v = value(reportName, reportForString, tableName, rowName, columnName)) {
+      result = toDouble(*v);
+    }
+    return result;
+  }
+
+  boost::optional<double> SqlResultIndex::doubleValue(const std::string& reportName,
+                                                      const std::string& reportForString,
+                                                      const std::string& tableName,
+                                                      const std::string& rowName,
+                                                      const std::string& columnName,
+                                                      const std::string& units) const
+  {
+    boost::optional<double> result;
+    if (const Table* t = table(reportName, reportForString, tableName)) {
+      auto it = t->valuesByRowNameAndUnits.find(std::make_tuple(rowName, columnName, units));
+      if (it != t->valuesByRowNameAndUnits.end()) {
+        result = toDouble(it->second);
+      }
+    }
+    return result;
+  }
+
+  boost::optional<double> SqlResultIndex::hoursSimulated() const
+  {
+    return m_hoursSimulated;
+  }
+
+  const SqlResultIndex::Table* SqlResultIndex::table(const std::string& reportName,
+                                                     const std::string& reportForString,
+                                                     const std::string& tableName) const
+  {
+    auto it = m_tables.find(TableKey(reportName, reportForString, tableName));
+    if (it == m_tables.end()) {
+      return nullptr;
+    }
+    return &(it->second);
+  }
+
+} // detail
+
+} // model
+} // openstudio
@@ -0,0 +1,127 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef MODEL_SQLRESULTINDEX_HPP
+#define MODEL_SQLRESULTINDEX_HPP
+
+#include "ModelAPI.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace openstudio {
+
+class SqlFile;
+
+namespace model {
+
+namespace detail {
+
+  /** SqlResultIndex holds the TabularDataWithStrings tables that ModelObject result accessors read,
+   *  loaded with one query per table when the SqlFile is set on the Model. Lookups return what the
+   *  equivalent single-value query against the SqlFile would return first. Only the tables listed
+   *  by indexedTables() are loaded; lookups in any other table return boost::none. */
+  class MODEL_API SqlResultIndex {
+   public:
+
+    explicit SqlResultIndex(const SqlFile& sqlFile);
+
+    /** ReportName, ReportForString and TableName of each table that is loaded. */
+    static std::vector<std::tuple<std::string, std::string, std::string> > indexedTables();
+
+    /** Returns the Value in rowName, columnName of the table. */
+    boost::optional<std::string> value(const std::string& reportName,
+                                       const std::string& reportForString,
+                                       const std::string& tableName,
+                                       const std::string& rowName,
+                                       const std::string& columnName) const;
+
+    /** Returns the RowId of the first row of the table whose columnName holds value. */
+    boost::optional<int> rowId(const std::string& reportName,
+                               const std::string& reportForString,
+                               const std::string& tableName,
+                               const std::string& columnName,
+                               const std::string& value) const;
+
+    /** Returns the Value in rowId, columnName of the table as a double. */
+    boost::optional<double> doubleValue(const std::string& reportName,
+                                        const std::string& reportForString,
+                                        const std::string& tableName,
+                                        int rowId,
+                                        const std::string& columnName) const;
+
+    /** Returns the Value in rowId, columnName of the table as a double, if it is in units. */
+    boost::optional<double> doubleValue(const std::string& reportName,
+                                        const std::string& reportForString,
+                                        const std::string& tableName,
+                                        int rowId,
+                                        const std::string& columnName,
+                                        const std::string& units) const;
+
+    /** Returns the Value in rowName, columnName of the table as a double. */
+    boost::optional<double> doubleValue(const std::string& reportName,
+                                        const std::string& reportForString,
+                                        const std::string& tableName,
+                                        const std::string& rowName,
+                                        const std::string& columnName) const;
+
+    /** Returns the Value in rowName, columnName of the table as a double, if it is in units. */
+    boost::optional<double> doubleValue(const std::string& reportName,
+                                        const std::string& reportForString,
+                                        const std::string& tableName,
+                                        const std::string& rowName,
+                                        const std::string& columnName,
+                                        const std::string& units) const;
+
+    /** Returns SqlFile::hoursSimulated, read once when the index is built. */
+    boost::optional<double> hoursSimulated() const;
+
+   private:
+    REGISTER_LOGGER("openstudio.model.SqlResultIndex");
+
+    typedef std::tuple<std::string, std::string, std::string> TableKey;
+
+    struct Table {
+      std::map<std::pair<std::string, std::string>, std::string> valuesByRowName;
+      std::map<std::tuple<std::string, std::string, std::string>, std::string> valuesByRowNameAndUnits;
+      std::map<std::pair<int, std::string>, std::string> valuesByRowId;
+      std::map<std::tuple<int, std::string, std::string>, std::string> valuesByRowIdAndUnits;
+      std::map<std::pair<std::string, std::string>, int> rowIdsByValue;
+    };
+
+    const Table* table(const std::string& reportName,
+                       const std::string& reportForString,
+                       const std::string& tableName) const;
+
+    std::map<TableKey, Table> m_tables;
+    boost::optional<double> m_hoursSimulated;
+  };
+
+} // detail
+
+} // model
+} // openstudio
+
+#endif // MODEL_SQLRESULTINDEX_HPP
@@ -22,6 +22,7 @@
 
 #include "Model.hpp"
 #include "Model_Impl.hpp"
+#include "SqlResultIndex.hpp"
 #include "Surface.hpp"
 #include "Surface_Impl.hpp"
 #include "Space.hpp"
@@ -282,31 +283,21 @@ namespace detail {
       }
 
       // from output
-      OptionalSqlFile sqlFile = model().sqlFile();
+      std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
       OptionalString constructionName = oConstruction->name();
       OptionalDouble outputResult;
       // opaque exterior
-      if (sqlFile && constructionName && oConstruction->isOpaque()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+      if (sqlResults && constructionName && oConstruction->isOpaque()) {
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Opaque Exterior", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND RowId='";
-          ss << *rowId << "' AND ColumnName='U-Factor with Film' AND Units='W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Opaque Exterior", *rowId, "U-Factor with Film", "W/m2-K");
         }
       }
       // fenestration
-      if (sqlFile && constructionName && oConstruction->isFenestration()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+      if (sqlResults && constructionName && oConstruction->isFenestration()) {
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND RowId='";
-          ss << *rowId << "' AND ColumnName ='Glass U-Factor' AND Units = 'W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowId, "Glass U-Factor", "W/m2-K");
         }
       }
 
@@ -332,32 +323,22 @@ namespace detail {
       OptionalDouble inputResult = oConstruction->thermalConductance(oSurface->filmResistance());
 
       // from output
-      OptionalSqlFile sqlFile = model().sqlFile();
+      std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
       OptionalString constructionName = oConstruction->name();
       OptionalDouble outputResult;
       // opaque exterior
-      if (sqlFile && constructionName && oConstruction->isOpaque()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+      if (sqlResults && constructionName && oConstruction->isOpaque()) {
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Opaque Exterior", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND RowId='";
-          ss << *rowId << "' AND ColumnName='U-Factor no Film' AND Units='W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Opaque Exterior", *rowId, "U-Factor no Film", "W/m2-K");
         }
       }
       // fenestration
-      if (sqlFile && constructionName && oConstruction->isFenestration()) {
+      if (sqlResults && constructionName && oConstruction->isFenestration()) {
         // get u-factor, then subtract film coefficients
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND RowId='";
-          ss << *rowId << "' AND ColumnName ='Glass U-Factor' AND Units = 'W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowId, "Glass U-Factor", "W/m2-K");
         }
         if (outputResult) {
           outputResult = 1.0/(1.0/(*outputResult) - oSurface->filmResistance());
@@ -22,6 +22,7 @@
 
 #include "Model.hpp"
 #include "Model_Impl.hpp"
+#include "SqlResultIndex.hpp"
 #include "Space.hpp"
 #include "Space_Impl.hpp"
 #include "SubSurface.hpp"
@@ -65,6 +66,10 @@ namespace detail {
     : PlanarSurface_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == Surface::iddObjectType());
+
+    // keep the floor area and volume cached by the space up to date
+    connect(this, &Surface_Impl::onChange, this, &Surface_Impl::clearSpaceCachedGeometry);
+    connect(this, &Surface_Impl::onRelationshipChange, this, &Surface_Impl::clearPreviousSpaceCachedGeometry);
   }
 
   Surface_Impl::Surface_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -73,6 +78,10 @@ namespace detail {
     : PlanarSurface_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == Surface::iddObjectType());
+
+    // keep the floor area and volume cached by the space up to date
+    connect(this, &Surface_Impl::onChange, this, &Surface_Impl::clearSpaceCachedGeometry);
+    connect(this, &Surface_Impl::onRelationshipChange, this, &Surface_Impl::clearPreviousSpaceCachedGeometry);
   }
 
   Surface_Impl::Surface_Impl(const Surface_Impl& other,
@@ -80,6 +89,9 @@ namespace detail {
                              bool keepHandle)
     : PlanarSurface_Impl(other,model,keepHandle)
   {
+    // keep the floor area and volume cached by the space up to date
+    connect(this, &Surface_Impl::onChange, this, &Surface_Impl::clearSpaceCachedGeometry);
+    connect(this, &Surface_Impl::onRelationshipChange, this, &Surface_Impl::clearPreviousSpaceCachedGeometry);
   }
 
   Surface_Impl::~Surface_Impl()
@@ -532,6 +544,22 @@ namespace detail {
     return result;
   }
 
+  void Surface_Impl::clearSpaceCachedGeometry()
+  {
+    if (boost::optional<Space> space = this->space()){
+      space->getImpl<Space_Impl>()->clearCachedGeometry();
+    }
+  }
+
+  void Surface_Impl::clearPreviousSpaceCachedGeometry(int index, Handle newHandle, Handle oldHandle)
+  {
+    if (index == OS_SurfaceFields::SpaceName && !oldHandle.isNull()){
+      if (boost::optional<Space> space = model().getModelObject<Space>(oldHandle)){
+        space->getImpl<Space_Impl>()->clearCachedGeometry();
+      }
+    }
+  }
+
   boost::optional<double> Surface_Impl::uFactor() const {
     OptionalConstructionBase oConstruction = construction();
     OptionalDouble result;
@@ -541,32 +569,21 @@ namespace detail {
       OptionalDouble inputResult = oConstruction->uFactor(filmResistance());
 
       // from output
-      OptionalSqlFile sqlFile = model().sqlFile();
+      std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
       OptionalString constructionName = oConstruction->name();
       OptionalDouble outputResult;
       // opaque exterior
-      if (sqlFile && constructionName && oConstruction->isOpaque()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND ColumnName='Construction' AND Value='" + 
-            to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+      if (sqlResults && constructionName && oConstruction->isOpaque()) {
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Opaque Exterior", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND RowId='";
-          ss << *rowId << "' AND ColumnName='U-Factor with Film' AND Units='W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Opaque Exterior", *rowId, "U-Factor with Film", "W/m2-K");
         }
       }
       // fenestration
-      if (sqlFile && constructionName && oConstruction->isFenestration()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+      if (sqlResults && constructionName && oConstruction->isFenestration()) {
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND RowId='";
-          ss << *rowId << "' AND ColumnName ='Glass U-Factor' AND Units = 'W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowId, "Glass U-Factor", "W/m2-K");
         }
       }
 
@@ -591,32 +608,22 @@ namespace detail {
       OptionalDouble inputResult = oConstruction->thermalConductance(filmResistance());
 
       // from output
-      OptionalSqlFile sqlFile = model().sqlFile();
+      std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
       OptionalString constructionName = oConstruction->name();
       OptionalDouble outputResult;
       // opaque exterior
-      if (sqlFile && constructionName && oConstruction->isOpaque()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+      if (sqlResults && constructionName && oConstruction->isOpaque()) {
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Opaque Exterior", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND RowId='";
-          ss << *rowId << "' AND ColumnName='U-Factor no Film' AND Units='W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Opaque Exterior", *rowId, "U-Factor no Film", "W/m2-K");
         }
       }
       // fenestration
-      if (sqlFile && constructionName && oConstruction->isFenestration()) {
+      if (sqlResults && constructionName && oConstruction->isFenestration()) {
         // get u-factor, then subtract film coefficients
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
+        OptionalInt rowId = sqlResults->rowId("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", "Construction", to_upper_copy(*constructionName));
         if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND RowId='";
-          ss << *rowId << "' AND ColumnName ='Glass U-Factor' AND Units = 'W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+          outputResult = sqlResults->doubleValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowId, "Glass U-Factor", "W/m2-K");
         }
         if (outputResult) {
           outputResult = 1.0/(1.0/(*outputResult) - filmResistance());
@@ -259,6 +259,12 @@ namespace detail {
     bool setSpaceAsModelObject(const boost::optional<ModelObject>& modelObject);
     bool setAdjacentSurfaceAsModelObject(const boost::optional<ModelObject>& modelObject);
 
+   private slots:
+
+    void clearSpaceCachedGeometry();
+
+    void clearPreviousSpaceCachedGeometry(int index, Handle newHandle, Handle oldHandle);
+
   };
 
 } // detail
@@ -29,6 +29,7 @@
 #include "ZoneHVACEquipmentList_Impl.hpp"
 #include "Model.hpp"
 #include "Model_Impl.hpp"
+#include "SqlResultIndex.hpp"
 #include "Building.hpp"
 #include "Building_Impl.hpp"
 #include "SizingZone.hpp"
@@ -929,14 +930,14 @@ namespace detail {
   boost::optional<std::string> ThermalZone_Impl::isConditioned() const {
     boost::optional<std::string> result;
 
-    OptionalSqlFile mySqlFile = model().sqlFile();
+    std::shared_ptr<const SqlResultIndex> sqlResults = model().getImpl<Model_Impl>()->sqlResultIndex();
 
     // TODO: this should not require sql file
 
-    if (mySqlFile) {
-      // now use sql query to check if conditioned
+    if (sqlResults) {
+      // now use sql results to check if conditioned
       std::string zoneName = boost::to_upper_copy(name(true).get());
-      result = mySqlFile->execAndReturnFirstString("SELECT Value from tabulardatawithstrings where (reportname = 'InputVerificationandResultsSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Zone Summary'  ) and (ColumnName ='Conditioned (Y/N)') and (RowName = '" + zoneName + "')");
+      result = sqlResults->value("InputVerificationandResultsSummary", "Entire Facility", "Zone Summary", zoneName, "Conditioned (Y/N)");
       if (!result){
         LOG(Error, "Query for " << briefDescription() << " isConditioned failed.");
       }
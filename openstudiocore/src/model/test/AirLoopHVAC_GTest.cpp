@@ -255,6 +255,43 @@ TEST_F(ModelFixture,ThermalZone_remove)
   airLoopHVAC.removeBranchForZone(thermalZone);
 }
 
+TEST_F(ModelFixture,ThermalZone_remove_CachedTopology)
+{
+  Model model = Model();
+
+  AirLoopHVAC airLoopHVAC = AirLoopHVAC(model);
+  ThermalZone thermalZone = ThermalZone(model);
+  ThermalZone thermalZone2 = ThermalZone(model);
+  ThermalZone thermalZone3 = ThermalZone(model);
+
+  ASSERT_TRUE(airLoopHVAC.addBranchForZone(thermalZone,boost::optional<StraightComponent>()));
+  ASSERT_TRUE(airLoopHVAC.addBranchForZone(thermalZone3,boost::optional<StraightComponent>()));
+  unsigned twoZoneSize = airLoopHVAC.demandComponents().size();
+
+  ASSERT_TRUE(airLoopHVAC.addBranchForZone(thermalZone2,boost::optional<StraightComponent>()));
+  Handle zone2Handle = thermalZone2.handle();
+
+  // fill the cached topology, ThermalZone::remove then edits the loop with signals blocked
+  EXPECT_LT(twoZoneSize, airLoopHVAC.demandComponents().size());
+  EXPECT_EQ(3u, airLoopHVAC.demandComponents(ThermalZone::iddObjectType()).size());
+  EXPECT_TRUE(airLoopHVAC.demandComponent(zone2Handle));
+
+  EXPECT_FALSE(thermalZone2.remove().empty());
+
+  std::vector<ModelObject> demandComponents = airLoopHVAC.demandComponents();
+  EXPECT_EQ(twoZoneSize, demandComponents.size());
+  for (const ModelObject& comp : demandComponents) {
+    EXPECT_TRUE(model.getModelObject<ModelObject>(comp.handle()));
+  }
+
+  std::vector<ModelObject> zones = airLoopHVAC.demandComponents(ThermalZone::iddObjectType());
+  ASSERT_EQ(2u, zones.size());
+  EXPECT_FALSE(airLoopHVAC.demandComponent(zone2Handle));
+  EXPECT_TRUE(airLoopHVAC.demandComponent(thermalZone.handle()));
+  EXPECT_TRUE(airLoopHVAC.demandComponent(thermalZone3.handle()));
+  EXPECT_EQ(2u, airLoopHVAC.thermalZones().size());
+}
+
 TEST_F(ModelFixture,AirLoopHVAC_remove)
 {
   Model model = Model();
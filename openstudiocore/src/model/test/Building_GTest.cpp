@@ -23,6 +23,7 @@
 
 #include "../Building.hpp"
 #include "../Building_Impl.hpp"
+#include "../Model_Impl.hpp"
 
 #include "../ThermalZone.hpp"
 #include "../ThermalZone_Impl.hpp"
@@ -50,6 +51,8 @@
 
 #include "../../utilities/data/Attribute.hpp"
 
+#include <boost/timer.hpp>
+
 using namespace openstudio::model;
 using namespace openstudio;
 
@@ -388,3 +391,267 @@ TEST_F(ModelFixture, Building_Clone)
   }
 }
 
+TEST_F(ModelFixture, Building_CachedAggregates)
+{
+  Model model;
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 10, 0));
+  points.push_back(Point3d(10, 10, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+
+  Space space1(model);
+  Space space2(model);
+  Surface floor(points, model);
+  EXPECT_TRUE(floor.setSpace(space1));
+
+  SpaceType spaceType(model);
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(1.0));
+  Lights lights(lightsDefinition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_TRUE(space1.setSpaceType(spaceType));
+
+  EXPECT_NEAR(100, space1.floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+  EXPECT_NEAR(100, space1.lightingPower(), 0.0001);
+  EXPECT_NEAR(100, building.lightingPower(), 0.0001);
+
+  // geometry change
+  points.clear();
+  points.push_back(Point3d(0, 20, 0));
+  points.push_back(Point3d(10, 20, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floor.setVertices(points));
+  EXPECT_NEAR(200, space1.floorArea(), 0.0001);
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+  EXPECT_NEAR(200, space1.lightingPower(), 0.0001);
+  EXPECT_NEAR(200, building.lightingPower(), 0.0001);
+
+  // shared definition change
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(2.0));
+  EXPECT_NEAR(400, space1.lightingPower(), 0.0001);
+  EXPECT_NEAR(400, building.lightingPower(), 0.0001);
+
+  // surface moves to a space without lights
+  EXPECT_TRUE(floor.setSpace(space2));
+  EXPECT_NEAR(0, space1.floorArea(), 0.0001);
+  EXPECT_NEAR(200, space2.floorArea(), 0.0001);
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+  EXPECT_NEAR(0, building.lightingPower(), 0.0001);
+
+  // building space type applies to spaces without one
+  EXPECT_TRUE(building.setSpaceType(spaceType));
+  EXPECT_NEAR(400, space2.lightingPower(), 0.0001);
+  EXPECT_NEAR(400, building.lightingPower(), 0.0001);
+
+  // multiplier
+  ThermalZone thermalZone(model);
+  EXPECT_TRUE(space2.setThermalZone(thermalZone));
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+  EXPECT_TRUE(thermalZone.setMultiplier(3));
+  EXPECT_NEAR(600, building.floorArea(), 0.0001);
+  EXPECT_NEAR(1200, building.lightingPower(), 0.0001);
+
+  // cloned surface keeps its space
+  Surface floor2 = floor.clone(model).cast<Surface>();
+  ASSERT_TRUE(floor2.space());
+  EXPECT_EQ(space2, floor2.space().get());
+  EXPECT_NEAR(400, space2.floorArea(), 0.0001);
+  EXPECT_NEAR(1200, building.floorArea(), 0.0001);
+
+  // removal
+  floor.remove();
+  EXPECT_NEAR(200, space2.floorArea(), 0.0001);
+  EXPECT_NEAR(600, building.floorArea(), 0.0001);
+  lights.remove();
+  EXPECT_NEAR(0, space2.lightingPower(), 0.0001);
+  EXPECT_NEAR(0, building.lightingPower(), 0.0001);
+
+  // swapped models reconnect their objects
+  Model other;
+  model.swap(other);
+  EXPECT_NEAR(600, other.getUniqueModelObject<Building>().floorArea(), 0.0001);
+  thermalZone.setMultiplier(1);
+  EXPECT_NEAR(200, other.getUniqueModelObject<Building>().floorArea(), 0.0001);
+}
+
+TEST_F(ModelFixture, Building_CachedAggregates_Recompute)
+{
+  Model model;
+  detail::Model_Impl* modelImpl = model.getImpl<detail::Model_Impl>().get();
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  SpaceType spaceType(model);
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(1.0));
+  Lights lights(lightsDefinition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_TRUE(building.setSpaceType(spaceType));
+
+  ThermalZone thermalZone(model);
+
+  const unsigned numSpaces = 100;
+  std::vector<Space> spaces;
+  std::vector<Surface> floors;
+  for (unsigned i = 0; i < numSpaces; ++i){
+    Point3dVector points;
+    points.push_back(Point3d(0, 10, i));
+    points.push_back(Point3d(10, 10, i));
+    points.push_back(Point3d(10, 0, i));
+    points.push_back(Point3d(0, 0, i));
+    Space space(model);
+    EXPECT_TRUE(space.setThermalZone(thermalZone));
+    Surface floor(points, model);
+    EXPECT_TRUE(floor.setSpace(space));
+    spaces.push_back(space);
+    floors.push_back(floor);
+  }
+
+  // one space also has lights of its own
+  LightsDefinition spaceLightsDefinition(model);
+  EXPECT_TRUE(spaceLightsDefinition.setLightingLevel(50.0));
+  Lights spaceLights(spaceLightsDefinition);
+  EXPECT_TRUE(spaceLights.setSpace(spaces[1]));
+
+  // first query computes every space
+  unsigned numComputations = modelImpl->numSpaceAggregateComputations();
+  double floorArea = building.floorArea();
+  double lightingPower = building.lightingPower();
+  EXPECT_FALSE(building.conditionedFloorArea());
+  EXPECT_NEAR(100 * numSpaces, floorArea, 0.01);
+  EXPECT_NEAR(100 * numSpaces + 50, lightingPower, 0.01);
+  EXPECT_LE(numComputations + 2 * numSpaces, modelImpl->numSpaceAggregateComputations());
+
+  // repeated queries are served from the cache
+  numComputations = modelImpl->numSpaceAggregateComputations();
+  for (unsigned i = 0; i < 10; ++i){
+    EXPECT_DOUBLE_EQ(floorArea, building.floorArea());
+    EXPECT_DOUBLE_EQ(lightingPower, building.lightingPower());
+    EXPECT_FALSE(building.conditionedFloorArea());
+  }
+  EXPECT_EQ(numComputations, modelImpl->numSpaceAggregateComputations());
+
+  // a change to one space only recomputes that space and the building totals
+  Point3dVector points;
+  points.push_back(Point3d(0, 20, 0));
+  points.push_back(Point3d(10, 20, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floors[0].setVertices(points));
+  EXPECT_NEAR(floorArea + 100, building.floorArea(), 0.0001);
+  EXPECT_NEAR(lightingPower + 100, building.lightingPower(), 0.0001);
+  EXPECT_LT(numComputations, modelImpl->numSpaceAggregateComputations());
+  EXPECT_GE(numComputations + 10, modelImpl->numSpaceAggregateComputations());
+  lightingPower = building.lightingPower();
+
+  // a change to a space's own lights only recomputes that space's load totals
+  numComputations = modelImpl->numSpaceAggregateComputations();
+  EXPECT_TRUE(spaceLights.setMultiplier(2.0));
+  EXPECT_NEAR(lightingPower + 50, building.lightingPower(), 0.0001);
+  EXPECT_DOUBLE_EQ(100, spaces[1].lightingPower() - spaces[2].lightingPower());
+  EXPECT_LT(numComputations, modelImpl->numSpaceAggregateComputations());
+  EXPECT_GE(numComputations + 10, modelImpl->numSpaceAggregateComputations());
+  lightingPower = building.lightingPower();
+
+  // so does a change to its definition
+  numComputations = modelImpl->numSpaceAggregateComputations();
+  EXPECT_TRUE(spaceLightsDefinition.setLightingLevel(100.0));
+  EXPECT_NEAR(lightingPower + 100, building.lightingPower(), 0.0001);
+  EXPECT_LT(numComputations, modelImpl->numSpaceAggregateComputations());
+  EXPECT_GE(numComputations + 10, modelImpl->numSpaceAggregateComputations());
+  lightingPower = building.lightingPower();
+
+  // renaming a space only recomputes that space
+  numComputations = modelImpl->numSpaceAggregateComputations();
+  EXPECT_TRUE(spaces[2].setName("Renamed Space"));
+  EXPECT_DOUBLE_EQ(lightingPower, building.lightingPower());
+  EXPECT_GE(numComputations + 10, modelImpl->numSpaceAggregateComputations());
+
+  // a change to the space type's lights recomputes every space using it
+  numComputations = modelImpl->numSpaceAggregateComputations();
+  EXPECT_TRUE(lights.setMultiplier(2.0));
+  EXPECT_NEAR(lightingPower + floorArea + 100, building.lightingPower(), 0.01);
+  EXPECT_LE(numComputations + numSpaces, modelImpl->numSpaceAggregateComputations());
+}
+
+TEST_F(ModelFixture, Building_CachedAggregates_Benchmark)
+{
+  Model model;
+  detail::Model_Impl* modelImpl = model.getImpl<detail::Model_Impl>().get();
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  SpaceType spaceType(model);
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(1.0));
+  Lights lights(lightsDefinition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_TRUE(building.setSpaceType(spaceType));
+
+  ThermalZone thermalZone(model);
+
+  const unsigned numSpaces = 5000;
+  std::vector<Surface> floors;
+  for (unsigned i = 0; i < numSpaces; ++i){
+    Point3dVector points;
+    points.push_back(Point3d(0, 10, i));
+    points.push_back(Point3d(10, 10, i));
+    points.push_back(Point3d(10, 0, i));
+    points.push_back(Point3d(0, 0, i));
+    Space space(model);
+    EXPECT_TRUE(space.setThermalZone(thermalZone));
+    Surface floor(points, model);
+    EXPECT_TRUE(floor.setSpace(space));
+    floors.push_back(floor);
+  }
+
+  LightsDefinition spaceLightsDefinition(model);
+  EXPECT_TRUE(spaceLightsDefinition.setLightingLevel(50.0));
+  Lights spaceLights(spaceLightsDefinition);
+  EXPECT_TRUE(spaceLights.setSpace(floors[1].space().get()));
+
+  boost::timer t;
+  double floorArea = building.floorArea();
+  double lightingPower = building.lightingPower();
+  double firstQuery = t.elapsed();
+  EXPECT_NEAR(100 * numSpaces, floorArea, 0.1);
+  EXPECT_NEAR(100 * numSpaces + 50, lightingPower, 0.1);
+
+  unsigned numComputations = modelImpl->numSpaceAggregateComputations();
+  t.restart();
+  for (unsigned i = 0; i < 100; ++i){
+    EXPECT_DOUBLE_EQ(floorArea, building.floorArea());
+    EXPECT_DOUBLE_EQ(lightingPower, building.lightingPower());
+  }
+  double repeatedQueries = t.elapsed();
+  EXPECT_EQ(numComputations, modelImpl->numSpaceAggregateComputations());
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 20, 0));
+  points.push_back(Point3d(10, 20, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  t.restart();
+  EXPECT_TRUE(floors[0].setVertices(points));
+  EXPECT_NEAR(floorArea + 100, building.floorArea(), 0.001);
+  EXPECT_NEAR(lightingPower + 100, building.lightingPower(), 0.001);
+  double floorChange = t.elapsed();
+  EXPECT_GE(numComputations + 10, modelImpl->numSpaceAggregateComputations());
+  lightingPower = building.lightingPower();
+
+  numComputations = modelImpl->numSpaceAggregateComputations();
+  t.restart();
+  EXPECT_TRUE(spaceLights.setMultiplier(2.0));
+  EXPECT_NEAR(lightingPower + 50, building.lightingPower(), 0.001);
+  double lightsChange = t.elapsed();
+  EXPECT_GE(numComputations + 10, modelImpl->numSpaceAggregateComputations());
+
+  LOG(Info, numSpaces << " spaces, first query: " << firstQuery << " 100 repeated queries: " << repeatedQueries
+      << " after a floor change: " << floorChange << " after a lights change: " << lightsChange);
+}
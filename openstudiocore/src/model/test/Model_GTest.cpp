@@ -442,6 +442,44 @@ TEST_F(ModelFixture, ExampleModel_Save)
   EXPECT_EQ(model.numObjects(), model2->numObjects());
 }
 
+TEST_F(ModelFixture, ExampleModel_SaveBinary)
+{
+  Model model = exampleModel();
+
+  openstudio::path path = toPath("./ExampleModel_SaveBinary.osb");
+  EXPECT_TRUE(model.saveBinary(path, true));
+
+  boost::optional<Model> model2 = Model::loadBinary(path);
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(model.numObjects(), model2->numObjects());
+  for (const ModelObject& object : model.modelObjects()){
+    boost::optional<ModelObject> object2 = model2->getModelObject<ModelObject>(object.handle());
+    ASSERT_TRUE(object2);
+    EXPECT_EQ(object.iddObjectType(), object2->iddObjectType());
+    EXPECT_EQ(object.name(), object2->name());
+  }
+
+  // objects are model objects, relationships resolve
+  boost::optional<Building> building = model2->getOptionalUniqueModelObject<Building>();
+  ASSERT_TRUE(building);
+  EXPECT_EQ(400, building->floorArea());
+  std::vector<SpaceType> spaceTypes = model2->getModelObjects<SpaceType>();
+  ASSERT_EQ(1u, spaceTypes.size());
+  std::vector<Space> spaces = model2->getModelObjects<Space>();
+  EXPECT_EQ(4u, spaces.size());
+  for (const Space& space : spaces){
+    boost::optional<SpaceType> testSpaceType = space.spaceType();
+    ASSERT_TRUE(testSpaceType);
+    EXPECT_EQ(spaceTypes[0].handle(), testSpaceType->handle());
+  }
+
+  // a binary Workspace saved with another Idd is not a Model
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  openstudio::path energyPlusPath = toPath("./ExampleModel_SaveBinary_EnergyPlus.osb");
+  EXPECT_TRUE(workspace.saveBinary(energyPlusPath, true));
+  EXPECT_FALSE(Model::loadBinary(energyPlusPath));
+}
+
 TEST_F(ModelFixture, ExampleModel_StagedLoad) {
   Model model = exampleModel();
   openstudio::path path = toPath("./example.osm");
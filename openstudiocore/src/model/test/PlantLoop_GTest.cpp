@@ -360,3 +360,42 @@ TEST_F(ModelFixture, PlantLoop_removeBranchWithComponent)
   EXPECT_EQ(5u,plantDemandComps.size());
 }
 
+
+TEST_F(ModelFixture, PlantLoop_cachedTopology)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  ScheduleCompact s(m);
+  CoilHeatingWater heatingCoil(m,s);
+
+  // populate the cache before any edit
+  std::vector<ModelObject> demandComps = plantLoop.demandComponents();
+  ASSERT_EQ(5u,demandComps.size());
+  EXPECT_FALSE(plantLoop.demandComponent(heatingCoil.handle()));
+  EXPECT_TRUE(plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).empty());
+
+  // repeated queries return the same components in the same order
+  EXPECT_TRUE(demandComps == plantLoop.demandComponents());
+
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(heatingCoil));
+  EXPECT_EQ(7u,plantLoop.demandComponents().size());
+  EXPECT_TRUE(plantLoop.demandComponent(heatingCoil.handle()));
+  EXPECT_FALSE(plantLoop.supplyComponent(heatingCoil.handle()));
+  ASSERT_EQ(1u,plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+  EXPECT_EQ(heatingCoil,plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).front());
+
+  // editing a connection directly through the model also clears the cache
+  boost::optional<ModelObject> inletModelObject = heatingCoil.waterInletModelObject();
+  ASSERT_TRUE(inletModelObject);
+  m.disconnect(heatingCoil,heatingCoil.waterInletPort());
+  EXPECT_FALSE(plantLoop.demandComponent(heatingCoil.handle()));
+  EXPECT_TRUE(plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).empty());
+
+  m.connect(inletModelObject.get(),inletModelObject->cast<Node>().outletPort(),heatingCoil,heatingCoil.waterInletPort());
+  EXPECT_TRUE(plantLoop.demandComponent(heatingCoil.handle()));
+  EXPECT_EQ(7u,plantLoop.demandComponents().size());
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(heatingCoil));
+  EXPECT_FALSE(plantLoop.demandComponent(heatingCoil.handle()));
+  EXPECT_EQ(5u,plantLoop.demandComponents().size());
+}
@@ -32,11 +32,15 @@
 #include "../RunPeriodControlSpecialDays_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
 #include "../ScheduleTypeLimits_Impl.hpp"
+#include "../ScheduleConstant.hpp"
+#include "../ScheduleConstant_Impl.hpp"
 
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
 
+#include <boost/timer.hpp>
+
 using namespace openstudio::model;
 using namespace openstudio;
 
@@ -799,6 +803,123 @@ TEST_F(ModelFixture, ScheduleRuleset_InsertObjects)
   EXPECT_FALSE(addedObjects.empty());
 }
 
+TEST_F(ModelFixture, ScheduleRuleset_annualValues)
+{
+  Model model;
+
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleRuleset schedule(model);
+  schedule.defaultDaySchedule().addValue(Time(0, 24, 0), 0.2);
+
+  ScheduleRule weekdayRule(schedule);
+  weekdayRule.setApplyMonday(true);
+  weekdayRule.setApplyTuesday(true);
+  weekdayRule.setApplyWednesday(true);
+  weekdayRule.setApplyThursday(true);
+  weekdayRule.setApplyFriday(true);
+  weekdayRule.daySchedule().addValue(Time(0, 8, 0), 0.1);
+  weekdayRule.daySchedule().addValue(Time(0, 17, 30), 1.0);
+  weekdayRule.daySchedule().addValue(Time(0, 24, 0), 0.1);
+
+  ScheduleRule summerRule(schedule);
+  summerRule.setApplySaturday(true);
+  EXPECT_TRUE(summerRule.setStartDate(yd.makeDate(openstudio::MonthOfYear::Jun, 1)));
+  EXPECT_TRUE(summerRule.setEndDate(yd.makeDate(openstudio::MonthOfYear::Aug, 31)));
+  summerRule.daySchedule().addValue(Time(0, 12, 0), 0.5);
+  summerRule.daySchedule().addValue(Time(0, 24, 0), 0.0);
+
+  // every timestep must match evaluating the active day schedule directly
+  std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(yd.makeDate(openstudio::MonthOfYear::Jan, 1),
+                                                                   yd.makeDate(openstudio::MonthOfYear::Dec, 31));
+  ASSERT_EQ(365u, daySchedules.size());
+
+  std::vector<double> values = schedule.annualValues(Time(0, 0, 15));
+  ASSERT_EQ(365u * 96u, values.size());
+  for (unsigned d = 0; d < 365; ++d){
+    for (unsigned i = 0; i < 96; ++i){
+      EXPECT_DOUBLE_EQ(daySchedules[d].getValue(Time(0, 0, 15 * (i + 1))), values[96 * d + i]);
+    }
+  }
+
+  // Jan 1 2009 is a Thursday
+  EXPECT_DOUBLE_EQ(0.1, values[8 * 4 - 1]);
+  EXPECT_DOUBLE_EQ(1.0, values[8 * 4]);
+
+  // timestep must evenly divide a day
+  EXPECT_TRUE(schedule.annualValues(Time(0, 0, 7)).empty());
+  EXPECT_TRUE(schedule.annualValues(Time(0, 0, 0)).empty());
+
+  ScheduleConstant constant(model);
+  constant.setValue(3.0);
+  std::vector<double> constantValues = constant.annualValues(Time(0, 1, 0));
+  ASSERT_EQ(365u * 24u, constantValues.size());
+  for (double value : constantValues){
+    EXPECT_DOUBLE_EQ(3.0, value);
+  }
+
+  // concurrent evaluation gives the same results as evaluating one at a time
+  std::vector<ScheduleBase> schedules;
+  schedules.push_back(schedule);
+  schedules.push_back(schedule.defaultDaySchedule());
+  schedules.push_back(constant);
+  std::vector<std::vector<double> > allValues = annualValues(schedules, Time(0, 0, 15));
+  ASSERT_EQ(3u, allValues.size());
+  EXPECT_EQ(values, allValues[0]);
+  EXPECT_TRUE(allValues[1].empty());
+  EXPECT_EQ(constant.annualValues(Time(0, 0, 15)), allValues[2]);
+}
+
+TEST_F(ModelFixture, ScheduleRuleset_annualValues_Performance)
+{
+  Model model;
+
+  std::vector<ScheduleBase> schedules;
+  for (unsigned i = 0; i < 50; ++i){
+    ScheduleRuleset schedule(model);
+    for (unsigned j = 0; j < 4; ++j){
+      ScheduleRule rule(schedule);
+      rule.setApplyMonday(j % 2 == 0);
+      rule.setApplyWednesday(true);
+      rule.setApplySaturday(j % 2 == 1);
+      EXPECT_TRUE(rule.setStartDate(openstudio::Date(openstudio::MonthOfYear::Jan, 1 + j)));
+      EXPECT_TRUE(rule.setEndDate(openstudio::Date(openstudio::MonthOfYear::Oct, 1 + j)));
+      for (unsigned hour = 1; hour <= 24; ++hour){
+        rule.daySchedule().addValue(Time(0, hour, 0), 0.01 * (i + j + hour));
+      }
+    }
+    schedules.push_back(schedule);
+  }
+
+  openstudio::Date jan1(openstudio::MonthOfYear::Jan, 1);
+  openstudio::Date dec31(openstudio::MonthOfYear::Dec, 31);
+
+  boost::timer t;
+  double sum = 0.0;
+  for (const ScheduleBase& schedule : schedules){
+    for (const ScheduleDay& daySchedule : schedule.cast<ScheduleRuleset>().getDaySchedules(jan1, dec31)){
+      for (unsigned i = 1; i <= 144; ++i){
+        sum += daySchedule.getValue(Time(0, 0, 10 * i));
+      }
+    }
+  }
+  double oldway = t.elapsed();
+
+  t.restart();
+  double annualSum = 0.0;
+  for (const std::vector<double>& values : annualValues(schedules, Time(0, 0, 10))){
+    ASSERT_EQ(365u * 144u, values.size());
+    for (double value : values){
+      annualSum += value;
+    }
+  }
+  double newway = t.elapsed();
+
+  EXPECT_NEAR(sum, annualSum, 1.0e-6 * sum);
+  LOG(Info, "Annual schedule evaluation, getValue: " << oldway << " annualValues: " << newway);
+}
+
 /*
 January
 
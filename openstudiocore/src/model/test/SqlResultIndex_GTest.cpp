@@ -0,0 +1,118 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelFixture.hpp"
+
+#include "../SqlResultIndex.hpp"
+#include "../Model_Impl.hpp"
+#include "../Facility.hpp"
+#include "../Surface.hpp"
+#include "../ThermalZone.hpp"
+
+#include "../../utilities/sql/SqlFile.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+using namespace openstudio::model;
+using namespace openstudio;
+
+TEST_F(ModelFixture, SqlResultIndex)
+{
+  openstudio::path osmPath = resourcesPath() / toPath("model/Daylighting_Office/in.osm");
+  OptionalModel optionalModel = Model::load(osmPath);
+  ASSERT_TRUE(optionalModel);
+  Model model(*optionalModel);
+
+  EXPECT_FALSE(model.getImpl<detail::Model_Impl>()->sqlResultIndex());
+
+  openstudio::path sqlPath = resourcesPath() / toPath("model/Daylighting_Office/eplusout.sql");
+  SqlFile sqlFile(sqlPath);
+  ASSERT_TRUE(sqlFile.connectionOpen()) << "sqlFile connection not opened";
+  model.setSqlFile(sqlFile);
+
+  std::shared_ptr<const detail::SqlResultIndex> index = model.getImpl<detail::Model_Impl>()->sqlResultIndex();
+  ASSERT_TRUE(index);
+
+  // every indexed value matches the single-value query it replaces
+  unsigned numCompared = 0;
+  for (const auto& tableKey : detail::SqlResultIndex::indexedTables()) {
+    std::string where = "WHERE ReportName='" + std::get<0>(tableKey) + "' AND ReportForString='" + std::get<1>(tableKey) + 
+        "' AND TableName='" + std::get<2>(tableKey) + "'";
+    boost::optional<std::vector<std::vector<std::string> > > rows = 
+        sqlFile.execAndReturnVectorOfRows("SELECT RowName, ColumnName, Units, RowId FROM tabulardatawithstrings " + where);
+    ASSERT_TRUE(rows);
+    for (const std::vector<std::string>& row : *rows) {
+      ASSERT_EQ(4u, row.size());
+      std::string rowWhere = where + " AND RowName='" + row[0] + "' AND ColumnName='" + row[1] + "'";
+      EXPECT_EQ(sqlFile.execAndReturnFirstString("SELECT Value FROM tabulardatawithstrings " + rowWhere),
+                index->value(std::get<0>(tableKey), std::get<1>(tableKey), std::get<2>(tableKey), row[0], row[1]));
+
+      int rowId = std::stoi(row[3]);
+      std::string idWhere = where + " AND RowId='" + row[3] + "' AND ColumnName='" + row[1] + "'";
+      boost::optional<double> expected = sqlFile.execAndReturnFirstDouble("SELECT Value FROM tabulardatawithstrings " + idWhere);
+      boost::optional<double> actual = index->doubleValue(std::get<0>(tableKey), std::get<1>(tableKey), std::get<2>(tableKey), rowId, row[1]);
+      ASSERT_EQ(expected.is_initialized(), actual.is_initialized());
+      if (expected) {
+        EXPECT_DOUBLE_EQ(*expected, *actual);
+      }
+      ++numCompared;
+    }
+  }
+  EXPECT_LT(0u, numCompared);
+
+  EXPECT_FALSE(index->value("EnvelopeSummary", "Entire Facility", "Opaque Exterior", "NOT A SURFACE", "Construction"));
+  EXPECT_FALSE(index->rowId("EnvelopeSummary", "Entire Facility", "Not A Table", "Construction", "NOT A CONSTRUCTION"));
+
+  // accessors read the same values as the queries they replace
+  for (const ThermalZone& zone : model.getModelObjects<ThermalZone>()) {
+    std::string zoneName = boost::to_upper_copy(zone.name().get());
+    EXPECT_EQ(sqlFile.execAndReturnFirstString("SELECT Value FROM tabulardatawithstrings WHERE ReportName='InputVerificationandResultsSummary' AND ReportForString='Entire Facility' AND TableName='Zone Summary' AND ColumnName='Conditioned (Y/N)' AND RowName='" + zoneName + "'"),
+              zone.isConditioned());
+  }
+
+  EXPECT_EQ(sqlFile.hoursSimulated(), index->hoursSimulated());
+
+  Facility facility = model.getUniqueModelObject<Facility>();
+  EXPECT_EQ(sqlFile.totalSiteEnergy(), facility.totalSiteEnergy());
+  EXPECT_EQ(sqlFile.netSiteEnergy(), facility.netSiteEnergy());
+  EXPECT_EQ(sqlFile.totalSourceEnergy(), facility.totalSourceEnergy());
+  EXPECT_EQ(sqlFile.netSourceEnergy(), facility.netSourceEnergy());
+  EXPECT_TRUE(index->doubleValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy",
+                                 "Total Site Energy", "Total Energy", "GJ"));
+  for (FuelType fuel : FuelType::getValues()) {
+    EXPECT_EQ(sqlFile.annualTotalCost(fuel), facility.annualTotalCost(fuel));
+    EXPECT_EQ(sqlFile.annualTotalCostPerBldgArea(fuel), facility.annualTotalCostPerBldgArea(fuel));
+    EXPECT_EQ(sqlFile.annualTotalCostPerNetConditionedBldgArea(fuel), facility.annualTotalCostPerNetConditionedBldgArea(fuel));
+  }
+  EXPECT_EQ(sqlFile.annualTotalUtilityCost(), facility.annualTotalUtilityCost());
+
+  // clones share the index
+  Model clone = model.clone().cast<Model>();
+  EXPECT_EQ(index, clone.getImpl<detail::Model_Impl>()->sqlResultIndex());
+  for (const Surface& surface : model.getModelObjects<Surface>()) {
+    boost::optional<Surface> cloneSurface = clone.getModelObjectByName<Surface>(surface.name().get());
+    ASSERT_TRUE(cloneSurface);
+    EXPECT_EQ(surface.uFactor(), cloneSurface->uFactor());
+  }
+
+  model.resetSqlFile();
+  EXPECT_FALSE(model.getImpl<detail::Model_Impl>()->sqlResultIndex());
+}
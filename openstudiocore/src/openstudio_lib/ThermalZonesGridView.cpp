@@ -120,6 +120,7 @@ ThermalZonesGridView::ThermalZonesGridView(bool isIP, const model::Model & model
 
   ThermalZonesGridController * thermalZonesGridController = new ThermalZonesGridController(m_isIP, "Thermal Zones", IddObjectType::OS_ThermalZone, model, thermalZoneModelObjects);
   OSGridView * gridView = new OSGridView(thermalZonesGridController, "Thermal Zones", "Drop\nZone", false, parent);
+  gridView->setVirtualized(true);
 
   bool isConnected = false;
 
@@ -0,0 +1,161 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ThermalZonesGridView.hpp"
+
+#include "../../shared_gui_components/OSGridView.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/ScheduleRuleset.hpp"
+#include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
+#include "../../model/ThermostatSetpointDualSetpoint.hpp"
+
+#include "../../utilities/core/Containers.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <boost/timer.hpp>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, OSGridView_ChunksFollowRowCount)
+{
+  model::Model model;
+  std::vector<model::ThermalZone> thermalZones;
+  for (unsigned i = 0; i < 250; ++i){
+    thermalZones.push_back(model::ThermalZone(model));
+  }
+
+  std::vector<model::ModelObject> modelObjects = subsetCastVector<model::ModelObject>(thermalZones);
+  auto gridController = new ThermalZonesGridController(false, "Thermal Zones", IddObjectType::OS_ThermalZone, model, modelObjects);
+
+  // the grid is never shown, so no chunk is painted and asked for editors
+  OSGridView gridView(gridController, "Thermal Zones", "Drop\nZone", false);
+  EXPECT_FALSE(gridView.isVirtualized());
+
+  gridView.refreshAll();
+  EXPECT_EQ(251, gridController->rowCount());
+  EXPECT_EQ(3, gridView.chunkCount());
+  EXPECT_EQ(gridController->rowCount(), gridView.materializedRowCount());
+
+  // chunks past the last row are destroyed rather than left behind empty
+  for (unsigned i = 0; i < 200; ++i){
+    thermalZones[i].remove();
+  }
+  gridView.refreshAll();
+  EXPECT_EQ(51, gridController->rowCount());
+  EXPECT_EQ(1, gridView.chunkCount());
+  EXPECT_EQ(gridController->rowCount(), gridView.materializedRowCount());
+
+  gridView.setVirtualized(true);
+  for (unsigned i = 0; i < 250; ++i){
+    model::ThermalZone thermalZone(model);
+  }
+  gridView.refreshAll();
+  EXPECT_EQ(301, gridController->rowCount());
+  EXPECT_EQ(4, gridView.chunkCount());
+
+  // only the header chunk has editors, the other rows are painted from cell text
+  EXPECT_EQ(OSGridView::ROWS_PER_LAYOUT, gridView.materializedRowCount());
+  EXPECT_TRUE(gridView.rowText(1).empty());
+  std::vector<QString> lastRowText = gridView.rowText(gridController->rowCount() - 1);
+  ASSERT_EQ(static_cast<unsigned>(gridController->columnCount()), lastRowText.size());
+  model::ModelObject last = gridController->modelObject(gridController->rowCount() - 1);
+  EXPECT_EQ(toQString(last.name().get()), lastRowText[0]);
+}
+
+TEST_F(OpenStudioLibFixture, OSGridView_RowTextFollowsRelatedObjects)
+{
+  model::Model model;
+  model::ScheduleRuleset schedule(model);
+  schedule.setName("Cooling Schedule");
+
+  for (unsigned i = 0; i < 150; ++i){
+    model::ThermalZone thermalZone(model);
+    model::ThermostatSetpointDualSetpoint thermostat(model);
+    thermostat.setCoolingSetpointTemperatureSchedule(schedule);
+    thermalZone.setThermostatSetpointDualSetpoint(thermostat);
+  }
+
+  std::vector<model::ModelObject> thermalZones = subsetCastVector<model::ModelObject>(model.getModelObjects<model::ThermalZone>());
+  auto gridController = new ThermalZonesGridController(false, "Thermal Zones", IddObjectType::OS_ThermalZone, model, thermalZones);
+
+  OSGridView gridView(gridController, "Thermal Zones", "Drop\nZone", false);
+  gridView.setVirtualized(true);
+  gridView.refreshAll();
+
+  int column = -1;
+  for (int j = 0; j < gridController->columnCount(); ++j){
+    if (gridController->cellText(0, j) == QString("Cooling Thermostat\nSchedule")){
+      column = j;
+    }
+  }
+  ASSERT_LE(0, column);
+
+  // a row past the header chunk, painted from cached text
+  int row = OSGridView::ROWS_PER_LAYOUT + 20;
+  std::vector<QString> text = gridView.rowText(row);
+  ASSERT_LT(column, static_cast<int>(text.size()));
+  EXPECT_EQ(QString("Cooling Schedule"), text[column]);
+
+  // the schedule is not the row's own object, renaming it must still drop the cached text
+  schedule.setName("Renamed Schedule");
+  text = gridView.rowText(row);
+  ASSERT_LT(column, static_cast<int>(text.size()));
+  EXPECT_EQ(QString("Renamed Schedule"), text[column]);
+}
+
+TEST_F(OpenStudioLibFixture, OSGridView_Virtualized_Benchmark)
+{
+  // logs the time to open and refresh a 5000 row grid, asserts nothing about it
+  model::Model model;
+  for (unsigned i = 0; i < 5000; ++i){
+    model::ThermalZone thermalZone(model);
+  }
+
+  std::vector<model::ModelObject> thermalZones = subsetCastVector<model::ModelObject>(model.getModelObjects<model::ThermalZone>());
+  auto gridController = new ThermalZonesGridController(false, "Thermal Zones", IddObjectType::OS_ThermalZone, model, thermalZones);
+
+  OSGridView gridView(gridController, "Thermal Zones", "Drop\nZone", false);
+  gridView.setVirtualized(true);
+
+  boost::timer t;
+  gridView.refreshAll();
+  double open = t.elapsed();
+  EXPECT_EQ(5001, gridController->rowCount());
+
+  t.restart();
+  for (int row = 1; row < gridController->rowCount(); row += 250){
+    gridView.refreshRow(row);
+  }
+  double rowRefresh = t.elapsed();
+
+  t.restart();
+  gridView.refreshAll();
+  double refresh = t.elapsed();
+  EXPECT_EQ(5001, gridController->rowCount());
+
+  LOG_FREE(Info, "OSGridView", "5000 thermal zones, virtualized open: " << open << " refresh: " << refresh
+           << " 20 row refreshes: " << rowRefresh);
+}
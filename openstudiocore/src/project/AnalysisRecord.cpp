@@ -185,6 +185,76 @@ namespace detail {
     return result;
   }
 
+  unsigned AnalysisRecord_Impl::numDataPointRecords() const {
+    ProjectDatabase database = projectDatabase();
+    QSqlQuery query(*(database.qSqlDatabase()));
+    query.prepare(toQString("SELECT COUNT(*) FROM " + DataPointRecord::databaseTableName() +
+        " WHERE analysisRecordId=:analysisRecordId" ));
+    query.bindValue(":analysisRecordId",id());
+    assertExec(query);
+    if (query.first()) {
+      return query.value(0).toUInt();
+    }
+    return 0u;
+  }
+
+  std::vector<DataPointRecord> AnalysisRecord_Impl::dataPointRecords(unsigned offset,
+                                                                     unsigned limit) const
+  {
+    DataPointRecordVector result;
+
+    ProjectDatabase database = projectDatabase();
+    QSqlQuery query(*(database.qSqlDatabase()));
+    query.prepare(toQString("SELECT * FROM " + DataPointRecord::databaseTableName() +
+        " WHERE analysisRecordId=:analysisRecordId ORDER BY id LIMIT :limit OFFSET :offset" ));
+    query.bindValue(":analysisRecordId",id());
+    query.bindValue(":limit",limit);
+    query.bindValue(":offset",offset);
+    assertExec(query);
+    while (query.next()) {
+      result.push_back(DataPointRecord::factoryFromQuery(query, database).get());
+    }
+
+    return result;
+  }
+
+  std::vector<DataPointRecordSummary> AnalysisRecord_Impl::dataPointRecordSummaries() const {
+    DataPointRecordSummaryVector result;
+
+    ProjectDatabase database = projectDatabase();
+    QSqlQuery query(*(database.qSqlDatabase()));
+    query.prepare(toQString("SELECT " + DataPointRecordSummary::selectColumns() + " FROM " +
+        DataPointRecord::databaseTableName() + " WHERE analysisRecordId=:analysisRecordId ORDER BY id" ));
+    query.bindValue(":analysisRecordId",id());
+    assertExec(query);
+    while (query.next()) {
+      result.push_back(DataPointRecordSummary(query, database));
+    }
+
+    return result;
+  }
+
+  std::vector<DataPointRecordSummary> AnalysisRecord_Impl::dataPointRecordSummaries(unsigned offset,
+                                                                                    unsigned limit) const
+  {
+    DataPointRecordSummaryVector result;
+
+    ProjectDatabase database = projectDatabase();
+    QSqlQuery query(*(database.qSqlDatabase()));
+    query.prepare(toQString("SELECT " + DataPointRecordSummary::selectColumns() + " FROM " +
+        DataPointRecord::databaseTableName() +
+        " WHERE analysisRecordId=:analysisRecordId ORDER BY id LIMIT :limit OFFSET :offset" ));
+    query.bindValue(":analysisRecordId",id());
+    query.bindValue(":limit",limit);
+    query.bindValue(":offset",offset);
+    assertExec(query);
+    while (query.next()) {
+      result.push_back(DataPointRecordSummary(query, database));
+    }
+
+    return result;
+  }
+
   std::vector<DataPointRecord> AnalysisRecord_Impl::incompleteDataPointRecords() const {
     DataPointRecordVector result;
 
@@ -855,6 +925,24 @@ std::vector<DataPointRecord> AnalysisRecord::dataPointRecords() const {
   return getImpl<detail::AnalysisRecord_Impl>()->dataPointRecords();
 }
 
+unsigned AnalysisRecord::numDataPointRecords() const {
+  return getImpl<detail::AnalysisRecord_Impl>()->numDataPointRecords();
+}
+
+std::vector<DataPointRecord> AnalysisRecord::dataPointRecords(unsigned offset, unsigned limit) const {
+  return getImpl<detail::AnalysisRecord_Impl>()->dataPointRecords(offset,limit);
+}
+
+std::vector<DataPointRecordSummary> AnalysisRecord::dataPointRecordSummaries() const {
+  return getImpl<detail::AnalysisRecord_Impl>()->dataPointRecordSummaries();
+}
+
+std::vector<DataPointRecordSummary> AnalysisRecord::dataPointRecordSummaries(unsigned offset,
+                                                                           unsigned limit) const
+{
+  return getImpl<detail::AnalysisRecord_Impl>()->dataPointRecordSummaries(offset,limit);
+}
+
 std::vector<DataPointRecord> AnalysisRecord::incompleteDataPointRecords() const {
   return getImpl<detail::AnalysisRecord_Impl>()->incompleteDataPointRecords();
 }
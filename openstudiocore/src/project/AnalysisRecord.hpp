@@ -33,6 +33,7 @@ class ProblemRecord;
 class AlgorithmRecord;
 class FileReferenceRecord;
 class DataPointRecord;
+class DataPointRecordSummary;
 
 namespace detail {
 
@@ -132,6 +133,22 @@ class PROJECT_API AnalysisRecord : public ObjectRecord {
    *  AnalysisRecord. */
   std::vector<DataPointRecord> dataPointRecords() const;
 
+  /** Returns the number of \link DataPointRecord DataPointRecords \endlink (children) of this 
+   *  AnalysisRecord without loading them. */
+  unsigned numDataPointRecords() const;
+
+  /** Returns up to limit of the dataPointRecords, starting at offset, in the order they were 
+   *  first saved. Use to page through large analyses without loading every record at once. */
+  std::vector<DataPointRecord> dataPointRecords(unsigned offset, unsigned limit) const;
+
+  /** Returns summaries of all the dataPointRecords. Only the columns in DataPointRecordSummary 
+   *  are read, and no DataPointRecords are loaded. */
+  std::vector<DataPointRecordSummary> dataPointRecordSummaries() const;
+
+  /** Returns up to limit of the dataPointRecordSummaries, starting at offset, in the order the 
+   *  records were first saved. */
+  std::vector<DataPointRecordSummary> dataPointRecordSummaries(unsigned offset, unsigned limit) const;
+
   /** Returns the DataPointRecords with complete == false. */
   std::vector<DataPointRecord> incompleteDataPointRecords() const;
 
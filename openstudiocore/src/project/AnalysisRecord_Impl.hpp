@@ -43,6 +43,7 @@ class ProblemRecord;
 class AlgorithmRecord;
 class FileReferenceRecord;
 class DataPointRecord;
+class DataPointRecordSummary;
 
 namespace detail {
 
@@ -104,6 +105,15 @@ namespace detail {
      *  AnalysisRecord. */
     std::vector<DataPointRecord> dataPointRecords() const;
 
+    /** Return the number of DataPointRecords (children) of this AnalysisRecord. */
+    unsigned numDataPointRecords() const;
+
+    std::vector<DataPointRecord> dataPointRecords(unsigned offset, unsigned limit) const;
+
+    std::vector<DataPointRecordSummary> dataPointRecordSummaries() const;
+
+    std::vector<DataPointRecordSummary> dataPointRecordSummaries(unsigned offset, unsigned limit) const;
+
     /** Return the DataPointRecords with complete == false. */
     std::vector<DataPointRecord> incompleteDataPointRecords() const;
 
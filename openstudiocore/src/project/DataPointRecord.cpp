@@ -1164,6 +1164,115 @@ DataPointRecord::DataPointRecord(std::shared_ptr<detail::DataPointRecord_Impl> i
 {}
 /// @endcond
 
+DataPointRecordSummary::DataPointRecordSummary(const QSqlQuery& query, ProjectDatabase& database)
+  : m_complete(false), m_failed(false), m_selected(false)
+{
+  OS_ASSERT(query.isValid());
+  OS_ASSERT(query.isActive());
+  OS_ASSERT(query.isSelect());
+
+  // column order is that of selectColumns
+  QVariant value;
+
+  value = query.value(0);
+  OS_ASSERT(value.isValid() && !value.isNull());
+  m_id = value.toInt();
+
+  value = query.value(1);
+  OS_ASSERT(value.isValid() && !value.isNull());
+  m_handle = toUUID(value.toString().toStdString());
+
+  // a loaded record may hold changes that have not been saved yet
+  if (boost::optional<Record> loaded = database.findLoadedRecord(m_handle)) {
+    DataPointRecord dataPointRecord = loaded->cast<DataPointRecord>();
+    m_name = dataPointRecord.name();
+    m_displayName = dataPointRecord.displayName();
+    m_complete = dataPointRecord.complete();
+    m_failed = dataPointRecord.failed();
+    m_selected = dataPointRecord.selected();
+    m_directory = dataPointRecord.directory();
+    m_topLevelJobUUID = dataPointRecord.topLevelJobUUID();
+    return;
+  }
+
+  value = query.value(2);
+  if (value.isValid() && !value.isNull()) {
+    m_name = value.toString().toStdString();
+  }
+
+  value = query.value(3);
+  if (value.isValid() && !value.isNull()) {
+    m_displayName = value.toString().toStdString();
+  }
+
+  value = query.value(4);
+  OS_ASSERT(value.isValid() && !value.isNull());
+  m_complete = value.toBool();
+
+  value = query.value(5);
+  OS_ASSERT(value.isValid() && !value.isNull());
+  m_failed = value.toBool();
+
+  value = query.value(6);
+  OS_ASSERT(value.isValid() && !value.isNull());
+  m_selected = value.toBool();
+
+  value = query.value(7);
+  OS_ASSERT(value.isValid() && !value.isNull());
+  m_directory = toPath(value.toString());
+
+  value = query.value(8);
+  if (value.isValid() && !value.isNull() && !value.toString().isEmpty()) {
+    m_topLevelJobUUID = openstudio::UUID(value.toString());
+  }
+}
+
+std::string DataPointRecordSummary::selectColumns() {
+  return "id, handle, name, displayName, complete, failed, selected, directory, topLevelJobUUID";
+}
+
+int DataPointRecordSummary::id() const {
+  return m_id;
+}
+
+UUID DataPointRecordSummary::handle() const {
+  return m_handle;
+}
+
+std::string DataPointRecordSummary::name() const {
+  return m_name;
+}
+
+std::string DataPointRecordSummary::displayName() const {
+  return m_displayName;
+}
+
+bool DataPointRecordSummary::complete() const {
+  return m_complete;
+}
+
+bool DataPointRecordSummary::failed() const {
+  return m_failed;
+}
+
+bool DataPointRecordSummary::selected() const {
+  return m_selected;
+}
+
+openstudio::path DataPointRecordSummary::directory() const {
+  return m_directory;
+}
+
+boost::optional<openstudio::UUID> DataPointRecordSummary::topLevelJobUUID() const {
+  return m_topLevelJobUUID;
+}
+
+DataPointRecord DataPointRecordSummary::record(ProjectDatabase& database) const {
+  OptionalDataPointRecord result = DataPointRecord::getDataPointRecord(m_id, database);
+  OS_ASSERT(result);
+  return *result;
+}
+
 void DataPointRecord::constructRelatedRecords(const analysis::DataPoint& dataPoint,
                                               AnalysisRecord& analysisRecord,
                                               const ProblemRecord& problemRecord)
@@ -239,6 +239,54 @@ typedef boost::optional<DataPointRecord> OptionalDataPointRecord;
 /** \relates DataPointRecord*/
 typedef std::vector<DataPointRecord> DataPointRecordVector;
 
+/** DataPointRecordSummary is a projection of one row of the DataPointRecords table onto the
+ *  columns needed to list and manage data points. Constructing one does not load the
+ *  DataPointRecord; call record() when more than these columns are needed. */
+class PROJECT_API DataPointRecordSummary {
+ public:
+  /** Constructs from the current row of a query that selected selectColumns(). If the 
+   *  DataPointRecord is already loaded, its in-memory values are used instead. */
+  DataPointRecordSummary(const QSqlQuery& query, ProjectDatabase& database);
+
+  /** Returns the comma-separated list of DataPointRecords columns read by the constructor. */
+  static std::string selectColumns();
+
+  int id() const;
+
+  UUID handle() const;
+
+  std::string name() const;
+
+  std::string displayName() const;
+
+  bool complete() const;
+
+  bool failed() const;
+
+  bool selected() const;
+
+  openstudio::path directory() const;
+
+  boost::optional<openstudio::UUID> topLevelJobUUID() const;
+
+  /** Loads (or returns the already loaded) DataPointRecord this summary describes. */
+  DataPointRecord record(ProjectDatabase& database) const;
+
+ private:
+  int m_id;
+  UUID m_handle;
+  std::string m_name;
+  std::string m_displayName;
+  bool m_complete;
+  bool m_failed;
+  bool m_selected;
+  openstudio::path m_directory;
+  boost::optional<openstudio::UUID> m_topLevelJobUUID;
+};
+
+/** \relates DataPointRecordSummary*/
+typedef std::vector<DataPointRecordSummary> DataPointRecordSummaryVector;
+
 } // project
 } // openstudio
 
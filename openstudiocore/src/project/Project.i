@@ -244,7 +244,13 @@ OBJECTRECORD_WRAP(DesignOfExperimentsRecord);
 OBJECTRECORD_WRAP(SequentialSearchRecord);
 OBJECTRECORD_WRAP(DakotaAlgorithmRecord);
 OBJECTRECORD_WRAP(DDACEAlgorithmRecord);
+// summaries are only built from a query, and have no default constructor
+%ignore openstudio::project::DataPointRecordSummary::DataPointRecordSummary;
+%ignore std::vector<openstudio::project::DataPointRecordSummary>::vector(size_type);
+%ignore std::vector<openstudio::project::DataPointRecordSummary>::resize(size_type);
 OBJECTRECORD_WRAP(DataPointRecord);
+// DataPointRecordSummary is declared in DataPointRecord.hpp, and returned by AnalysisRecord
+%template(DataPointRecordSummaryVector) std::vector<openstudio::project::DataPointRecordSummary>;
 OBJECTRECORD_WRAP(OptimizationDataPointRecord);
 OBJECTRECORD_WRAP(DataPointValueRecord);
 OBJECTRECORD_WRAP(AnalysisRecord);
@@ -186,6 +186,9 @@ namespace detail {
     // make sure we are the last one using database connection
     OS_ASSERT(m_qSqlDatabase.use_count() == 1);
 
+    // release prepared statements before closing the connection
+    m_preparedQueries.clear();
+
     m_qSqlDatabase->close();
     m_qSqlDatabase.reset(); // actually delete the database before removeDatabase
     QSqlDatabase::removeDatabase(toQString(m_path));
@@ -351,10 +354,13 @@ namespace detail {
 
     ProjectDatabase other(this->shared_from_this());
 
+    // group new and dirty objects by table so each table is written in one pass
+    std::map<std::string, std::vector<Record> > tableRecords;
+
     // save new objects and move to clean
     for(auto & handleNewRecord : m_handleNewRecordMap){
       m_handleCleanRecordMap.insert(handleNewRecord);
-      handleNewRecord.second.saveRow(other);
+      tableRecords[handleNewRecord.second.databaseTableName()].push_back(handleNewRecord.second);
       didChange = true;
     }
     m_handleNewRecordMap.clear();
@@ -362,11 +368,15 @@ namespace detail {
     // save dirty objects and move to clean
     for(auto & handleDirtyRecord : m_handleDirtyRecordMap){
       m_handleCleanRecordMap.insert(handleDirtyRecord);
-      handleDirtyRecord.second.saveRow(other);
+      tableRecords[handleDirtyRecord.second.databaseTableName()].push_back(handleDirtyRecord.second);
       didChange = true;
     }
     m_handleDirtyRecordMap.clear();
 
+    for (auto & tableRecord : tableRecords){
+      this->saveRows(tableRecord.first, tableRecord.second);
+    }
+
     // purge clean records with use count 1
     this->unloadUnusedCleanRecords();
 
@@ -865,6 +875,41 @@ namespace detail {
     return m_qSqlDatabase;
   }
 
+  QSqlQuery ProjectDatabase_Impl::preparedQuery(const std::string& callSite, const std::string& queryString) const
+  {
+    std::pair<std::string, std::string> key(callSite, queryString);
+    auto it = m_preparedQueries.find(key);
+    if (it == m_preparedQueries.end()){
+      QSqlQuery query(*m_qSqlDatabase);
+      query.prepare(toQString(queryString));
+      it = m_preparedQueries.insert(std::make_pair(key, query)).first;
+    }else if (it->second.isActive() && it->second.isSelect()){
+      // call site was re-entered while its results are still being read
+      QSqlQuery query(*m_qSqlDatabase);
+      query.prepare(toQString(queryString));
+      return query;
+    }
+
+    // copies of a QSqlQuery share the prepared statement
+    return it->second;
+  }
+
+  QSqlQuery ProjectDatabase_Impl::preparedUpdateByIdQuery(const std::string& tableName,
+                                                          const UpdateByIdQueryData& queryData,
+                                                          const std::vector<std::string>& columnNames) const
+  {
+    if (m_tableQueryData.find(tableName) == m_tableQueryData.end()){
+      OS_ASSERT(columnNames.size() == queryData.columnValues.size());
+
+      TableQueryData tableQueryData;
+      tableQueryData.updateByIdQueryData = queryData;
+      tableQueryData.columnNames = columnNames;
+      m_tableQueryData.insert(std::make_pair(tableName, tableQueryData));
+    }
+
+    return preparedQuery("saveRow", queryData.queryString);
+  }
+
   boost::optional<Record> ProjectDatabase_Impl::findLoadedRecord(const UUID& handle) const
   {
     boost::optional<Record> result;
@@ -2635,6 +2680,67 @@ namespace detail {
     m_projectDatabaseRecord = projectDatabaseRecord;
   }
 
+  void ProjectDatabase_Impl::saveRows(const std::string& tableName, std::vector<Record>& records)
+  {
+    auto tableIt = m_tableQueryData.find(tableName);
+    if (tableIt == m_tableQueryData.end()){
+      // no row of this table has been written through this database yet, columns are unknown
+      for (Record& record : records){
+        record.saveRow(m_qSqlDatabase);
+      }
+      return;
+    }
+
+    const UpdateByIdQueryData& queryData = tableIt->second.updateByIdQueryData;
+    const std::vector<std::string>& columnNames = tableIt->second.columnNames;
+    unsigned numColumns = columnNames.size();
+
+    // collect each record's values by binding them to the update query, which is not executed;
+    // bindValues binds each value at its column's position
+    std::vector<QVariant> values;
+    values.reserve(records.size() * numColumns);
+    QSqlQuery updateQuery = preparedQuery("saveRows", queryData.queryString);
+    for (const Record& record : records){
+      auto nullIt = queryData.nulls.begin();
+      for (int column : queryData.columnValues){
+        updateQuery.bindValue(column, *nullIt);
+        ++nullIt;
+      }
+      record.bindValues(updateQuery);
+      for (int column : queryData.columnValues){
+        values.push_back(updateQuery.boundValue(column));
+      }
+    }
+
+    // every row already exists, replacing it with all of its columns is the same as updating it;
+    // stay under SQLite's default limit of 999 bound values per statement
+    unsigned rowsPerQuery = std::max(999u / numColumns, 1u);
+    unsigned numRows = records.size();
+    for (unsigned row = 0; row < numRows; row += rowsPerQuery){
+      unsigned n = std::min(rowsPerQuery, numRows - row);
+
+      std::stringstream ss;
+      ss << "INSERT OR REPLACE INTO " << tableName << " (";
+      for (unsigned i = 0; i < numColumns; ++i){
+        ss << (i == 0 ? "" : ", ") << columnNames[i];
+      }
+      ss << ") VALUES ";
+      for (unsigned r = 0; r < n; ++r){
+        ss << (r == 0 ? "(" : ", (");
+        for (unsigned i = 0; i < numColumns; ++i){
+          ss << (i == 0 ? "?" : ", ?");
+        }
+        ss << ")";
+      }
+
+      QSqlQuery query = preparedQuery("saveRows", ss.str());
+      for (unsigned i = 0, offset = row * numColumns; i < n * numColumns; ++i){
+        query.bindValue(i, values[offset + i]);
+      }
+      assertExec(query);
+    }
+  }
+
 } // detail
 
 RemoveUndo::RemoveUndo(UUID handle, RemoveSource removeSource)
@@ -160,6 +160,19 @@ namespace project {
         /// get the qSql database
         std::shared_ptr<QSqlDatabase> qSqlDatabase() const;
 
+        /// get a query which is prepared once per database for each call site, callSite names the
+        /// caller.  A call site must be done with its query before it asks for it again, all values
+        /// must be bound again before each use.  If the cached query is still reading the results
+        /// of a select a new query is prepared rather than clobbering them.
+        QSqlQuery preparedQuery(const std::string& callSite, const std::string& queryString) const;
+
+        /// get the update by id query for a table, remembers the table's columns, named in the
+        /// order of queryData.columnValues, so that save can write all rows of the table in
+        /// multi-row statements
+        QSqlQuery preparedUpdateByIdQuery(const std::string& tableName,
+                                          const UpdateByIdQueryData& queryData,
+                                          const std::vector<std::string>& columnNames) const;
+
         // find record by handle, will check all maps
         boost::optional<Record> findLoadedRecord(const UUID& handle) const;
 
@@ -257,6 +270,14 @@ namespace project {
 
         void setProjectDatabaseRecord(const ProjectDatabaseRecord& projectDatabaseRecord);
 
+        /// write the rows of records all in tableName with multi-row statements
+        void saveRows(const std::string& tableName, std::vector<Record>& records);
+
+        struct TableQueryData {
+          UpdateByIdQueryData updateByIdQueryData;
+          std::vector<std::string> columnNames;
+        };
+
         // members
         openstudio::runmanager::RunManager m_runManager;
         std::shared_ptr<QSqlDatabase> m_qSqlDatabase;
@@ -274,6 +295,11 @@ namespace project {
         std::map<UUID, Record> m_handleRemovedRecordMap;
 
         std::vector<RemoveUndo> m_removeUndos;
+
+        // prepared queries by call site and query string
+        mutable std::map<std::pair<std::string, std::string>, QSqlQuery> m_preparedQueries;
+        // update by id query data by table name
+        mutable std::map<std::string, TableQueryData> m_tableQueryData;
     };
 
   } // detail
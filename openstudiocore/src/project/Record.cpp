@@ -189,13 +189,14 @@ namespace project {
       boost::optional<int> result;
 
       QSqlQuery query(*(projectDatabase.qSqlDatabase()));
-      query.prepare(toQString("SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle"));
+      this->prepareQuery(query, "findIdByHandle", "SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle");
       query.bindValue(":handle", toQString(toString(this->handle())));
 
       assertExec(query);
       if(query.first()){
         result = query.value(0).toInt();
       }
+      query.finish();
 
       return result;
    }
@@ -205,13 +206,15 @@ namespace project {
       QSqlQuery query(*database);
 
       // check there is not already an entry
-      query.prepare(QString::fromStdString("SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle"));
+      this->prepareQuery(query, "insertRow", "SELECT id FROM " + this->databaseTableName() + " WHERE handle=:handle");
       query.bindValue(":handle", toQString(toString(this->handle())));
       assertExec(query);
       OS_ASSERT(!query.first());
+      query.finish();
 
       // do the insert
-      query.prepare(QString::fromStdString("INSERT INTO " + this->databaseTableName() + " (id) VALUES (:id)"));
+      query = QSqlQuery(*database);
+      this->prepareQuery(query, "insertRow", "INSERT INTO " + this->databaseTableName() + " (id) VALUES (:id)");
       query.bindValue(":id", QVariant(QVariant::Int));
       assertExec(query);
 
@@ -221,6 +224,8 @@ namespace project {
         OS_ASSERT(id.isValid() && !id.isNull());
         m_id = id.toInt();
       }else{
+        // do not re-prepare the cached insert query
+        query = QSqlQuery(*database);
         query.prepare(QString::fromStdString("SELECT id FROM " + this->databaseTableName()));
         assertExec(query);
         assertLast(query);
@@ -228,6 +233,29 @@ namespace project {
       }
     }
 
+    void Record_Impl::prepareQuery(QSqlQuery& query, const std::string& callSite, const std::string& queryString) const
+    {
+      std::shared_ptr<ProjectDatabase_Impl> projectDatabaseImpl = m_projectDatabaseWeakImpl.lock();
+      if (projectDatabaseImpl && (projectDatabaseImpl->qSqlDatabase()->driver() == query.driver())){
+        query = projectDatabaseImpl->preparedQuery(callSite, queryString);
+      }else{
+        query.prepare(toQString(queryString));
+      }
+    }
+
+    void Record_Impl::prepareUpdateByIdQuery(QSqlQuery& query,
+                                             const std::string& tableName,
+                                             const UpdateByIdQueryData& queryData,
+                                             const std::vector<std::string>& columnNames) const
+    {
+      std::shared_ptr<ProjectDatabase_Impl> projectDatabaseImpl = m_projectDatabaseWeakImpl.lock();
+      if (projectDatabaseImpl && (projectDatabaseImpl->qSqlDatabase()->driver() == query.driver())){
+        query = projectDatabaseImpl->preparedUpdateByIdQuery(tableName, queryData, columnNames);
+      }else{
+        query.prepare(QString::fromStdString(queryData.queryString));
+      }
+    }
+
     void Record_Impl::removeRow(const std::shared_ptr<QSqlDatabase> &database)
     {
       QSqlQuery query(*database);
@@ -174,11 +174,31 @@ namespace project {
         /// do we have values to revert to
         bool haveLastValues() const;
 
+        /// prepare query, shares the statement cached by this record's database for callSite if query is on that database
+        void prepareQuery(QSqlQuery& query, const std::string& callSite, const std::string& queryString) const;
+
+        /// prepare query to update by id, shares the statement cached by this record's database if possible
+        void prepareUpdateByIdQuery(QSqlQuery& query,
+                                    const std::string& tableName,
+                                    const UpdateByIdQueryData& queryData,
+                                    const std::vector<std::string>& columnNames) const;
+
+        template<typename T>
+        static std::vector<std::string> updateByIdColumnNames(const UpdateByIdQueryData& queryData) {
+          std::vector<std::string> result;
+          for (int columnValue : queryData.columnValues){
+            result.push_back(T::ColumnsType::valueName(columnValue));
+          }
+          return result;
+        }
+
         /// get the query to update by id
         template<typename T>
         void makeUpdateByIdQuery(QSqlQuery& query) const {
           UpdateByIdQueryData queryData = T::updateByIdQueryData();
-          query.prepare(QString::fromStdString(queryData.queryString));
+          // column names in the order of the positions bindValues binds to
+          static const std::vector<std::string> columnNames = updateByIdColumnNames<T>(queryData);
+          this->prepareUpdateByIdQuery(query, T::databaseTableName(), queryData, columnNames);
           auto colIndexIt = queryData.columnValues.begin();
           auto colIndexItEnd = queryData.columnValues.end();
           std::vector<QVariant>::const_iterator nullIt = queryData.nulls.begin();
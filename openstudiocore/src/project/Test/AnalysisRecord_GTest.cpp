@@ -52,6 +52,8 @@
 
 #include "../../utilities/core/FileReference.hpp"
 
+#include <boost/timer.hpp>
+
 using namespace openstudio;
 using namespace openstudio::analysis;
 using namespace openstudio::project;
@@ -234,6 +236,31 @@ TEST_F(ProjectFixture,AnalysisRecord_AddAndRemoveDataPoints) {
     EXPECT_TRUE(measureRecords[1].optionalCast<RubyMeasureRecord>());
     EXPECT_EQ(5u,analysisRecord.dataPointRecords().size());
     EXPECT_TRUE(analysisRecord.completeDataPointRecords().empty());
+
+    // pages and summaries list the same records in the same order
+    EXPECT_EQ(5u,analysisRecord.numDataPointRecords());
+    DataPointRecordSummaryVector summaries = analysisRecord.dataPointRecordSummaries();
+    ASSERT_EQ(5u,summaries.size());
+    DataPointRecordVector page = analysisRecord.dataPointRecords(1u,2u);
+    ASSERT_EQ(2u,page.size());
+    EXPECT_EQ(summaries[1].handle(),page[0].handle());
+    EXPECT_EQ(summaries[2].handle(),page[1].handle());
+    EXPECT_TRUE(analysisRecord.dataPointRecords(5u,2u).empty());
+    DataPointRecordSummaryVector summaryPage = analysisRecord.dataPointRecordSummaries(3u,5u);
+    ASSERT_EQ(2u,summaryPage.size());
+    EXPECT_EQ(summaries[3].handle(),summaryPage[0].handle());
+    EXPECT_EQ(summaries[4].handle(),summaryPage[1].handle());
+    for (const DataPointRecordSummary& summary : summaries) {
+      DataPointRecord dataPointRecord = summary.record(database);
+      EXPECT_EQ(summary.id(),dataPointRecord.id());
+      EXPECT_EQ(summary.handle(),dataPointRecord.handle());
+      EXPECT_EQ(summary.name(),dataPointRecord.name());
+      EXPECT_EQ(summary.complete(),dataPointRecord.complete());
+      EXPECT_EQ(summary.failed(),dataPointRecord.failed());
+      EXPECT_EQ(summary.selected(),dataPointRecord.selected());
+      EXPECT_EQ(summary.directory(),dataPointRecord.directory());
+      EXPECT_EQ(summary.topLevelJobUUID(),dataPointRecord.topLevelJobUUID());
+    }
   }
 
   analysis.clearDirtyFlag();
@@ -294,6 +321,145 @@ TEST_F(ProjectFixture,AnalysisRecord_AddAndRemoveDataPoints) {
   EXPECT_TRUE(test);
 }
 
+TEST_F(ProjectFixture,AnalysisRecord_SaveAndReopen) {
+  // analysis whose data points are joined to the measures they select
+  Analysis analysis("My Analysis",
+                    Problem("My Problem",VariableVector(),runmanager::Workflow()),
+                    FileReferenceType::OSM);
+  Problem problem = analysis.problem();
+
+  std::stringstream ss;
+  for (int i = 0; i < 3; ++i) {
+    MeasureVector measures;
+    measures.push_back(NullMeasure());
+    for (int j = 0; j < 2; ++j) {
+      ss << "measure" << i << j << ".rb";
+      measures.push_back(RubyMeasure(toPath(ss.str()),
+                                     FileReferenceType::OSM,
+                                     FileReferenceType::OSM,true));
+      ss.str("");
+    }
+    ss << "Variable " << i+1;
+    problem.push(MeasureGroup(ss.str(),measures));
+    ss.str("");
+  }
+
+  std::vector< std::vector<QVariant> > allValues;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      std::vector<QVariant> values;
+      values.push_back(i);
+      values.push_back(j);
+      values.push_back((i + j) % 3);
+      OptionalDataPoint dataPoint = problem.createDataPoint(values);
+      ASSERT_TRUE(dataPoint);
+      EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+      allValues.push_back(values);
+    }
+  }
+
+  {
+    ProjectDatabase database = getCleanDatabase("AnalysisRecord_SaveAndReopen");
+    bool transactionStarted = database.startTransaction();
+    EXPECT_TRUE(transactionStarted);
+    AnalysisRecord analysisRecord(analysis,database);
+    EXPECT_TRUE(database.save());
+    EXPECT_TRUE(database.commitTransaction());
+  }
+
+  // read back through a new connection so every row comes from the file
+  ProjectDatabase database = getExistingDatabase("AnalysisRecord_SaveAndReopen");
+  AnalysisRecordVector analysisRecords = AnalysisRecord::getAnalysisRecords(database);
+  ASSERT_EQ(1u,analysisRecords.size());
+  EXPECT_EQ(analysis.uuid(),analysisRecords[0].handle());
+  EXPECT_EQ(analysis.versionUUID(),analysisRecords[0].uuidLast());
+  EXPECT_EQ(analysis.name(),analysisRecords[0].name());
+
+  Analysis loaded = analysisRecords[0].analysis();
+  ASSERT_EQ(3u,loaded.problem().variables().size());
+  for (int i = 0; i < 3; ++i) {
+    MeasureGroup original = analysis.problem().variables()[i].cast<MeasureGroup>();
+    MeasureGroup reloaded = loaded.problem().variables()[i].cast<MeasureGroup>();
+    EXPECT_EQ(original.uuid(),reloaded.uuid());
+    EXPECT_EQ(original.name(),reloaded.name());
+    ASSERT_EQ(original.numMeasures(false),reloaded.numMeasures(false));
+    for (unsigned j = 0, n = original.numMeasures(false); j < n; ++j) {
+      EXPECT_EQ(original.getMeasure(j).uuid(),reloaded.getMeasure(j).uuid());
+    }
+  }
+
+  DataPointRecordVector dataPointRecords = analysisRecords[0].dataPointRecords();
+  ASSERT_EQ(allValues.size(),dataPointRecords.size());
+  for (const DataPointRecord& dataPointRecord : dataPointRecords) {
+    OptionalDataPoint dataPoint = analysis.getDataPointByUUID(dataPointRecord.handle());
+    ASSERT_TRUE(dataPoint);
+    EXPECT_EQ(dataPoint->versionUUID(),dataPointRecord.uuidLast());
+    // variable values are read through the data point to measure join rows
+    EXPECT_EQ(dataPoint->variableValues(),dataPointRecord.variableValues());
+
+    OptionalDataPoint loadedDataPoint = loaded.getDataPointByUUID(dataPointRecord.handle());
+    ASSERT_TRUE(loadedDataPoint);
+    EXPECT_EQ(dataPoint->variableValues(),loadedDataPoint->variableValues());
+  }
+}
+
+TEST_F(ProjectFixture,AnalysisRecord_SaveBenchmark) {
+  // logs the time to create and save the records of a large synthetic analysis, asserts nothing
+  // about it
+  Analysis analysis("Large Analysis",
+                    Problem("Large Problem",VariableVector(),runmanager::Workflow()),
+                    FileReferenceType::OSM);
+  Problem problem = analysis.problem();
+
+  int numVariables = 10;
+  int numMeasures = 10;
+  std::stringstream ss;
+  for (int i = 0; i < numVariables; ++i) {
+    MeasureVector measures;
+    measures.push_back(NullMeasure());
+    for (int j = 1; j < numMeasures; ++j) {
+      ss << "measure" << i << "_" << j << ".rb";
+      measures.push_back(RubyMeasure(toPath(ss.str()),
+                                     FileReferenceType::OSM,
+                                     FileReferenceType::OSM,true));
+      ss.str("");
+    }
+    ss << "Variable " << i+1;
+    problem.push(MeasureGroup(ss.str(),measures));
+    ss.str("");
+  }
+
+  unsigned numDataPoints = 2000;
+  for (unsigned k = 0; k < numDataPoints; ++k) {
+    // digits of k pick the measures, so every data point is distinct
+    std::vector<QVariant> values;
+    unsigned remainder = k;
+    for (int i = 0; i < numVariables; ++i) {
+      values.push_back(static_cast<int>(remainder % numMeasures));
+      remainder /= numMeasures;
+    }
+    OptionalDataPoint dataPoint = problem.createDataPoint(values);
+    ASSERT_TRUE(dataPoint);
+    EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+  }
+
+  ProjectDatabase database = getCleanDatabase("AnalysisRecord_SaveBenchmark");
+  boost::timer t;
+  bool transactionStarted = database.startTransaction();
+  EXPECT_TRUE(transactionStarted);
+  AnalysisRecord analysisRecord(analysis,database);
+  double createTime = t.elapsed();
+  t.restart();
+  EXPECT_TRUE(database.save());
+  EXPECT_TRUE(database.commitTransaction());
+  double saveTime = t.elapsed();
+
+  EXPECT_EQ(numDataPoints,analysisRecord.dataPointRecords().size());
+  LOG(Info,"Analysis with " << numVariables << " measure groups of " << numMeasures << " measures and "
+      << numDataPoints << " data points, records created in " << createTime << " s, saved in "
+      << saveTime << " s");
+}
+
 TEST_F(ProjectFixture,AnalysisRecord_SetProblem) {
   // create an analysis with data points
   Problem problem1("Minimal Problem",VariableVector(),runmanager::Workflow());
@@ -365,3 +365,32 @@ TEST_F(ProjectFixture, AttributeRecord_FromScratch_Database)
   EXPECT_EQ("54.23",record2.attributeValueAsString());
 }
 
+TEST_F(ProjectFixture, AttributeRecord_SaveManyAndReload)
+{
+  // enough rows to take several multi-row statements
+  unsigned numAttributes = 2000;
+  {
+    ProjectDatabase database = getCleanDatabase("AttributeRecord_SaveManyAndReload");
+
+    FileReferenceRecord model(FileReference(toPath("./in.osm")),database);
+    for (unsigned i = 0; i < numAttributes; ++i) {
+      AttributeRecord attributeRecord(Attribute("attribute" + std::to_string(i), static_cast<double>(i), std::string("m")), model);
+    }
+
+    EXPECT_TRUE(database.save());
+  }
+
+  {
+    ProjectDatabase database = getExistingDatabase("AttributeRecord_SaveManyAndReload");
+
+    std::vector<AttributeRecord> attributeRecords = AttributeRecord::getAttributeRecords(database);
+    ASSERT_EQ(numAttributes, attributeRecords.size());
+    for (const AttributeRecord& attributeRecord : attributeRecords) {
+      std::string name = attributeRecord.name();
+      ASSERT_EQ(0u, name.find("attribute"));
+      EXPECT_EQ(std::stod(name.substr(9)), attributeRecord.attributeValueAsDouble());
+      ASSERT_TRUE(attributeRecord.attributeUnits());
+      EXPECT_EQ("m", attributeRecord.attributeUnits().get());
+    }
+  }
+}
@@ -57,6 +57,7 @@
 #include <QDir>
 #include <QDateTime>
 #include <QThread>
+#include <QtConcurrentMap>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/regex.hpp>
@@ -959,153 +960,306 @@ namespace radiance {
     }
   }
 
-  void ForwardTranslator::buildingSpaces(const openstudio::path &t_radDir, const std::vector<openstudio::model::Space> &t_spaces,
-      std::vector<openstudio::path> &t_outfiles)
+  // values read from the model for one surface, shading surface, or interior partition surface, or one of their sub surfaces
+  struct ForwardTranslator::SurfaceData
+  {
+    SurfaceData()
+      : hasConstruction(false), isSolarDiffusing(false), hasFrameAndDivider(false)
+    {}
+
+    std::string name;
+    std::string constructionName;
+    bool hasConstruction;
+    boost::optional<double> interiorVisibleAbsorptance;
+    boost::optional<double> exteriorVisibleAbsorptance;
+    openstudio::Point3dVector polygon;
+    openstudio::Vector3d outwardNormal;
+
+    // sub surfaces only
+    boost::optional<model::ConstructionBase> construction;
+    bool isSolarDiffusing;
+    std::string subSurfaceType;
+    boost::optional<double> visibleTransmittance;
+    boost::optional<model::ShadingControl> shadingControl;
+    bool hasFrameAndDivider;
+    boost::optional<double> outsideRevealDepth;
+    boost::optional<double> insideRevealDepth;
+    boost::optional<double> insideSillDepth;
+
+    std::vector<SurfaceData> subSurfaces;
+  };
+
+  // everything translateSpace needs from the model for one space, read on the calling thread by readSpace
+  struct ForwardTranslator::SpaceData
+  {
+    std::string name;
+    std::vector<SurfaceData> surfaces;
+    std::vector<SurfaceData> shadingSurfaces;
+    std::vector<SurfaceData> interiorPartitionSurfaces;
+    std::vector<std::pair<openstudio::Point3d, openstudio::Vector3d> > daylightingControls;
+    std::vector<std::pair<openstudio::Point3d, openstudio::Vector3dVector> > glareSensors;
+    std::vector<std::pair<openstudio::Handle, std::vector<openstudio::Point3d> > > illuminanceMaps;
+  };
+
+  // a glazed sub surface found while translating a space, assigned to a window group when spaces are merged
+  struct ForwardTranslator::SpaceWindow
+  {
+    SpaceWindow(const openstudio::Vector3d& t_outwardNormal, const SurfaceData& t_subSurface, const openstudio::Point3dVector& t_polygon)
+      : outwardNormal(t_outwardNormal), subSurface(&t_subSurface), polygon(t_polygon),
+        tVis(0.0), tn(0.0)
+    {}
+
+    openstudio::Vector3d outwardNormal;
+    const SurfaceData* subSurface;
+    openstudio::Point3dVector polygon;
+    std::string subSurfaceName;
+    std::string subSurfaceType;
+    double tVis;
+    double tn;
+    std::string rMaterial;
+    std::string matString;
+  };
+
+  // everything translateSpace produces for one space, nothing here is shared with other spaces
+  struct ForwardTranslator::SpaceTranslation
   {
-    std::vector<std::string> space_names;
+    explicit SpaceTranslation(const model::Space& t_space)
+      : space(t_space)
+    {}
+
+    model::Space space;
+    SpaceData data;
+    std::string spaceName;
+    std::string geometry;
+    std::set<std::string> materials;
+    std::vector<SpaceWindow> windows;
+    boost::optional<std::string> sensors;
+    boost::optional<std::string> glareSensors;
+    boost::optional<std::string> map;
+    boost::optional<openstudio::Handle> mapHandle;
+    std::vector<std::string> warnings;
+    boost::optional<std::string> error;
+  };
+
+  void ForwardTranslator::readSpace(SpaceTranslation& t_translation)
+  {
+    const openstudio::model::Space& space = t_translation.space;
+    SpaceData& data = t_translation.data;
 
-    for (const auto & space : t_spaces)
+    data.name = space.name().get();
+
+    for (const auto & surface : space.surfaces())
     {
-      std::string space_name = cleanName(space.name().get());
+      // skip if air wall
+      if (surface.isAirWall()){
+        continue;
+      }
 
-      space_names.push_back(space_name);
-      LOG(Debug, "Processing space: " << space_name);
+      SurfaceData surfaceData;
+      surfaceData.name = surface.name().get();
+      surfaceData.constructionName = surface.getString(2).get();
+      surfaceData.interiorVisibleAbsorptance = surface.interiorVisibleAbsorptance();
+      surfaceData.polygon = openstudio::radiance::ForwardTranslator::getPolygon(surface);
+      surfaceData.outwardNormal = surface.outwardNormal();
 
-      // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#Space = " + space_name + "\n";
+      for (const auto & subSurface : surface.subSurfaces())
+      {
+        SurfaceData subSurfaceData;
+        subSurfaceData.name = subSurface.name().get();
+        subSurfaceData.construction = subSurface.construction();
+        if (!subSurfaceData.construction){
+          surfaceData.subSurfaces.push_back(subSurfaceData);
+          continue;
+        }
+        subSurfaceData.hasConstruction = true;
+        subSurfaceData.isSolarDiffusing = subSurfaceData.construction->isSolarDiffusing();
+        subSurfaceData.subSurfaceType = subSurface.subSurfaceType();
+        subSurfaceData.polygon = openstudio::radiance::ForwardTranslator::getPolygon(subSurface);
+        subSurfaceData.outwardNormal = subSurface.outwardNormal();
+
+        std::string subSurfaceUpCase = boost::algorithm::to_upper_copy(subSurfaceData.subSurfaceType);
+        if (subSurfaceUpCase == "FIXEDWINDOW"
+            || subSurfaceUpCase == "OPERABLEWINDOW"
+            || subSurfaceUpCase == "GLASSDOOR"
+            || subSurfaceUpCase == "SKYLIGHT")
+        {
+          subSurfaceData.visibleTransmittance = subSurface.visibleTransmittance();
+          subSurfaceData.shadingControl = subSurface.shadingControl();
+        } else if (subSurfaceUpCase == "DOOR") {
+          subSurfaceData.interiorVisibleAbsorptance = subSurface.interiorVisibleAbsorptance();
+          subSurfaceData.exteriorVisibleAbsorptance = subSurface.exteriorVisibleAbsorptance();
+        }
 
-      // loop over surfaces in space
+        boost::optional<model::WindowPropertyFrameAndDivider> frameAndDivider = subSurface.windowPropertyFrameAndDivider();
+        if (frameAndDivider){
+          subSurfaceData.hasFrameAndDivider = true;
 
-      std::vector<openstudio::model::Surface> surfaces = space.surfaces();
+          if (!frameAndDivider->isOutsideRevealDepthDefaulted()){
+            subSurfaceData.outsideRevealDepth = frameAndDivider->outsideRevealDepth();
+          }
+
+          if (!frameAndDivider->isInsideRevealDepthDefaulted()){
+            subSurfaceData.insideRevealDepth = frameAndDivider->insideRevealDepth();
+          }
 
-      for (const auto & surface : surfaces)
+          if (!frameAndDivider->isInsideSillDepthDefaulted()){
+            subSurfaceData.insideSillDepth = frameAndDivider->insideSillDepth();
+          }else{
+            subSurfaceData.insideSillDepth = subSurfaceData.insideRevealDepth;
+          }
+        }
+
+        surfaceData.subSurfaces.push_back(subSurfaceData);
+      }
+
+      data.surfaces.push_back(surfaceData);
+    }
+
+    for (const auto & shadingSurfaceGroup : space.shadingSurfaceGroups())
+    {
+      for (const auto & shadingSurface : shadingSurfaceGroup.shadingSurfaces())
       {
+        SurfaceData surfaceData;
+        surfaceData.name = shadingSurface.name().get();
+        surfaceData.constructionName = shadingSurface.getString(1).get();
+        surfaceData.interiorVisibleAbsorptance = shadingSurface.interiorVisibleAbsorptance();
+        surfaceData.polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
+        data.shadingSurfaces.push_back(surfaceData);
+      }
+    }
 
-        // skip if air wall
-        if (surface.isAirWall()){
-          continue;
+    for (const auto & interiorPartitionSurfaceGroup : space.interiorPartitionSurfaceGroups())
+    {
+      for (const auto & interiorPartitionSurface : interiorPartitionSurfaceGroup.interiorPartitionSurfaces())
+      {
+        SurfaceData surfaceData;
+        surfaceData.name = interiorPartitionSurface.name().get();
+        if (interiorPartitionSurface.construction()){
+          surfaceData.hasConstruction = true;
+          surfaceData.constructionName = interiorPartitionSurface.getString(1).get();
+          surfaceData.interiorVisibleAbsorptance = interiorPartitionSurface.interiorVisibleAbsorptance();
+          surfaceData.exteriorVisibleAbsorptance = interiorPartitionSurface.exteriorVisibleAbsorptance();
+          surfaceData.polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
         }
+        data.interiorPartitionSurfaces.push_back(surfaceData);
+      }
+    }
+
+    for (const auto & control : space.daylightingControls())
+    {
+      data.daylightingControls.push_back(std::make_pair(openstudio::radiance::ForwardTranslator::getReferencePoint(control),
+                                                        openstudio::radiance::ForwardTranslator::getSensorVector(control)));
+    }
+
+    for (const auto & sensor : space.glareSensors())
+    {
+      data.glareSensors.push_back(std::make_pair(openstudio::radiance::ForwardTranslator::getReferencePoint(sensor),
+                                                 openstudio::radiance::ForwardTranslator::getViewVectors(sensor)));
+    }
+
+    for (const auto & map : space.illuminanceMaps())
+    {
+      data.illuminanceMaps.push_back(std::make_pair(map.handle(), openstudio::radiance::ForwardTranslator::getReferencePoints(map)));
+    }
+  }
+
+  void ForwardTranslator::translateSpace(SpaceTranslation& t_translation)
+  {
+    try
+    {
+      const SpaceData& data = t_translation.data;
+
+      std::string space_name = cleanName(data.name);
+      t_translation.spaceName = space_name;
+
+      LOG(Debug, "Processing space: " << space_name);
 
-        std::string surface_name = cleanName(surface.name().get());
+      // split model into zone-based Radiance .rad files
+      t_translation.geometry = "#Space = " + space_name + "\n";
+
+      // loop over surfaces in space
+
+      for (const auto & surface : data.surfaces)
+      {
+
+        std::string surface_name = cleanName(surface.name);
 
         // add surface to space geometry
-        m_radSpaces[space_name] += "#-Surface = " + surface_name + "\n";
+        t_translation.geometry += "#-Surface = " + surface_name + "\n";
 
         // set construction of surface
-        std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "#--constructionName = " + constructionName + "\n";
+        const std::string& constructionName = surface.constructionName;
+        t_translation.geometry += "#--constructionName = " + constructionName + "\n";
 
         // get reflectance
         double interiorVisibleReflectance = 0.5; // default for space surfaces
-        if (surface.interiorVisibleAbsorptance()){
-          double interiorVisibleAbsorptance = surface.interiorVisibleAbsorptance().get();
+        if (surface.interiorVisibleAbsorptance){
+          double interiorVisibleAbsorptance = *surface.interiorVisibleAbsorptance;
           interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
         }
 
-        m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+        t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
 
         // write material to library array
         /// \todo deal with exterior surfaces
-        m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
+        t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
             + "\n0\n0\n5\n" + formatString(interiorVisibleReflectance, 3)
             + " " + formatString(interiorVisibleReflectance, 3)
             + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
         // write surface polygon
-        openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(surface);
+        openstudio::Point3dVector polygon = surface.polygon;
 
-        m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3)
+        t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3)
           + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
         for (const auto & vertex : polygon)
         {
-          m_radSpaces[space_name] += formatString(vertex.x()) + " "
+          t_translation.geometry += formatString(vertex.x()) + " "
             + formatString(vertex.y()) + " "
             + formatString(vertex.z()) + "\n";
         }
 
         // get sub surfaces
-        std::vector<openstudio::model::SubSurface> subSurfaces = surface.subSurfaces();
-
-        for (const auto & subSurface : subSurfaces)
+        for (const auto & subSurface : surface.subSurfaces)
         {
 
           std::string rMaterial = "glass";
           std::string matString = "";
 
-          boost::optional<model::ConstructionBase> construction = subSurface.construction();
-          if (!construction){
-            LOG(Warn, "SubSurface " << subSurface.name().get() << " is not associated with a Construction, it will not be translated.");
+          if (!subSurface.construction){
+            t_translation.warnings.push_back("SubSurface " + subSurface.name + " is not associated with a Construction, it will not be translated.");
             continue;
           }
 
-          boost::optional<model::WindowPropertyFrameAndDivider> frameAndDivider = subSurface.windowPropertyFrameAndDivider();
-
           // get the polygon
-          polygon = openstudio::radiance::ForwardTranslator::getPolygon(subSurface);
+          polygon = subSurface.polygon;
 
-          std::string subSurface_name = cleanName(subSurface.name().get());
+          std::string subSurface_name = cleanName(subSurface.name);
 
-          m_radSpaces[space_name] += "#--SubSurface = " + subSurface_name + "\n";
+          t_translation.geometry += "#--SubSurface = " + subSurface_name + "\n";
 
-          std::string subSurfaceUpCase = boost::algorithm::to_upper_copy(subSurface.subSurfaceType());
+          std::string subSurfaceUpCase = boost::algorithm::to_upper_copy(subSurface.subSurfaceType);
 
           if (subSurfaceUpCase == "FIXEDWINDOW"
               || subSurfaceUpCase == "OPERABLEWINDOW"
               || subSurfaceUpCase == "GLASSDOOR"
               || subSurfaceUpCase == "SKYLIGHT")
           {
-            if (!subSurface.visibleTransmittance())
+            if (!subSurface.visibleTransmittance)
             {
-              LOG(Warn, "Cannot determine visible transmittance for SubSurface " << subSurface.name().get() << ", it will not be translated.");
+              t_translation.warnings.push_back("Cannot determine visible transmittance for SubSurface " + subSurface.name + ", it will not be translated.");
               continue;
             }
 
-            boost::optional<model::ShadingControl> shadingControl = subSurface.shadingControl();
-            
             double visibleTransmittanceMultiplier = 1.0;
-            if (frameAndDivider){
+            if (subSurface.hasFrameAndDivider){
               // DLM: Rob what should we do here?
               visibleTransmittanceMultiplier = 1.0;
             }
 
-            // find window group
-            openstudio::Vector3d outwardNormal = surface.outwardNormal();
-
-            WindowGroup windowGroup = getWindowGroup(outwardNormal, space, *construction, shadingControl, polygon);
-            std::string windowGroup_name = windowGroup.name();
-
-            // get the normal
-            WindowGroupControl control = windowGroup.windowGroupControl();
-            if (control.outwardNormal){
-
-              std::cout << "outward normal:" + formatString(control.outwardNormal->x()) + " " + formatString(control.outwardNormal->y()) + " " + \
-                formatString(control.outwardNormal->z()) + "\n";
-
-            }
-
-            std::string winUpVector = "Z";
-            if (subSurfaceUpCase == "SKYLIGHT"){
-              winUpVector = "Y";
-            }
-
-            if (m_radWindowGroups.find(windowGroup_name) == m_radWindowGroups.end())
-            {
-              m_radWindowGroups[windowGroup_name] = "# OpenStudio Window Group: " + windowGroup_name + "\n";
-              if(windowGroup_name == "WG0"){
-                 m_radWindowGroups[windowGroup_name] += "# All uncontrolled windows, multiple orientations possible, no hemispherical sampling info.\n\n";
-              }
-              else{
-                // 3-phase/rfluxmtx support
-                m_radWindowGroups[windowGroup_name] += "#@rfluxmtx h=kf u=" + winUpVector + " o=output/dc/" + windowGroup_name + ".vmx\n";
-              }
-
-            }
-
-            LOG(Info, "found a " + subSurface.subSurfaceType() + " named '" + subSurface_name + "', windowGroup_name = '" + windowGroup_name + "'");
-
             // set transmittance...
-            double visibleTransmittance = subSurface.visibleTransmittance().get() * visibleTransmittanceMultiplier;
+            double visibleTransmittance = *subSurface.visibleTransmittance * visibleTransmittanceMultiplier;
 
             // convert transmittance(Tn) to transmissivity(tn) for Radiance material
             // tn = (sqrt(.8402528435+.0072522239*Tn*Tn)-.9166530661)/.0036261119/Tn
@@ -1113,19 +1267,19 @@ namespace radiance {
             double tVis = visibleTransmittance;
             double tn = 0;
             if (tVis == 0.0) {
-              LOG(Warn, subSurface_name << " has transmittance of zero.");
+              t_translation.warnings.push_back(subSurface_name + " has transmittance of zero.");
               tn = 0.0;
               LOG(Debug, "Tvis = " << tVis << " (tn = " << tn << ")");
             } else {
               tn = tVis * 1.0895;
               LOG(Debug, "Tvis = " << tVis << " (tn = " << tn << ")");
               if (tVis >= 0.92) {
-                LOG(Warn, "glazing material definition in " + space_name + "; Tvis =" + formatString(tVis, 3) + " is very high. Suspect.");
+                t_translation.warnings.push_back("glazing material definition in " + space_name + "; Tvis =" + formatString(tVis, 3) + " is very high. Suspect.");
               }
             }
 
             // make materials for single phase (AKA two-phase, depends on whom you talk to)
-            if (construction->isSolarDiffusing()) {
+            if (subSurface.isSolarDiffusing) {
               // create Radiance trans material based on transmittance, 100% diffuse (to match E+ performance)
               // trans formulae (from "Rendering with Radiance", sec. 5.2.6):
               // A7=Ts / ( Td+Ts )
@@ -1162,7 +1316,7 @@ namespace radiance {
               //double nTs = 0.0; // transmitted specularity
 
               if (tVis >= 0.6) {
-                LOG(Warn, "dubious glazing material definition in " + space_name + "; Tvis =" + formatString(tVis, 2) + ", yet diffuse? Suspect.");
+                t_translation.warnings.push_back("dubious glazing material definition in " + space_name + "; Tvis =" + formatString(tVis, 2) + ", yet diffuse? Suspect.");
               }
 
             } else {
@@ -1171,232 +1325,58 @@ namespace radiance {
 
             }
 
-            // write material
-
-            if (windowGroup_name == "WG0"){
-              m_radMaterials.insert("void " + rMaterial + " glaz_" + rMaterial + "_tn-" + formatString(tn, 3) + "\n" + matString + "\n");
-              m_radMaterialsDC.insert("void alias glaz_" + rMaterial + "_tn-" + formatString(tn, 3) + " WG0\n\n");
-
-              // polygon header
-              m_radWindowGroups[windowGroup_name] += "#--SubSurface = " + subSurface_name + "\n";
-              m_radWindowGroups[windowGroup_name] += "#---Tvis = " + formatString(tVis, 4) + " (tn = " + formatString(tn, 4) + ")\n";
-              // write the polygon
-              m_radWindowGroups[windowGroup_name] += "glaz_"+rMaterial+"_tn-"+formatString(tn, 3) + " polygon " + subSurface_name + "\n";
-              m_radWindowGroups[windowGroup_name] += "0\n0\n" + formatString(polygon.size()*3) + "\n";
-              for (Point3dVector::const_reverse_iterator vertex = polygon.rbegin();
-                vertex != polygon.rend();
-                ++vertex)
-              {
-                m_radWindowGroups[windowGroup_name] += "" + formatString(vertex->x()) + " " + formatString(vertex->y()) + " " + formatString(vertex->z()) + "\n";
-              }
-            }
-            else
-            {
-              m_radMaterials.insert("void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n");
-              m_radMaterialsDC.insert("void light " + windowGroup_name + "\n0\n0\n3\n1 1 1\n");
-              m_radMaterialsWG0.insert("void plastic " + windowGroup_name + "\n0\n0\n5\n0 0 0 0 0\n");
-
-              // polygon header
-              m_radWindowGroups[windowGroup_name] += "\n# SubSurface = " + subSurface_name + "\n";
-              m_radWindowGroups[windowGroup_name] += "# Tvis = " + formatString(tVis, 2) + " (tn = " + formatString(tn, 2) + ")\n";
-
-              // write the polygon
-              m_radWindowGroups[windowGroup_name] += windowGroup_name + " polygon " + subSurface_name + "\n";
-              m_radWindowGroups[windowGroup_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n";
-              for (Point3dVector::const_reverse_iterator vertex = polygon.rbegin();
-                vertex != polygon.rend();
-                ++vertex)
-              
-              {
-                m_radWindowGroups[windowGroup_name] += "" + \
-                formatString(vertex->x()) + " " + \
-                formatString(vertex->y()) + " " + \
-                formatString(vertex->z()) + "\n";
-              }
-            }
-
-            // copy required bsdf files into place
-            openstudio::path bsdfoutpath = t_radDir / openstudio::toPath("bsdf");
-
-            if (rMaterial == "glass"){
-
-              // path to write bsdf to
-              openstudio::path uncontrolledBSDFOut = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("/cl_Tn" + formatString(tVis, 2) + ".xml");
-              
-              // add xml file to the collection of crap to copy up
-              t_outfiles.push_back(uncontrolledBSDFOut);
-
-              // get BSDF from BCL
-              boost::optional<openstudio::path> uncontrolledBSDF = getBSDF(tVis, 100, "None");
-              if (uncontrolledBSDF){
-                // copy uncontrolledBSDF
-                boost::filesystem::copy_file(*uncontrolledBSDF, uncontrolledBSDFOut, boost::filesystem::copy_option::overwrite_if_exists);
-              }else{
-                LOG(Warn, "Cannot download BSDF, using default.");
-
-                // read default file
-                QString defaultFile;
-                QFile inFile(":/resources/cl_Tn0.44.xml");
-                if (inFile.open(QFile::ReadOnly)){
-                  QTextStream docIn(&inFile);
-                  defaultFile = docIn.readAll();
-                  inFile.close();
-                }
-
-                // write default file
-                QFile outFile(toQString(uncontrolledBSDFOut));
-                bool opened = outFile.open(QIODevice::WriteOnly);
-                if (!opened){
-                  LOG_AND_THROW("Cannot write file to '" << toString(uncontrolledBSDFOut) << "'");
-                }
-                QTextStream textStream(&outFile);
-                textStream << defaultFile;
-                outFile.close();
-              }
-
-              // path to write bsdf to
-              openstudio::path controlledBSDFOut = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("/cl_Tn" + formatString(tVis, 2) + "_blinds.xml");
-              
-              // add xml file to the collection of crap to copy up
-              t_outfiles.push_back(controlledBSDFOut);
-
-              // get BSDF from BCL
-              boost::optional<openstudio::path> controlledBSDF = getBSDF(tVis, 100, "Blind");
-              if (controlledBSDF){
-                // copy controlledBSDF
-                boost::filesystem::copy_file(*controlledBSDF, controlledBSDFOut, boost::filesystem::copy_option::overwrite_if_exists);
-              }else{
-                LOG(Warn, "Cannot download BSDF, using default.");
-
-                // read default file
-                QString defaultFile;
-                QFile inFile(":/resources/cl_Tn0.44_blinds.xml");
-                if (inFile.open(QFile::ReadOnly)){
-                  QTextStream docIn(&inFile);
-                  defaultFile = docIn.readAll();
-                  inFile.close();
-                }
-
-                // write default file
-                QFile outFile(toQString(uncontrolledBSDFOut));
-                bool opened = outFile.open(QIODevice::WriteOnly);
-                if (!opened){
-                  LOG_AND_THROW("Cannot write file to '" << toString(uncontrolledBSDFOut) << "'");
-                }
-                QTextStream textStream(&outFile);
-                textStream << defaultFile;
-                outFile.close();
-              }
-
-              // store window group normal (may not need anymore with rfluxmtx)
-              // hard coded shade algorithm: on if high solar (2), setpoint 2Klx (2000)
-              m_radDCmats.insert(windowGroup_name + "," + \
-                formatString((control.outwardNormal->x() * -1), 2) + " " + \
-                formatString((control.outwardNormal->y() * -1), 2) + " " + \
-                formatString((control.outwardNormal->z() * -1), 2) + ",2,2000,cl_Tn" + \
-                formatString(tVis, 2) + ".xml,cl_Tn" + formatString(tVis, 2) + "_blinds.xml\n");
-
-            } else if (rMaterial == "trans"){
-
-              // copy uncontrolledBSDF
-              openstudio::path uncontrolledBSDFOut = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("/df_Tn" + formatString(tVis, 2) + ".xml");
-
-              // add xml file to the collection of crap to copy up
-              t_outfiles.push_back(uncontrolledBSDFOut);
-
-              // get BSDF from BCL
-              boost::optional<openstudio::path> uncontrolledBSDF = getBSDF(tVis, 0, "None");
-              if (uncontrolledBSDF){
-                // copy controlledBSDF
-                boost::filesystem::copy_file(*uncontrolledBSDF, uncontrolledBSDFOut, boost::filesystem::copy_option::overwrite_if_exists);
-              }else{
-                LOG(Warn, "Cannot download BSDF, using default.");
-
-                // read default file
-                QString defaultFile;
-                QFile inFile(":/resources/df_Tn0.44.xml");
-                if (inFile.open(QFile::ReadOnly)){
-                  QTextStream docIn(&inFile);
-                  defaultFile = docIn.readAll();
-                  inFile.close();
-                }
-
-                // write default file
-                QFile outFile(toQString(uncontrolledBSDFOut));
-                bool opened = outFile.open(QIODevice::WriteOnly);
-                if (!opened){
-                  LOG_AND_THROW("Cannot write file to '" << toString(uncontrolledBSDFOut) << "'");
-                }
-                QTextStream textStream(&outFile);
-                textStream << defaultFile;
-                outFile.close();
-              }
-
-              // store window group normal (may not need anymore with rfluxmtx)
-              m_radDCmats.insert(windowGroup_name + "," + \
-                formatString((control.outwardNormal->x() * -1), 2) + " " + \
-                formatString((control.outwardNormal->y() * -1), 2) + " " + \
-                formatString((control.outwardNormal->z() * -1), 2) + ",df_Tn" + formatString(tVis, 2) + ".xml\n");
-
-            }
+            SpaceWindow window(surface.outwardNormal, subSurface, polygon);
+            window.subSurfaceName = subSurface_name;
+            window.subSurfaceType = subSurface.subSurfaceType;
+            window.tVis = tVis;
+            window.tn = tn;
+            window.rMaterial = rMaterial;
+            window.matString = matString;
+            t_translation.windows.push_back(window);
 
           } else if (subSurfaceUpCase == "DOOR") {
 
             LOG(Info, "found a door, will set to interior reflectance");
 
-            double interiorVisibleAbsorptance = subSurface.interiorVisibleAbsorptance().get();
-            double exteriorVisibleAbsorptance = subSurface.exteriorVisibleAbsorptance().get();
+            double interiorVisibleAbsorptance = subSurface.interiorVisibleAbsorptance.get();
+            double exteriorVisibleAbsorptance = subSurface.exteriorVisibleAbsorptance.get();
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
             //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            t_translation.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
             // write material
-            m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+            t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " " + \
               formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
             // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n";
+            t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+            t_translation.geometry += "0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
             for (const auto & vertex : polygon)
             {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              t_translation.geometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
             }
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
 
-            LOG(Warn, "subsurface is a tdd dome, not translated (not yet implemented).");
+            t_translation.warnings.push_back("subsurface is a tdd dome, not translated (not yet implemented).");
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDIFFUSER") {
 
-            LOG(Warn, "subsurface is a tdd diffuser, not translated (not yet implemented).");
+            t_translation.warnings.push_back("subsurface is a tdd diffuser, not translated (not yet implemented).");
 
           }
 
           // write reveal surfaces from window frame and divider
-          if (frameAndDivider){
-
-            boost::optional<double> outsideRevealDepth;
-            if (!frameAndDivider->isOutsideRevealDepthDefaulted()){
-              outsideRevealDepth = frameAndDivider->outsideRevealDepth();
-            }
+          if (subSurface.hasFrameAndDivider){
 
-            boost::optional<double> insideRevealDepth;
-            if (!frameAndDivider->isInsideRevealDepthDefaulted()){
-              insideRevealDepth = frameAndDivider->insideRevealDepth();
-            }
+            boost::optional<double> outsideRevealDepth = subSurface.outsideRevealDepth;
+            boost::optional<double> insideRevealDepth = subSurface.insideRevealDepth;
+            boost::optional<double> insideSillDepth = subSurface.insideSillDepth;
 
-            boost::optional<double> insideSillDepth;
-            if (!frameAndDivider->isInsideSillDepthDefaulted()){
-              insideSillDepth = frameAndDivider->insideSillDepth();
-            }else{
-              insideSillDepth = insideRevealDepth;
-            }
-              
-              
-            Vector3d outwardNormal = subSurface.outwardNormal();
+            const Vector3d& outwardNormal = subSurface.outwardNormal;
             size_t N = polygon.size();
             for (size_t i = 0; i < N; ++i)
             {
@@ -1414,20 +1394,20 @@ namespace radiance {
                 double interiorVisibleReflectance = 0.5;
                 double exteriorVisibleReflectance = 0.5;
                 //polygon header
-                m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+                t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                t_translation.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
                 // write material
-                m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                       formatString(interiorVisibleReflectance, 3) + " " + \
                                       formatString(interiorVisibleReflectance, 3) + " " + \
                                       formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                 // write polygon
-                m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-                m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+                t_translation.geometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                t_translation.geometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
               }
 
               if (insideRevealDepth){
@@ -1445,20 +1425,20 @@ namespace radiance {
                 double interiorVisibleReflectance = 0.5;
                 double exteriorVisibleReflectance = 0.5;
                 //polygon header
-                m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+                t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                t_translation.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
                 // write material
-                m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                       formatString(interiorVisibleReflectance, 3) + " " + \
                                       formatString(interiorVisibleReflectance, 3) + " " + \
                                       formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                 // write polygon
-                m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-                m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+                t_translation.geometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                t_translation.geometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
               }
 
               if (insideSillDepth){
@@ -1476,20 +1456,20 @@ namespace radiance {
                 double interiorVisibleReflectance = 0.5;
                 double exteriorVisibleReflectance = 0.5;
                 //polygon header
-                m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+                t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                t_translation.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
                 // write material
-                m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
                                       formatString(interiorVisibleReflectance, 3) + " " + \
                                       formatString(interiorVisibleReflectance, 3) + " " + \
                                       formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                 // write polygon
-                m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-                m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+                t_translation.geometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                t_translation.geometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                t_translation.geometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
               }
 
             }
@@ -1501,44 +1481,41 @@ namespace radiance {
 
       // get shading surfaces
 
-      std::vector<openstudio::model::ShadingSurfaceGroup> shadingSurfaceGroups = space.shadingSurfaceGroups();
-      for (const auto & shadingSurfaceGroup : shadingSurfaceGroups)
       {
-        std::vector<openstudio::model::ShadingSurface> shadingSurfaces = shadingSurfaceGroup.shadingSurfaces();
-        for (const auto & shadingSurface : shadingSurfaces)
+        for (const auto & shadingSurface : data.shadingSurfaces)
         {
-          std::string shadingSurface_name = cleanName(shadingSurface.name().get());
+          std::string shadingSurface_name = cleanName(shadingSurface.name);
 
           // add surface to zone geometry
-          m_radSpaces[space_name] += "#-Surface = " + shadingSurface_name + "\n";
+          t_translation.geometry += "#-Surface = " + shadingSurface_name + "\n";
 
           // set construction of shadingSurface
-          std::string constructionName = shadingSurface.getString(1).get();
-          m_radSpaces[space_name] += "#--constructionName = " + constructionName + "\n";
+          const std::string& constructionName = shadingSurface.constructionName;
+          t_translation.geometry += "#--constructionName = " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25; // default for space shading surfaces
-          if (shadingSurface.interiorVisibleAbsorptance()){
-            double interiorVisibleAbsorptance = shadingSurface.interiorVisibleAbsorptance().get();
+          if (shadingSurface.interiorVisibleAbsorptance){
+            double interiorVisibleAbsorptance = *shadingSurface.interiorVisibleAbsorptance;
             interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
           }
 
           // write material
-          m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+          t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
           // get / write surface polygon
           //
-          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
+          const openstudio::Point3dVector& polygon = shadingSurface.polygon;
+          t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
           shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            t_translation.geometry += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
 
         }
@@ -1546,67 +1523,62 @@ namespace radiance {
 
       //get the interior partition surfaces
 
-      std::vector<openstudio::model::InteriorPartitionSurfaceGroup> interiorPartitionSurfaceGroups = space.interiorPartitionSurfaceGroups();
-      for (const auto & interiorPartitionSurfaceGroup : interiorPartitionSurfaceGroups)
       {
-        std::vector<openstudio::model::InteriorPartitionSurface> interiorPartitionSurfaces = interiorPartitionSurfaceGroup.interiorPartitionSurfaces();
-        for (const auto & interiorPartitionSurface : interiorPartitionSurfaces)
+        for (const auto & interiorPartitionSurface : data.interiorPartitionSurfaces)
         {
 
           // get nice name
 
-          std::string interiorPartitionSurface_name = cleanName(interiorPartitionSurface.name().get());
+          std::string interiorPartitionSurface_name = cleanName(interiorPartitionSurface.name);
 
           // check for construction
 
-          boost::optional<model::ConstructionBase> construction = interiorPartitionSurface.construction();
-          if (!construction){
-            LOG(Warn, "InteriorPartitionSurface " << interiorPartitionSurface.name().get() << " is not associated with a Construction, it will not be translated.");
+          if (!interiorPartitionSurface.hasConstruction){
+            t_translation.warnings.push_back("InteriorPartitionSurface " + interiorPartitionSurface.name + " is not associated with a Construction, it will not be translated.");
             continue;
           }
 
           // add surface to zone geometry
           
-          m_radSpaces[space_name] += "#-Surface = " + interiorPartitionSurface_name + "\n";
+          t_translation.geometry += "#-Surface = " + interiorPartitionSurface_name + "\n";
 
           // set construction of interiorPartitionSurface
-          std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "#--constructionName = " + constructionName + "\n";
+          const std::string& constructionName = interiorPartitionSurface.constructionName;
+          t_translation.geometry += "#--constructionName = " + constructionName + "\n";
 
          // get reflectance
           double interiorVisibleReflectance = 0.5; // set some default
-          if (interiorPartitionSurface.interiorVisibleAbsorptance()){
-            double interiorVisibleAbsorptance = interiorPartitionSurface.interiorVisibleAbsorptance().get();
+          if (interiorPartitionSurface.interiorVisibleAbsorptance){
+            double interiorVisibleAbsorptance = *interiorPartitionSurface.interiorVisibleAbsorptance;
             interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
           }
           
           double exteriorVisibleReflectance = 0.5; // set some default
-          if (interiorPartitionSurface.exteriorVisibleAbsorptance()){
-            double exteriorVisibleAbsorptance = interiorPartitionSurface.exteriorVisibleAbsorptance().get();
+          if (interiorPartitionSurface.exteriorVisibleAbsorptance){
+            double exteriorVisibleAbsorptance = *interiorPartitionSurface.exteriorVisibleAbsorptance;
             exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
           }
 
           // write material
-          m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+          t_translation.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " " + \
             formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+          t_translation.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          t_translation.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
           // get / write surface polygon
 
-          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
+          const openstudio::Point3dVector& polygon = interiorPartitionSurface.polygon;
+          t_translation.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
           interiorPartitionSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
           for (const auto & vertex : polygon)
           {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            t_translation.geometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
           }
         }
       } // interior partitions
 
-      // get luminaires
       ///  \todo fully implement once luminaires are fully supported in model
       //std::vector<openstudio::model::Luminaire> luminaires = space.luminaires();
       //for (const auto & luminaire : luminaires)
@@ -1616,45 +1588,28 @@ namespace radiance {
       //}
 
       // get daylighting control points
-      std::vector<openstudio::model::DaylightingControl> daylightingControls = space.daylightingControls();
-      for (const auto & control : daylightingControls)
+      for (const auto & control : data.daylightingControls)
       {
-        m_radSensors[space_name] = "";
-
-        openstudio::Point3d sensor_point = openstudio::radiance::ForwardTranslator::getReferencePoint(control);
-        openstudio::Vector3d sensor_aimVector = openstudio::radiance::ForwardTranslator::getSensorVector(control);
-        m_radSensors[space_name] += \
+        const openstudio::Point3d& sensor_point = control.first;
+        const openstudio::Vector3d& sensor_aimVector = control.second;
+        t_translation.sensors = \
         formatString(sensor_point.x()) + " " + \
         formatString(sensor_point.y()) + " " + \
         formatString(sensor_point.z()) + " " + \
         formatString(sensor_aimVector.x()) + " " + \
         formatString(sensor_aimVector.y()) + " " + \
         formatString(sensor_aimVector.z()) + "\n";
-
-        // write daylighting controls
-        openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".sns");
-        OFSTREAM file(filename);
-        if (file.is_open()){
-          t_outfiles.push_back(filename);
-          file << m_radSensors[space_name];
-        } else{
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
-
-        LOG(Debug, "Wrote " << space_name << ".sns");
       } // daylighting controls
 
       // get glare sensor
-      std::vector<openstudio::model::GlareSensor> glareSensors = space.glareSensors();
-      for (const auto & sensor : glareSensors)
+      for (const auto & sensor : data.glareSensors)
       {
-        m_radGlareSensors[space_name] = "";
+        t_translation.glareSensors = "";
 
-        openstudio::Point3d sensor_point = openstudio::radiance::ForwardTranslator::getReferencePoint(sensor);
-        // openstudio::Vector3dVector sensor_viewVector = openstudio::radiance::ForwardTranslator::getViewVectors(*sensor);
-        openstudio::Vector3dVector viewVectors = openstudio::radiance::ForwardTranslator::getViewVectors(sensor);
+        const openstudio::Point3d& sensor_point = sensor.first;
+        const openstudio::Vector3dVector& viewVectors = sensor.second;
         for (const Vector3d& viewVector : viewVectors){
-          m_radGlareSensors[space_name] += \
+          *t_translation.glareSensors += \
           formatString(sensor_point.x()) + " " + \
           formatString(sensor_point.y()) + " " + \
           formatString(sensor_point.z()) + " " + \
@@ -1662,56 +1617,323 @@ namespace radiance {
           formatString(viewVector.y()) + " " + \
           formatString(viewVector.z()) + "\n";
         }
+      } // glare sensor
+
+      // get output illuminance map points
+      for (const auto & map : data.illuminanceMaps)
+      {
+        t_translation.map = "";
+        t_translation.mapHandle = map.first;
+
+        const std::vector<Point3d>& referencePoints = map.second;
+        for (const auto & point : referencePoints)
+        {
+          *t_translation.map += "" + formatString(point.x()) + " " + formatString(point.y()) + " " + formatString(point.z()) + " 0 0 1\n";
+        }
+      }
+    } catch (const std::exception& e) {
+      t_translation.error = e.what();
+    }
+  }
+
+  void ForwardTranslator::buildingWindow(const openstudio::path &t_radDir, const openstudio::model::Space& space, const SpaceWindow& t_window,
+      std::vector<openstudio::path> &t_outfiles)
+  {
+    const std::string& subSurface_name = t_window.subSurfaceName;
+    const openstudio::Point3dVector& polygon = t_window.polygon;
+    const std::string& rMaterial = t_window.rMaterial;
+    const std::string& matString = t_window.matString;
+    double tVis = t_window.tVis;
+    double tn = t_window.tn;
+
+    // find window group
+    WindowGroup windowGroup = getWindowGroup(t_window.outwardNormal, space, *t_window.subSurface->construction, t_window.subSurface->shadingControl, polygon);
+    std::string windowGroup_name = windowGroup.name();
+
+    // get the normal
+    WindowGroupControl control = windowGroup.windowGroupControl();
+    if (control.outwardNormal){
+
+      std::cout << "outward normal:" + formatString(control.outwardNormal->x()) + " " + formatString(control.outwardNormal->y()) + " " + \
+        formatString(control.outwardNormal->z()) + "\n";
+
+    }
+
+    std::string winUpVector = "Z";
+    if (boost::algorithm::to_upper_copy(t_window.subSurfaceType) == "SKYLIGHT"){
+      winUpVector = "Y";
+    }
+
+    if (m_radWindowGroups.find(windowGroup_name) == m_radWindowGroups.end())
+    {
+      m_radWindowGroups[windowGroup_name] = "# OpenStudio Window Group: " + windowGroup_name + "\n";
+      if(windowGroup_name == "WG0"){
+         m_radWindowGroups[windowGroup_name] += "# All uncontrolled windows, multiple orientations possible, no hemispherical sampling info.\n\n";
+      }
+      else{
+        // 3-phase/rfluxmtx support
+        m_radWindowGroups[windowGroup_name] += "#@rfluxmtx h=kf u=" + winUpVector + " o=output/dc/" + windowGroup_name + ".vmx\n";
+      }
+
+    }
+
+    LOG(Info, "found a " + t_window.subSurfaceType + " named '" + subSurface_name + "', windowGroup_name = '" + windowGroup_name + "'");
+
+    // write material
+
+    if (windowGroup_name == "WG0"){
+      m_radMaterials.insert("void " + rMaterial + " glaz_" + rMaterial + "_tn-" + formatString(tn, 3) + "\n" + matString + "\n");
+      m_radMaterialsDC.insert("void alias glaz_" + rMaterial + "_tn-" + formatString(tn, 3) + " WG0\n\n");
+
+      // polygon header
+      m_radWindowGroups[windowGroup_name] += "#--SubSurface = " + subSurface_name + "\n";
+      m_radWindowGroups[windowGroup_name] += "#---Tvis = " + formatString(tVis, 4) + " (tn = " + formatString(tn, 4) + ")\n";
+      // write the polygon
+      m_radWindowGroups[windowGroup_name] += "glaz_"+rMaterial+"_tn-"+formatString(tn, 3) + " polygon " + subSurface_name + "\n";
+      m_radWindowGroups[windowGroup_name] += "0\n0\n" + formatString(polygon.size()*3) + "\n";
+      for (Point3dVector::const_reverse_iterator vertex = polygon.rbegin();
+        vertex != polygon.rend();
+        ++vertex)
+      {
+        m_radWindowGroups[windowGroup_name] += "" + formatString(vertex->x()) + " " + formatString(vertex->y()) + " " + formatString(vertex->z()) + "\n";
+      }
+    }
+    else
+    {
+      m_radMaterials.insert("void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n");
+      m_radMaterialsDC.insert("void light " + windowGroup_name + "\n0\n0\n3\n1 1 1\n");
+      m_radMaterialsWG0.insert("void plastic " + windowGroup_name + "\n0\n0\n5\n0 0 0 0 0\n");
+
+      // polygon header
+      m_radWindowGroups[windowGroup_name] += "\n# SubSurface = " + subSurface_name + "\n";
+      m_radWindowGroups[windowGroup_name] += "# Tvis = " + formatString(tVis, 2) + " (tn = " + formatString(tn, 2) + ")\n";
+
+      // write the polygon
+      m_radWindowGroups[windowGroup_name] += windowGroup_name + " polygon " + subSurface_name + "\n";
+      m_radWindowGroups[windowGroup_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n";
+      for (Point3dVector::const_reverse_iterator vertex = polygon.rbegin();
+        vertex != polygon.rend();
+        ++vertex)
+      
+      {
+        m_radWindowGroups[windowGroup_name] += "" + \
+        formatString(vertex->x()) + " " + \
+        formatString(vertex->y()) + " " + \
+        formatString(vertex->z()) + "\n";
+      }
+    }
+
+    // copy required bsdf files into place
+    openstudio::path bsdfoutpath = t_radDir / openstudio::toPath("bsdf");
+
+    if (rMaterial == "glass"){
+
+      // path to write bsdf to
+      openstudio::path uncontrolledBSDFOut = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("/cl_Tn" + formatString(tVis, 2) + ".xml");
+      
+      // add xml file to the collection of crap to copy up
+      t_outfiles.push_back(uncontrolledBSDFOut);
+
+      // get BSDF from BCL
+      boost::optional<openstudio::path> uncontrolledBSDF = getBSDF(tVis, 100, "None");
+      if (uncontrolledBSDF){
+        // copy uncontrolledBSDF
+        boost::filesystem::copy_file(*uncontrolledBSDF, uncontrolledBSDFOut, boost::filesystem::copy_option::overwrite_if_exists);
+      }else{
+        LOG(Warn, "Cannot download BSDF, using default.");
+
+        // read default file
+        QString defaultFile;
+        QFile inFile(":/resources/cl_Tn0.44.xml");
+        if (inFile.open(QFile::ReadOnly)){
+          QTextStream docIn(&inFile);
+          defaultFile = docIn.readAll();
+          inFile.close();
+        }
+
+        // write default file
+        QFile outFile(toQString(uncontrolledBSDFOut));
+        bool opened = outFile.open(QIODevice::WriteOnly);
+        if (!opened){
+          LOG_AND_THROW("Cannot write file to '" << toString(uncontrolledBSDFOut) << "'");
+        }
+        QTextStream textStream(&outFile);
+        textStream << defaultFile;
+        outFile.close();
+      }
+
+      // path to write bsdf to
+      openstudio::path controlledBSDFOut = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("/cl_Tn" + formatString(tVis, 2) + "_blinds.xml");
+      
+      // add xml file to the collection of crap to copy up
+      t_outfiles.push_back(controlledBSDFOut);
+
+      // get BSDF from BCL
+      boost::optional<openstudio::path> controlledBSDF = getBSDF(tVis, 100, "Blind");
+      if (controlledBSDF){
+        // copy controlledBSDF
+        boost::filesystem::copy_file(*controlledBSDF, controlledBSDFOut, boost::filesystem::copy_option::overwrite_if_exists);
+      }else{
+        LOG(Warn, "Cannot download BSDF, using default.");
+
+        // read default file
+        QString defaultFile;
+        QFile inFile(":/resources/cl_Tn0.44_blinds.xml");
+        if (inFile.open(QFile::ReadOnly)){
+          QTextStream docIn(&inFile);
+          defaultFile = docIn.readAll();
+          inFile.close();
+        }
+
+        // write default file
+        QFile outFile(toQString(uncontrolledBSDFOut));
+        bool opened = outFile.open(QIODevice::WriteOnly);
+        if (!opened){
+          LOG_AND_THROW("Cannot write file to '" << toString(uncontrolledBSDFOut) << "'");
+        }
+        QTextStream textStream(&outFile);
+        textStream << defaultFile;
+        outFile.close();
+      }
+
+      // store window group normal (may not need anymore with rfluxmtx)
+      // hard coded shade algorithm: on if high solar (2), setpoint 2Klx (2000)
+      m_radDCmats.insert(windowGroup_name + "," + \
+        formatString((control.outwardNormal->x() * -1), 2) + " " + \
+        formatString((control.outwardNormal->y() * -1), 2) + " " + \
+        formatString((control.outwardNormal->z() * -1), 2) + ",2,2000,cl_Tn" + \
+        formatString(tVis, 2) + ".xml,cl_Tn" + formatString(tVis, 2) + "_blinds.xml\n");
+
+    } else if (rMaterial == "trans"){
+
+      // copy uncontrolledBSDF
+      openstudio::path uncontrolledBSDFOut = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("/df_Tn" + formatString(tVis, 2) + ".xml");
+
+      // add xml file to the collection of crap to copy up
+      t_outfiles.push_back(uncontrolledBSDFOut);
+
+      // get BSDF from BCL
+      boost::optional<openstudio::path> uncontrolledBSDF = getBSDF(tVis, 0, "None");
+      if (uncontrolledBSDF){
+        // copy controlledBSDF
+        boost::filesystem::copy_file(*uncontrolledBSDF, uncontrolledBSDFOut, boost::filesystem::copy_option::overwrite_if_exists);
+      }else{
+        LOG(Warn, "Cannot download BSDF, using default.");
+
+        // read default file
+        QString defaultFile;
+        QFile inFile(":/resources/df_Tn0.44.xml");
+        if (inFile.open(QFile::ReadOnly)){
+          QTextStream docIn(&inFile);
+          defaultFile = docIn.readAll();
+          inFile.close();
+        }
+
+        // write default file
+        QFile outFile(toQString(uncontrolledBSDFOut));
+        bool opened = outFile.open(QIODevice::WriteOnly);
+        if (!opened){
+          LOG_AND_THROW("Cannot write file to '" << toString(uncontrolledBSDFOut) << "'");
+        }
+        QTextStream textStream(&outFile);
+        textStream << defaultFile;
+        outFile.close();
+      }
+
+      // store window group normal (may not need anymore with rfluxmtx)
+      m_radDCmats.insert(windowGroup_name + "," + \
+        formatString((control.outwardNormal->x() * -1), 2) + " " + \
+        formatString((control.outwardNormal->y() * -1), 2) + " " + \
+        formatString((control.outwardNormal->z() * -1), 2) + ",df_Tn" + formatString(tVis, 2) + ".xml\n");
+
+    }
+  }
+
+  void ForwardTranslator::buildingSpaces(const openstudio::path &t_radDir, const std::vector<openstudio::model::Space> &t_spaces,
+      std::vector<openstudio::path> &t_outfiles)
+  {
+    // read each space from the model on this thread, then format the plain values concurrently
+    std::vector<SpaceTranslation> translations;
+    translations.reserve(t_spaces.size());
+    for (const auto & space : t_spaces)
+    {
+      translations.push_back(SpaceTranslation(space));
+      readSpace(translations.back());
+    }
+    QtConcurrent::blockingMap(translations, &ForwardTranslator::translateSpace);
+
+    // paths of the files shared by all spaces, these are written once at the end but reported after
+    // every space as they were when they were rewritten on each pass
+    openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
+    openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
+    openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
+    openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
+    openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
+
+    // merge in space order, window groups and bsdf files are assigned here so numbering does not depend on scheduling
+    for (const auto & translation : translations)
+    {
+      for (const auto & warning : translation.warnings)
+      {
+        LOG(Warn, warning);
+      }
+
+      if (translation.error){
+        throw std::runtime_error(*translation.error);
+      }
+
+      const std::string& space_name = translation.spaceName;
+
+      m_radSpaces[space_name] = translation.geometry;
+      m_radMaterials.insert(translation.materials.begin(), translation.materials.end());
+
+      for (const auto & window : translation.windows)
+      {
+        buildingWindow(t_radDir, translation.space, window, t_outfiles);
+      }
+
+      // write daylighting controls
+      if (translation.sensors){
+        m_radSensors[space_name] = *translation.sensors;
+
+        openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".sns");
+        OFSTREAM file(filename);
+        if (file.is_open()){
+          t_outfiles.insert(t_outfiles.end(), translation.data.daylightingControls.size(), filename);
+          file << m_radSensors[space_name];
+        } else{
+          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
+        }
+
+        LOG(Debug, "Wrote " << space_name << ".sns");
+      }
+
+      // write glare sensor
+      if (translation.glareSensors){
+        m_radGlareSensors[space_name] = *translation.glareSensors;
 
-        // write glare sensor
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".glr");
         OFSTREAM file(filename);
         if (file.is_open()){
-          t_outfiles.push_back(filename);
+          t_outfiles.insert(t_outfiles.end(), translation.data.glareSensors.size(), filename);
           file << m_radGlareSensors[space_name];
         } else{
           LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
         }
 
         LOG(Debug, "Wrote " << space_name << ".glr");
-      } // glare sensor
-
-      //{  
-      //  m_radViews[space_name] = "";
-      //
-      //  openstudio::Point3d sensor_point = openstudio::radiance::ForwardTranslator::getReferencePoint(*viewpoints);
-      //  openstudio::Vector3dVector sensor_viewVector = openstudio::radiance::ForwardTranslator::getViewVectors(*viewpoints);
-      //  m_radViews[space_name] += "rvu -vta -vp " + formatString(sensor_point.x()) + " " + formatString(sensor_point.y()) + " " + \
-            //  formatString(sensor_point.z()) + " -vd " + formatString(sensor_viewVector[0].x()) + " " + formatString(sensor_viewVector[0].y()) + " " + \
-            //  formatString(sensor_viewVector[0].z()) + " -vu 0 0 1 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
-      //
-      //  // write views
-      //  openstudio::path filename = t_radDir/openstudio::toPath("views")/openstudio::toPath(space_name + ".vw");
-      //  OFSTREAM file(filename);
-      //  t_outfiles.push_back(filename);
-      //  file << m_radViews[space_name];
-      //
-      //  LOG(Debug, "INFO: wrote " << space_name << ".vw");
-      //}
+      }
 
-      // get output illuminance map points, write to file
-      std::vector<openstudio::model::IlluminanceMap> illuminanceMaps = space.illuminanceMaps();
-      for (const auto & map : illuminanceMaps)
-      {
+      // write map file
+      if (translation.map){
         m_radMaps[space_name] = "";
-        m_radMapHandles[space_name] = map.handle();
+        m_radMapHandles[space_name] = *translation.mapHandle;
 
-        // write map file
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".map");
         OFSTREAM file(filename);
         if (file.is_open()){
-          t_outfiles.push_back(filename);
-
-          std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
-          for (const auto & point : referencePoints)
-          {
-            m_radMaps[space_name] += "" + formatString(point.x()) + " " + formatString(point.y()) + " " + formatString(point.z()) + " 0 0 1\n";
-          }
+          t_outfiles.insert(t_outfiles.end(), translation.data.illuminanceMaps.size(), filename);
+          m_radMaps[space_name] = *translation.map;
           file << m_radMaps[space_name];
         } else{
           LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
@@ -1734,111 +1956,122 @@ namespace radiance {
       for (const auto & windowGroup : m_windowGroups)
       {
         std::string windowGroup_name = windowGroup.name();
-
-        //write windows (and glazed doors)
         if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
         {
           openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
-          OFSTREAM glazefile(glazefilename);
-          if (glazefile.is_open()){
-            t_outfiles.push_back(glazefilename);
-            m_radSceneFiles.push_back(glazefilename);
-            glazefile << m_radWindowGroups[windowGroup_name];
-          } else{
-            LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
-          }
-
-          // write window group control points
-          // only write for controlled window groups
+          t_outfiles.push_back(glazefilename);
+          m_radSceneFiles.push_back(glazefilename);
           if(windowGroup_name != "WG0"){
-            openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
-            OFSTREAM file(filename);
-            if (file.is_open()){
-              t_outfiles.push_back(filename);
-              file << windowGroup.windowGroupPoints();
-            } else{
-              LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-            }
+            t_outfiles.push_back(t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts"));
           }
         }
       }
 
-      // write radiance materials file
-      m_radMaterials.insert("# OpenStudio Materials File\n\n");
-      openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
-      OFSTREAM materialsfile(materialsfilename);
-      if (materialsfile.is_open()){
-        t_outfiles.push_back(materialsfilename);
-        for (const auto & line : m_radMaterials)
-        {
-          materialsfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
-      }
+      t_outfiles.push_back(materialsfilename);
+      t_outfiles.push_back(materials_vmxfilename);
+      t_outfiles.push_back(materials_WG0filename);
+      t_outfiles.push_back(materials_dcfilename);
+      t_outfiles.push_back(modelfilename);
+    }
 
-      // write radiance DC vmx materials (lights) file
-      m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
-      OFSTREAM materials_vmxfile(materials_vmxfilename);
-      if (materials_vmxfile.is_open()){
-        t_outfiles.push_back(materials_vmxfilename);
-        for (const auto & line : m_radMaterialsDC)
-        {
-          materials_vmxfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
-      }
+    // files shared by all spaces are written once all spaces have been merged
+    if (translations.empty()){
+      return;
+    }
 
+    for (const auto & windowGroup : m_windowGroups)
+    {
+      std::string windowGroup_name = windowGroup.name();
 
-      // write radiance WG0 vmx materials file (blacks out controlled window groups)
-      m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
-      openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
-      OFSTREAM materials_WG0file(materials_WG0filename);
-      if (materials_WG0file.is_open()){
-        t_outfiles.push_back(materials_WG0filename);
-        for (const auto & line : m_radMaterialsWG0)
-        {
-          materials_WG0file << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
+      //write windows (and glazed doors)
+      if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
+      {
+        openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
+        OFSTREAM glazefile(glazefilename);
+        if (glazefile.is_open()){
+          glazefile << m_radWindowGroups[windowGroup_name];
+        } else{
+          LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
+        }
+
+        // write window group control points
+        // only write for controlled window groups
+        if(windowGroup_name != "WG0"){
+          openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
+          OFSTREAM file(filename);
+          if (file.is_open()){
+            file << windowGroup.windowGroupPoints();
+          } else{
+            LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
+          }
+        }
       }
+    }
+
+    // write radiance materials file
+    m_radMaterials.insert("# OpenStudio Materials File\n\n");
+    OFSTREAM materialsfile(materialsfilename);
+    if (materialsfile.is_open()){
+      for (const auto & line : m_radMaterials)
+      {
+        materialsfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
+    }
 
+    // write radiance DC vmx materials (lights) file
+    m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    OFSTREAM materials_vmxfile(materials_vmxfilename);
+    if (materials_vmxfile.is_open()){
+      for (const auto & line : m_radMaterialsDC)
+      {
+        materials_vmxfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
+    }
 
-      // write radiance vmx materials list
-      // format of this file is: window group, bsdf, bsdf
-      m_radDCmats.insert("#OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control option,shade control setpoint,etc...\n");
-      openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
-      OFSTREAM materials_dcfile(materials_dcfilename);
-      if (materials_dcfile.is_open()){
-        t_outfiles.push_back(materials_dcfilename);
-        for (const auto & line : m_radDCmats)
-        {
-          materials_dcfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
-      }
 
+    // write radiance WG0 vmx materials file (blacks out controlled window groups)
+    m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
+    OFSTREAM materials_WG0file(materials_WG0filename);
+    if (materials_WG0file.is_open()){
+      for (const auto & line : m_radMaterialsWG0)
+      {
+        materials_WG0file << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
+    }
 
-      // write complete scene
-      openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
-      OFSTREAM modelfile(modelfilename);
 
-      if (modelfile.is_open()){
-        t_outfiles.push_back(modelfilename);
+    // write radiance vmx materials list
+    // format of this file is: window group, bsdf, bsdf
+    m_radDCmats.insert("#OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control option,shade control setpoint,etc...\n");
+    OFSTREAM materials_dcfile(materials_dcfilename);
+    if (materials_dcfile.is_open()){
+      for (const auto & line : m_radDCmats)
+      {
+        materials_dcfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
+    }
 
-        std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
 
-        for (const auto & filename : uniquePaths)
-        {
-          modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
-        }
-      } else{
-        LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
+    // write complete scene
+    OFSTREAM modelfile(modelfilename);
+
+    if (modelfile.is_open()){
+      std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+
+      for (const auto & filename : uniquePaths)
+      {
+        modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
       }
+    } else{
+      LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
     }
   }
 
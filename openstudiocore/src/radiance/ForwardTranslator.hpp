@@ -155,6 +155,24 @@ namespace radiance {
           const std::vector<openstudio::model::Space> &t_spaces,
           std::vector<openstudio::path> &t_outpaths);
 
+      struct SurfaceData;
+      struct SpaceData;
+      struct SpaceWindow;
+      struct SpaceTranslation;
+
+      // read everything translateSpace needs from the model, the model is not thread safe so this runs on the calling thread
+      static void readSpace(SpaceTranslation& t_translation);
+
+      // format the geometry and materials of one space from the values read by readSpace, does not touch the model
+      // so spaces can be formatted concurrently
+      static void translateSpace(SpaceTranslation& t_translation);
+
+      // assign a window to its window group and write its glazing and bsdf files
+      void buildingWindow(const openstudio::path &t_radDir, 
+          const openstudio::model::Space& space,
+          const SpaceWindow& t_window,
+          std::vector<openstudio::path> &t_outpaths);
+
     // get a bsdf possibly from the BCL
     boost::optional<openstudio::path> getBSDF(double vlt, double vltSpecular, const std::string& shadeType);
     boost::optional<std::string> getBSDF(openstudio::LocalBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid);
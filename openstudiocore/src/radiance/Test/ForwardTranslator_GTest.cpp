@@ -42,9 +42,17 @@
 
 #include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -202,6 +210,46 @@ TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl)
 }
 
 
+std::string readRadianceFile(const openstudio::path& p)
+{
+  std::ifstream file(openstudio::toString(p).c_str(), std::ios_base::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST(Radiance, ForwardTranslator_ExampleModel_SerialMatchesParallel)
+{
+  Model model = exampleModel();
+  ASSERT_LT(1u, model.getConcreteModelObjects<model::Space>().size());
+
+  openstudio::path serialpath = toPath("./ForwardTranslator_ExampleModel_Serial");
+  openstudio::path parallelpath = toPath("./ForwardTranslator_ExampleModel_Parallel");
+  boost::filesystem::remove_all(serialpath);
+  boost::filesystem::remove_all(parallelpath);
+
+  int maxThreadCount = QThreadPool::globalInstance()->maxThreadCount();
+
+  QThreadPool::globalInstance()->setMaxThreadCount(1);
+  ForwardTranslator serialft;
+  std::vector<path> serialpaths = serialft.translateModel(serialpath, model);
+
+  QThreadPool::globalInstance()->setMaxThreadCount(std::max(4, QThread::idealThreadCount()));
+  ForwardTranslator parallelft;
+  std::vector<path> parallelpaths = parallelft.translateModel(parallelpath, model);
+
+  QThreadPool::globalInstance()->setMaxThreadCount(maxThreadCount);
+
+  EXPECT_TRUE(serialft.errors().empty());
+  EXPECT_TRUE(parallelft.errors().empty());
+
+  ASSERT_FALSE(serialpaths.empty());
+  ASSERT_EQ(serialpaths.size(), parallelpaths.size());
+  for (unsigned i = 0; i < serialpaths.size(); ++i){
+    openstudio::path relativepath = openstudio::relativePath(serialpaths[i], serialpath);
+    EXPECT_EQ(toString(relativepath), toString(openstudio::relativePath(parallelpaths[i], parallelpath)));
+    EXPECT_EQ(readRadianceFile(serialpaths[i]), readRadianceFile(parallelpath / relativepath)) << toString(relativepath);
+  }
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModel_NoIllumMaps)
 {
   Model model = exampleModel();
@@ -20,6 +20,8 @@
 #include "FloodPlot.hpp"
 #include "../utilities/time/Time.hpp"
 
+#include <algorithm>
+
 using namespace std;
 using namespace boost;
 
@@ -196,6 +198,7 @@ TimeSeriesFloodPlotData::TimeSeriesFloodPlotData(TimeSeries timeSeries)
   setInterval(Qt::YAxis, QwtInterval(m_minY, m_maxY));
   setInterval(Qt::ZAxis, m_colorMapRange);
   m_units = timeSeries.units();
+  initTiles();
 }
 
 TimeSeriesFloodPlotData::TimeSeriesFloodPlotData(TimeSeries timeSeries,  QwtInterval colorMapRange)
@@ -215,11 +218,36 @@ TimeSeriesFloodPlotData::TimeSeriesFloodPlotData(TimeSeries timeSeries,  QwtInte
   setInterval(Qt::YAxis, QwtInterval(m_minY, m_maxY));
   setInterval(Qt::ZAxis, m_colorMapRange);
   m_units = timeSeries.units();
+  initTiles();
+}
+
+TimeSeriesFloodPlotData::TimeSeriesFloodPlotData(const TimeSeriesFloodPlotData& other)
+: FloodPlotData(),
+  m_timeSeries(other.m_timeSeries),
+  m_minValue(other.m_minValue),
+  m_maxValue(other.m_maxValue),
+  m_minX(other.m_minX),
+  m_maxX(other.m_maxX),
+  m_minY(other.m_minY),
+  m_maxY(other.m_maxY),
+  m_startFractionalDay(other.m_startFractionalDay),
+  m_colorMapRange(other.m_colorMapRange),
+  m_units(other.m_units),
+  m_stepsPerDay(other.m_stepsPerDay),
+  m_tiles(other.m_tiles),
+  m_dayLevel(0),
+  m_hourLevel(0)
+{
+  // data range
+  setInterval(Qt::XAxis, QwtInterval(m_minX, m_maxX));
+  setInterval(Qt::YAxis, QwtInterval(m_minY, m_maxY));
+  setInterval(Qt::ZAxis, m_colorMapRange);
 }
 
 TimeSeriesFloodPlotData* TimeSeriesFloodPlotData::copy() const
 {
-  TimeSeriesFloodPlotData* result = new TimeSeriesFloodPlotData(m_timeSeries, m_colorMapRange);
+  // reuse the tiles rather than sampling the time series again
+  TimeSeriesFloodPlotData* result = new TimeSeriesFloodPlotData(*this);
   return result;
 }
 
@@ -241,10 +269,106 @@ QRectF TimeSeriesFloodPlotData::boundingRect() const
 double TimeSeriesFloodPlotData::value(double fractionalDay, double hourOfDay) const
 {
   // DLM: we are flooring the day because we want to plot day vs hour in flood plot
+  double day = floor(fractionalDay) - m_minX;
+  double step = floor(hourOfDay / 24.0 * m_stepsPerDay);
+  auto it = m_tiles.find(std::make_pair(m_dayLevel, m_hourLevel));
+  if ((it != m_tiles.end()) && (day >= 0) && (step >= 0)){
+    const Matrix& currentTiles = it->second;
+    unsigned i = static_cast<unsigned>(day) >> m_dayLevel;
+    unsigned j = static_cast<unsigned>(step) >> m_hourLevel;
+    if ((i < currentTiles.size1()) && (j < currentTiles.size2())){
+      return currentTiles(i, j);
+    }
+  }
+
   double fracDays = floor(fractionalDay) + hourOfDay/24.0;
   return m_timeSeries.value(fracDays-m_startFractionalDay);
 }
 
+void TimeSeriesFloodPlotData::initRaster(const QRectF& area, const QSize& raster)
+{
+  m_dayLevel = 0;
+  m_hourLevel = 0;
+
+  if ((raster.width() > 0) && (raster.height() > 0)){
+    const Matrix& base = tiles(0, 0);
+    double daysPerPixel = area.width() / raster.width();
+    double stepsPerPixel = area.height() / 24.0 * m_stepsPerDay / raster.height();
+    while (((2u << m_dayLevel) <= daysPerPixel) && ((base.size1() >> (m_dayLevel + 1)) > 0)){
+      ++m_dayLevel;
+    }
+    while (((2u << m_hourLevel) <= stepsPerPixel) && ((base.size2() >> (m_hourLevel + 1)) > 0)){
+      ++m_hourLevel;
+    }
+  }
+
+  // build the level now, value() only looks it up
+  tiles(m_dayLevel, m_hourLevel);
+}
+
+void TimeSeriesFloodPlotData::discardRaster()
+{
+  m_dayLevel = 0;
+  m_hourLevel = 0;
+}
+
+void TimeSeriesFloodPlotData::initTiles()
+{
+  // one tile per reporting step, so full resolution tiles match value for interval data
+  m_stepsPerDay = 24;
+  OptionalTime intervalLength = m_timeSeries.intervalLength();
+  if (intervalLength && (intervalLength->totalDays() > 0)){
+    m_stepsPerDay = static_cast<unsigned>(floor(1.0 / intervalLength->totalDays() + 0.5));
+  }else if (m_maxX > m_minX){
+    m_stepsPerDay = static_cast<unsigned>(ceil(m_timeSeries.values().size() / (m_maxX - m_minX)));
+  }
+  m_stepsPerDay = std::max(1u, std::min(1440u, m_stepsPerDay));
+
+  unsigned numDays = std::max(1u, static_cast<unsigned>(m_maxX - m_minX));
+  Matrix base(numDays, m_stepsPerDay);
+  for (unsigned i = 0; i < numDays; ++i){
+    for (unsigned j = 0; j < m_stepsPerDay; ++j){
+      base(i, j) = m_timeSeries.value(m_minX + i + (j + 0.5) / m_stepsPerDay - m_startFractionalDay);
+    }
+  }
+
+  m_tiles.clear();
+  m_tiles[std::make_pair(0u, 0u)] = base;
+  discardRaster();
+}
+
+const Matrix& TimeSeriesFloodPlotData::tiles(unsigned dayLevel, unsigned hourLevel)
+{
+  std::pair<unsigned, unsigned> key(dayLevel, hourLevel);
+  auto it = m_tiles.find(key);
+  if (it != m_tiles.end()){
+    return it->second;
+  }
+
+  // maximum of pairs of tiles from the next finer level, so peaks stay visible when zoomed out,
+  // built on first use and kept
+  bool halveDays = (dayLevel > 0);
+  const Matrix& finer = halveDays ? tiles(dayLevel - 1, hourLevel) : tiles(dayLevel, hourLevel - 1);
+  unsigned rows = halveDays ? (finer.size1() + 1) / 2 : finer.size1();
+  unsigned cols = halveDays ? finer.size2() : (finer.size2() + 1) / 2;
+  Matrix coarser(rows, cols);
+  for (unsigned i = 0; i < rows; ++i){
+    for (unsigned j = 0; j < cols; ++j){
+      if (halveDays){
+        unsigned next = std::min<unsigned>(2 * i + 1, finer.size1() - 1);
+        coarser(i, j) = std::max(finer(2 * i, j), finer(next, j));
+      }else{
+        unsigned next = std::min<unsigned>(2 * j + 1, finer.size2() - 1);
+        coarser(i, j) = std::max(finer(i, 2 * j), finer(i, next));
+      }
+    }
+  }
+
+  Matrix& result = m_tiles[key];
+  result = coarser;
+  return result;
+}
+
 /// minX
 double TimeSeriesFloodPlotData::minX() const { return m_minX; };
 
@@ -36,6 +36,8 @@
 #include <qwt/qwt_plot_zoomer.h>
 #include <qwt/qwt_plot_layout.h>
 
+#include <map>
+
 namespace openstudio{
 
   /** FloodPlotColorMap is class for colormap that can be used in a flood plot.
@@ -158,9 +160,15 @@ namespace openstudio{
       /// provide boundingRect overload for speed - default implementation slow!!!
       QRectF boundingRect() const;
 
-      ///  value at point fractionalDay and hourOfDay
+      ///  value at point fractionalDay and hourOfDay, looked up in the tiles chosen by initRaster
       double value(double fractionalDay, double hourOfDay) const;
 
+      /// reimplement, choose the coarsest tiles that are no larger than a raster pixel
+      void initRaster(const QRectF& area, const QSize& raster);
+
+      /// reimplement, return to full resolution tiles
+      void discardRaster();
+
       /// minX
       double minX() const;
 
@@ -204,6 +212,18 @@ namespace openstudio{
       std::string units() const;
 
     private:
+      // copies the tiles already built, used by copy()
+      TimeSeriesFloodPlotData(const TimeSeriesFloodPlotData& other);
+
+      // Disabled operator=
+      TimeSeriesFloodPlotData &operator=(const TimeSeriesFloodPlotData &);
+
+      // sample one full resolution tile per day and reporting step
+      void initTiles();
+
+      // tile maxima, each day level halves the days and each hour level halves the steps per day
+      const Matrix& tiles(unsigned dayLevel, unsigned hourLevel);
+
       TimeSeries m_timeSeries;
       double m_minValue;
       double m_maxValue;
@@ -214,6 +234,10 @@ namespace openstudio{
       double m_startFractionalDay;
       QwtInterval m_colorMapRange;
       std::string m_units;
+      unsigned m_stepsPerDay;
+      std::map<std::pair<unsigned, unsigned>, Matrix> m_tiles; // rows are days, columns are steps
+      unsigned m_dayLevel; // level of the tiles value() reads, chosen by initRaster
+      unsigned m_hourLevel;
   };
 
   /** MatrixFloodPlotData converts a Matrix into flood plot data
@@ -19,6 +19,7 @@
 
 #include "LinePlot.hpp"
 #include <cfloat>
+#include <algorithm>
 #include <qwt/qwt_painter.h>
 
 
@@ -27,6 +28,179 @@ using namespace boost;
 
 namespace openstudio{
 
+namespace {
+
+  bool sampleBeforeX(const QPointF& sample, double x)
+  {
+    return sample.x() < x;
+  }
+
+  bool xBeforeSample(double x, const QPointF& sample)
+  {
+    return x < sample.x();
+  }
+
+}
+
+LinePlotPyramid::LinePlotPyramid()
+  : m_pixelWidth(0), m_level(0), m_begin(0), m_end(0)
+{
+  m_levels.push_back(QVector<QPointF>());
+}
+
+LinePlotPyramid::LinePlotPyramid(const QVector<double>& xValues, const QVector<double>& yValues)
+  : m_pixelWidth(0), m_level(0), m_begin(0), m_end(0)
+{
+  setSamples(xValues, yValues);
+}
+
+LinePlotPyramid& LinePlotPyramid::operator=(const LinePlotPyramid& other)
+{
+  m_levels = other.m_levels;
+  m_boundingRect = other.m_boundingRect;
+  m_rectOfInterest = other.m_rectOfInterest;
+  m_pixelWidth = other.m_pixelWidth;
+  m_level = other.m_level;
+  m_begin = other.m_begin;
+  m_end = other.m_end;
+  return *this;
+}
+
+void LinePlotPyramid::setSamples(const QVector<double>& xValues, const QVector<double>& yValues)
+{
+  m_levels.clear();
+  m_boundingRect = QRectF();
+
+  int n = std::min(xValues.size(), yValues.size());
+
+  QVector<QPointF> points(n);
+  double minY = DBL_MAX;
+  double maxY = -DBL_MAX;
+  for (int i = 0; i < n; ++i){
+    points[i] = QPointF(xValues[i], yValues[i]);
+    minY = std::min(minY, yValues[i]);
+    maxY = std::max(maxY, yValues[i]);
+  }
+  m_levels.push_back(points);
+
+  if (n > 0){
+    m_boundingRect = QRectF(xValues[0], minY, xValues[n-1] - xValues[0], maxY - minY);
+  }
+
+  // each level keeps the min and max of every four samples below it, in x order
+  while (m_levels.back().size() > 4){
+    const QVector<QPointF>& finer = m_levels.back();
+    QVector<QPointF> coarser;
+    coarser.reserve(finer.size() / 2 + 2);
+    for (int i = 0; i < finer.size(); i += 4){
+      int end = std::min(i + 4, finer.size());
+      int minIndex = i;
+      int maxIndex = i;
+      for (int j = i + 1; j < end; ++j){
+        if (finer[j].y() < finer[minIndex].y()) minIndex = j;
+        if (finer[j].y() > finer[maxIndex].y()) maxIndex = j;
+      }
+      coarser.push_back(finer[std::min(minIndex, maxIndex)]);
+      if (minIndex != maxIndex){
+        coarser.push_back(finer[std::max(minIndex, maxIndex)]);
+      }
+    }
+    m_levels.push_back(coarser);
+  }
+
+  selectLevel();
+}
+
+size_t LinePlotPyramid::numLevels() const
+{
+  return m_levels.size();
+}
+
+size_t LinePlotPyramid::level() const
+{
+  return m_level;
+}
+
+int LinePlotPyramid::pixelWidth() const
+{
+  return m_pixelWidth;
+}
+
+void LinePlotPyramid::setPixelWidth(int pixelWidth)
+{
+  if (pixelWidth != m_pixelWidth){
+    m_pixelWidth = pixelWidth;
+    selectLevel();
+  }
+}
+
+void LinePlotPyramid::setRectOfInterest(const QRectF& rect)
+{
+  if (rect != m_rectOfInterest){
+    m_rectOfInterest = rect;
+    selectLevel();
+  }
+}
+
+size_t LinePlotPyramid::size() const
+{
+  return m_end - m_begin;
+}
+
+QPointF LinePlotPyramid::sample(size_t i) const
+{
+  return m_levels[m_level][m_begin + i];
+}
+
+QRectF LinePlotPyramid::boundingRect() const
+{
+  return m_boundingRect;
+}
+
+void LinePlotPyramid::selectLevel()
+{
+  m_level = 0;
+  m_begin = 0;
+  m_end = m_levels[0].size();
+
+  if ((m_pixelWidth <= 0) || (m_end == 0)){
+    return;
+  }
+
+  double minX = m_boundingRect.left();
+  double maxX = m_boundingRect.right();
+  if (m_rectOfInterest.width() > 0){
+    minX = m_rectOfInterest.left();
+    maxX = m_rectOfInterest.right();
+  }
+
+  size_t minSamples = 2 * static_cast<size_t>(m_pixelWidth);
+  for (size_t level = m_levels.size(); level > 0; --level){
+    const QVector<QPointF>& samples = m_levels[level-1];
+    size_t begin = std::lower_bound(samples.begin(), samples.end(), minX, sampleBeforeX) - samples.begin();
+    size_t end = std::upper_bound(samples.begin(), samples.end(), maxX, xBeforeSample) - samples.begin();
+    if ((level == 1) || (end - begin >= minSamples)){
+      // keep one sample either side so lines run to the edges of the canvas
+      m_level = level - 1;
+      m_begin = (begin > 0) ? begin - 1 : 0;
+      m_end = std::min(end + 1, static_cast<size_t>(samples.size()));
+      return;
+    }
+  }
+}
+
+LinePlotPyramid LinePlotData::pyramid() const
+{
+  QVector<double> xValues(size());
+  QVector<double> yValues(size());
+  for (size_t i = 0; i < size(); ++i){
+    QPointF point = sample(i);
+    xValues[i] = point.x();
+    yValues[i] = point.y();
+  }
+  return LinePlotPyramid(xValues, yValues);
+}
+
 TimeSeriesLinePlotData::TimeSeriesLinePlotData(TimeSeries timeSeries)
 : m_timeSeries(timeSeries),
   m_minX(timeSeries.firstReportDateTime().date().dayOfYear()+timeSeries.firstReportDateTime().time().totalDays()),
@@ -42,6 +216,7 @@ TimeSeriesLinePlotData::TimeSeriesLinePlotData(TimeSeries timeSeries)
   m_fracDaysOffset = 0.0;
   m_x = m_timeSeries.daysFromFirstReport();
   m_y = m_timeSeries.values();
+  initPyramid();
 }
 
 TimeSeriesLinePlotData::TimeSeriesLinePlotData(TimeSeries timeSeries, double fracDaysOffset)
@@ -59,6 +234,7 @@ TimeSeriesLinePlotData::TimeSeriesLinePlotData(TimeSeries timeSeries, double fra
   m_fracDaysOffset = fracDaysOffset; // note updating in xValue does not affect scaled axis
   m_x = m_timeSeries.daysFromFirstReport();
   m_y = m_timeSeries.values();
+  initPyramid();
 }
 
 TimeSeriesLinePlotData::~TimeSeriesLinePlotData()
@@ -81,6 +257,33 @@ double TimeSeriesLinePlotData::y(size_t pos) const
   return m_y(pos);
 }
 
+void TimeSeriesLinePlotData::initPyramid()
+{
+  QVector<double> xValues(m_size);
+  QVector<double> yValues(m_size);
+  for (size_t i = 0; i < m_size; ++i){
+    xValues[i] = x(i);
+    yValues[i] = y(i);
+  }
+  m_pyramid.setSamples(xValues, yValues);
+}
+
+LinePlotPyramid TimeSeriesLinePlotData::pyramid() const
+{
+  // levels are implicitly shared so this does not copy samples
+  return m_pyramid;
+}
+
+void TimeSeriesLinePlotData::setPixelWidth(int pixelWidth)
+{
+  m_pyramid.setPixelWidth(pixelWidth);
+}
+
+void TimeSeriesLinePlotData::setRectOfInterest(const QRectF& rect)
+{
+  m_pyramid.setRectOfInterest(rect);
+}
+
 /// units for plotting on axes or scaling
 void TimeSeriesLinePlotData::units(const std::string &unit) { m_units = unit; }
 
@@ -132,13 +335,13 @@ QRectF TimeSeriesLinePlotData::boundingRect() const
 /// reimplement sample
 QPointF TimeSeriesLinePlotData::sample(size_t i) const
 { 
-  return QPointF(x(i), y(i)); 
+  return m_pyramid.sample(i); 
 }
 
 /// reimplement abstract function size
 size_t TimeSeriesLinePlotData::size(void) const
 { 
-  return m_size; 
+  return m_pyramid.size(); 
 }
 
 VectorLinePlotData::VectorLinePlotData(const Vector& xVector,
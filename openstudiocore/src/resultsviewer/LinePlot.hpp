@@ -42,9 +42,74 @@
 #include <qwt/qwt_point_data.h>
 
 #include <cmath>
+#include <vector>
 
 namespace openstudio{
 
+/** LinePlotPyramid is a min/max summary of line plot samples at successively halved resolutions.
+ *  Each level keeps the minimum and maximum of every group of four samples of the level below it, so
+ *  peaks survive decimation. The level served is the coarsest one that still has two samples per pixel
+ *  across the rect of interest, which bounds redraw cost by the canvas width rather than the data size.
+ *  Until a pixel width is set every sample is served.
+ *  \deprecated { Qwt drawing widgets are deprecated in favor of Javascript }
+ */
+class  LinePlotPyramid : public QwtSeriesData<QPointF>
+{
+public:
+
+  /// empty pyramid
+  LinePlotPyramid();
+
+  /// build the pyramid once, x values must be ascending
+  LinePlotPyramid(const QVector<double>& xValues, const QVector<double>& yValues);
+
+  /// copies share levels, QwtSeriesData does not provide assignment
+  LinePlotPyramid& operator=(const LinePlotPyramid& other);
+
+  /// virtual destructor
+  virtual ~LinePlotPyramid() {}
+
+  /// rebuild the pyramid, x values must be ascending
+  void setSamples(const QVector<double>& xValues, const QVector<double>& yValues);
+
+  /// number of levels, level 0 is full resolution
+  size_t numLevels() const;
+
+  /// level currently served
+  size_t level() const;
+
+  /// width in pixels of the canvas the samples are drawn on, 0 serves every sample
+  int pixelWidth() const;
+
+  /// width in pixels of the canvas the samples are drawn on, 0 serves every sample
+  void setPixelWidth(int pixelWidth);
+
+  /// reimplement, qwt passes the visible scale range before drawing
+  void setRectOfInterest(const QRectF& rect);
+
+  /// reimplement abstract function size
+  size_t size() const;
+
+  /// reimplement sample
+  QPointF sample(size_t i) const;
+
+  /// reimplement bounding rect for speed, bounds of the full resolution data
+  QRectF boundingRect() const;
+
+private:
+
+  // pick the level and visible window for the current rect of interest and pixel width
+  void selectLevel();
+
+  std::vector<QVector<QPointF> > m_levels;
+  QRectF m_boundingRect;
+  QRectF m_rectOfInterest;
+  int m_pixelWidth;
+  size_t m_level;
+  size_t m_begin;
+  size_t m_end;
+};
+
 /** LinePlotData is abstract class for data that can be used in a line plot.
  *  Derive from this class to plot your data.
  *  \deprecated { Qwt drawing widgets are deprecated in favor of Javascript }
@@ -101,6 +166,9 @@ public:
 
   virtual QRectF boundingRect() const = 0;
 
+  /// min/max pyramid over all samples, default implementation builds one from sample
+  virtual LinePlotPyramid pyramid() const;
+
 protected:
   LinePlotData() {}
 };
@@ -163,12 +231,21 @@ public:
   /// reimplement abstract function size
   size_t size(void) const;
 
-  /// reimplement abstract function x
+  /// reimplement abstract function x, always full resolution
   double x(size_t pos) const;
 
-  /// reimplement abstract function y
+  /// reimplement abstract function y, always full resolution
   double y(size_t pos) const;
 
+  /// min/max pyramid built once in the constructor
+  LinePlotPyramid pyramid() const;
+
+  /// width in pixels of the canvas, sample and size serve the matching pyramid level
+  void setPixelWidth(int pixelWidth);
+
+  /// reimplement, qwt passes the visible scale range before drawing
+  void setRectOfInterest(const QRectF& rect);
+
   /// units for plotting on axes or scaling
   void units(const std::string &unit);
 
@@ -176,6 +253,9 @@ public:
   std::string units() const;
 
 private:
+  // build the pyramid from the full resolution samples
+  void initPyramid();
+
   TimeSeries m_timeSeries;
   double m_minValue;
   double m_maxValue;
@@ -190,6 +270,7 @@ private:
   // testing Vector class
   Vector m_x;
   Vector m_y;
+  LinePlotPyramid m_pyramid;
 };
 
 /** VectorLinePlotData converts two Vectors into Line plot data
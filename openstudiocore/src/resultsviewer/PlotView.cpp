@@ -44,6 +44,7 @@ namespace resultsviewer{
 
 
   LinePlotCurve::LinePlotCurve(QString& title, openstudio::TimeSeriesLinePlotData& data)
+    : m_drawnPyramid(nullptr)
   {
     setTitle(title);
     m_yType = resultsviewer::unScaledY;
@@ -64,25 +65,39 @@ namespace resultsviewer{
       m_xValues[i] = data.sample(i).x();
       m_yUnscaled[i] = data.sample(i).y();
     }
+    m_unscaledPyramid = data.pyramid();
     setLinePlotStyle(resultsviewer::smoothLinePlot);
   }
 
 
   void LinePlotCurve::setDataMode(YValueType yType)
   {
+    // copies share the levels built once per series
     switch (yType)
     {
     case resultsviewer::unScaledY:
-      setSamples(m_xValues, m_yUnscaled);
+      m_drawnPyramid = new openstudio::LinePlotPyramid(m_unscaledPyramid);
+      setData(m_drawnPyramid);
       m_yType = yType;
       break;
     case resultsviewer::scaledY:
-      setSamples(m_xValues, m_yScaled);
+      m_drawnPyramid = new openstudio::LinePlotPyramid(m_scaledPyramid);
+      setData(m_drawnPyramid);
       m_yType = yType;
       break;
     }
   }
 
+  void LinePlotCurve::drawSeries(QPainter *painter, const QwtScaleMap &xMap, const QwtScaleMap &yMap,
+                                 const QRectF &canvasRect, int from, int to) const
+  {
+    if (m_drawnPyramid){
+      m_drawnPyramid->setPixelWidth(static_cast<int>(canvasRect.width()));
+      m_drawnPyramid->setRectOfInterest(QRectF(QPointF(xMap.s1(), yMap.s1()), QPointF(xMap.s2(), yMap.s2())).normalized());
+    }
+    QwtPlotCurve::drawSeries(painter, xMap, yMap, canvasRect, from, to);
+  }
+
   void LinePlotCurve::setLinePlotStyle(LinePlotStyleType lineStyle)
   {
     switch (lineStyle)
@@ -1318,8 +1333,8 @@ namespace resultsviewer{
           {
 
             //          QVector<double> xData(plotCurve->dataSize());
-            QVector<double> yData(plotCurve->dataSize());
-            for (size_t i = 0; i < plotCurve->dataSize(); ++i)
+            QVector<double> yData(plotCurve->numValues());
+            for (int i = 0; i < plotCurve->numValues(); ++i)
             {
               if (i % 1000 == 0)
               {
@@ -1330,7 +1345,7 @@ namespace resultsviewer{
                 }
               }
               //        xData[i] = plotCurve->x(i);
-              yData[i] = (plotCurve->sample(i).y() - plotCurve->minYValue())/ (plotCurve->maxYValue() - plotCurve->minYValue());
+              yData[i] = (plotCurve->yUnscaled(i) - plotCurve->minYValue())/ (plotCurve->maxYValue() - plotCurve->minYValue());
             }
             // reset data
             plotCurve->setTitle(plotCurve->title().text() + "[" + QString::number(plotCurve->minYValue()) + ", "  + QString::number(plotCurve->maxYValue()) + "]");
@@ -93,9 +93,11 @@ namespace resultsviewer{
     double yUnscaled(int i) {return m_yUnscaled[i];}
     void setYUnscaled(QVector<double>& yUnscaled) {m_yUnscaled = yUnscaled;}
     double yScaled(int i) {return m_yScaled[i];}
-    void setYScaled(QVector<double>& yScaled) {m_yScaled = yScaled;}
+    void setYScaled(QVector<double>& yScaled) {m_yScaled = yScaled; m_scaledPyramid.setSamples(m_xValues, m_yScaled);}
     double xValues(int i) {return m_xValues[i];}
     void setXValues(QVector<double>& xValues) {m_xValues = xValues;}
+    // full resolution, dataSize() is the number of samples in the level last drawn
+    int numValues() {return m_xValues.size();}
 
     // assign data and update array members
     void setDataMode(YValueType yType);
@@ -106,6 +108,11 @@ namespace resultsviewer{
 
     void setLinePlotStyle(LinePlotStyleType lineStyle);
 
+  protected:
+    // serve the pyramid level matching the canvas width before drawing
+    virtual void drawSeries(QPainter *painter, const QwtScaleMap &xMap, const QwtScaleMap &yMap,
+                            const QRectF &canvasRect, int from, int to) const;
+
   private:
     QStringList m_alias;
     QStringList m_plotSource;
@@ -113,6 +120,9 @@ namespace resultsviewer{
     QVector<double> m_yScaled;
     QVector<double> m_yUnscaled;
     QVector<double> m_xValues; // mid point
+    openstudio::LinePlotPyramid m_unscaledPyramid;
+    openstudio::LinePlotPyramid m_scaledPyramid;
+    openstudio::LinePlotPyramid* m_drawnPyramid; // owned by qwt
     YValueType m_yType;
     LinePlotStyleType m_linePlotStyle;
 
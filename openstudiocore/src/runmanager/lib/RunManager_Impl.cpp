@@ -170,6 +170,40 @@ namespace detail {
 
 
 
+  /// Thread which runs the DBHolder write-behind loop
+  class DBWriteBehindThread : public QThread
+  {
+    public:
+      explicit DBWriteBehindThread(const std::function<void ()> &t_func)
+        : m_func(t_func)
+      {
+      }
+
+    protected:
+      virtual void run()
+      {
+        m_func();
+      }
+
+    private:
+      std::function<void ()> m_func;
+  };
+
+  /// Owns the RunManager database.
+  ///
+  /// Job trees and job status changes are not written when they are reported. They are
+  /// coalesced in memory (one entry per job tree or job uuid, the most recent change wins)
+  /// and written by a background thread in a single transaction per batch. A batch is
+  /// written once it has been pending for writeBehindInterval() milliseconds or has reached
+  /// writeBehindBatchSize() entries, whichever comes first.
+  ///
+  /// Crash recovery: each batch commits atomically, so the database always reflects the
+  /// state as of the last committed batch. If the process dies, changes reported during
+  /// the final interval are lost; on reload those jobs are either missing (never enqueued)
+  /// or appear not to have run yet and are run again. A clean shutdown flushes everything.
+  ///
+  /// Every operation which reads from or deletes from the database flushes the pending
+  /// changes first, so within one process the database is always seen as up to date.
   class RunManager_Impl::DBHolder
   {
     public:
@@ -178,9 +212,42 @@ namespace detail {
           m_config(initConfigOptions(m_db, DB)),
           m_loading(false),
           m_dbPath(DB),
-          m_configOptions(new ConfigOptions(toConfigOptions(m_db, m_config)))
+          m_configOptions(new ConfigOptions(toConfigOptions(m_db, m_config))),
+          m_writeBehindContinue(true),
+          m_writeBehindThread(std::bind(&DBHolder::writeBehind, this))
       {
+        m_writeBehindThread.start();
+      }
 
+      ~DBHolder()
+      {
+        {
+          QMutexLocker l(&m_pendingMutex);
+          m_writeBehindContinue = false;
+          m_pendingCondition.wakeAll();
+        }
+
+        // the write-behind thread performs one last flush before exiting
+        m_writeBehindThread.wait();
+      }
+
+      /// Maximum time in milliseconds a change is held in memory before it is written
+      static unsigned long writeBehindInterval()
+      {
+        return 250;
+      }
+
+      /// Number of pending changes which triggers an immediate write
+      static size_t writeBehindBatchSize()
+      {
+        return 500;
+      }
+
+      /// Writes all pending changes to the database in a single transaction
+      void flush()
+      {
+        QMutexLocker l(&m_mutex);
+        flushInternal();
       }
 
       ConfigOptions getConfigOptions()
@@ -197,19 +264,20 @@ namespace detail {
       void setLoading(bool loading)
       {
         // If the system is loading, we don't want to persist jobs that are queued during load
-        QMutexLocker l(&m_mutex);
+        QMutexLocker l(&m_pendingMutex);
         m_loading = loading;
       }
 
       bool isLoading() const
       {
-        QMutexLocker l(&m_mutex);
+        QMutexLocker l(&m_pendingMutex);
         return m_loading;
       }
 
       void setConfigOptions(const ConfigOptions &t_co)
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         updateConfiguration(m_db, m_config, t_co);
         m_db.commit();
         m_configOptions = std::shared_ptr<ConfigOptions>(new ConfigOptions(t_co));
@@ -229,12 +297,14 @@ namespace detail {
       std::vector<openstudio::runmanager::Job> loadJobs()
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         return loadJobsImpl(false, "");
       }
 
       std::vector<openstudio::runmanager::Workflow> loadWorkflows()
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         std::vector<openstudio::runmanager::Job> jobs = loadJobsImpl(true, "");
 
         // ETH@20120216 - Workflow constructor is now explicit. Replacing
@@ -249,6 +319,7 @@ namespace detail {
       openstudio::runmanager::Workflow loadWorkflowByName(const std::string &t_name)
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         std::vector<openstudio::runmanager::Job> jobs = loadJobsImpl(true, "");
 
         for (const auto & job : jobs)
@@ -269,6 +340,7 @@ namespace detail {
       void deleteWorkflowByName(const std::string &t_name)
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         m_db.begin();
         std::vector<openstudio::runmanager::Job> jobs = loadJobsImpl(true, "");
 
@@ -290,6 +362,7 @@ namespace detail {
       void deleteWorkflows()
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         m_db.begin();
         std::vector<openstudio::runmanager::Job> jobs = loadJobsImpl(true, "");
 
@@ -304,6 +377,7 @@ namespace detail {
       void deleteJobTree(const openstudio::runmanager::Job &t_job)
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         m_db.begin();
         deleteJobRecursiveInternal(t_job);
         m_db.commit();
@@ -326,9 +400,9 @@ namespace detail {
         deleteJobInternal(t_job);
       }
 
+      /// m_mutex must be held
       bool workflowExists(const std::string &t_key)
       {
-        QMutexLocker l(&m_mutex);
         std::vector<openstudio::runmanager::Job> jobs = loadJobsImpl(true, t_key);
 
         for (const auto & job : jobs)
@@ -345,6 +419,7 @@ namespace detail {
       openstudio::runmanager::Workflow loadWorkflow(const std::string &t_key)
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         std::vector<openstudio::runmanager::Job> jobs = loadJobsImpl(true, t_key);
 
         for (const auto & job : jobs)
@@ -380,6 +455,7 @@ namespace detail {
       void deleteJob(const openstudio::runmanager::Job &t_job)
       {
         QMutexLocker l(&m_mutex);
+        flushInternal();
         m_db.begin();
         deleteJobInternal(t_job);
         m_db.commit();
@@ -389,6 +465,7 @@ namespace detail {
         void deleteJobs(Itr begin, const Itr &end)
         {
           QMutexLocker l(&m_mutex);
+          flushInternal();
 
           m_db.begin();
           while (begin != end)
@@ -419,6 +496,10 @@ namespace detail {
 
         std::string key = j.jobParams().get("workflowkey").children.at(0).value;
 
+        if (isLoading()) return key; // we are currently loading, don't persist that which we are loading
+
+        QMutexLocker l(&m_mutex);
+        flushInternal();
         m_db.begin();
         if (!workflowExists(key))
         {
@@ -430,23 +511,25 @@ namespace detail {
         return key;
       }
 
+      /// Queues the job tree to be written by the next batch
       void persistJobTree(const openstudio::runmanager::Job &t_job)
       {
-        m_db.begin();
-        persistJobRecursive(t_job, false);
-        m_db.commit();
+        QMutexLocker l(&m_pendingMutex);
+        if (m_loading) return; // we are currently loading, don't persist that which we are loading
+
+        queueJobTree(t_job);
       }
 
+      /// Queues the job trees to be written by the next batch
       void persistJobTrees(const std::vector<openstudio::runmanager::Job> &t_jobs)
       {
-        m_db.begin();
+        QMutexLocker l(&m_pendingMutex);
+        if (m_loading) return; // we are currently loading, don't persist that which we are loading
 
         for (const auto & job : t_jobs)
         {
-          persistJobRecursive(job, false);
+          queueJobTree(job);
         }
-
-        m_db.commit();
       }
 
       void persistJobRecursive(const openstudio::runmanager::Job &t_job, bool isWorkflow)
@@ -468,9 +551,6 @@ namespace detail {
 
       void persistJob(const openstudio::runmanager::Job &t_job, bool isWorkflow = false)
       {
-        QMutexLocker l(&m_mutex);
-        if (m_loading) return; // we are currently loading, don't persist that which we are loading
-
         RunManagerDB::Job j(m_db);
         j.uuid = toString(t_job.uuid());
         j.isFinishedJob = false;
@@ -549,12 +629,15 @@ namespace detail {
         }
       }
 
+      /// Queues the job status to be written by the next batch, replacing any status for
+      /// the same job which has not been written yet
       void persistJobStatus(const openstudio::UUID &t_uuid, const JobErrors &t_errors, const boost::optional<openstudio::DateTime> &t_lastRun,
           const Files &t_files)
       {
-        m_db.begin();
-        persistJobStatusInternal(t_uuid, t_errors, t_lastRun, t_files);
-        m_db.commit();
+        QMutexLocker l(&m_pendingMutex);
+        bool wasEmpty = pendingCount() == 0;
+        m_pendingStatuses[t_uuid] = PendingJobStatus(t_errors, t_lastRun, t_files);
+        wakeWriteBehind(wasEmpty);
       }
 
 
@@ -614,13 +697,142 @@ namespace detail {
 
 
     private:
-      mutable QMutex m_mutex;
+      struct PendingJobStatus
+      {
+        PendingJobStatus()
+        {
+        }
+
+        PendingJobStatus(const JobErrors &t_errors, const boost::optional<openstudio::DateTime> &t_lastRun, const Files &t_files)
+          : errors(t_errors), lastRun(t_lastRun), files(t_files)
+        {
+        }
+
+        JobErrors errors;
+        boost::optional<openstudio::DateTime> lastRun;
+        Files files;
+      };
+
+      mutable QMutex m_mutex; // guards m_db
       RunManagerDB::RunManagerDatabase m_db;
       RunManagerDB::ConfigOptions m_config;
       bool m_loading;
       openstudio::path m_dbPath;
       std::shared_ptr<openstudio::runmanager::ConfigOptions> m_configOptions;
 
+      mutable QMutex m_pendingMutex; // guards m_loading and all of the pending write-behind state
+      QWaitCondition m_pendingCondition;
+      std::vector<openstudio::runmanager::Job> m_pendingJobTrees;
+      std::set<openstudio::UUID> m_pendingJobTreeUuids;
+      std::map<openstudio::UUID, PendingJobStatus> m_pendingStatuses;
+      bool m_writeBehindContinue;
+      DBWriteBehindThread m_writeBehindThread;
+
+      /// m_pendingMutex must be held
+      size_t pendingCount() const
+      {
+        return m_pendingJobTrees.size() + m_pendingStatuses.size();
+      }
+
+      /// m_pendingMutex must be held
+      void queueJobTree(const openstudio::runmanager::Job &t_job)
+      {
+        bool wasEmpty = pendingCount() == 0;
+
+        // the tree is written from the job's state at flush time, so it only needs to be queued once
+        if (m_pendingJobTreeUuids.insert(t_job.uuid()).second)
+        {
+          m_pendingJobTrees.push_back(t_job);
+        }
+
+        wakeWriteBehind(wasEmpty);
+      }
+
+      /// m_pendingMutex must be held
+      void wakeWriteBehind(bool t_wasEmpty)
+      {
+        // wake the writer when it is idle, or when it is holding a full batch
+        if (t_wasEmpty || pendingCount() >= writeBehindBatchSize())
+        {
+          m_pendingCondition.wakeAll();
+        }
+      }
+
+      /// Body of the write-behind thread
+      void writeBehind()
+      {
+        QMutexLocker l(&m_pendingMutex);
+
+        while (true)
+        {
+          while (m_writeBehindContinue && pendingCount() == 0)
+          {
+            m_pendingCondition.wait(&m_pendingMutex);
+          }
+
+          if (m_writeBehindContinue && pendingCount() < writeBehindBatchSize())
+          {
+            // give further changes a chance to be coalesced into this batch
+            m_pendingCondition.wait(&m_pendingMutex, writeBehindInterval());
+          }
+
+          bool cont = m_writeBehindContinue;
+          l.unlock();
+
+          try {
+            flush();
+          } catch (const std::exception &e) {
+            LOG(Error, "(" << openstudio::toString(m_dbPath) << ") Error writing job state to database: " << e.what());
+          }
+
+          if (!cont)
+          {
+            return;
+          }
+
+          l.relock();
+        }
+      }
+
+      /// Writes the pending changes in one transaction, m_mutex must be held
+      void flushInternal()
+      {
+        std::vector<openstudio::runmanager::Job> jobTrees;
+        std::map<openstudio::UUID, PendingJobStatus> statuses;
+
+        {
+          QMutexLocker l(&m_pendingMutex);
+          jobTrees.swap(m_pendingJobTrees);
+          statuses.swap(m_pendingStatuses);
+          m_pendingJobTreeUuids.clear();
+        }
+
+        if (jobTrees.empty() && statuses.empty())
+        {
+          return;
+        }
+
+        LOG(Debug, "(" << openstudio::toString(m_dbPath) << ") Writing " << jobTrees.size() << " job trees and "
+            << statuses.size() << " job statuses");
+
+        m_db.begin();
+        try {
+          for (const auto & job : jobTrees)
+          {
+            persistJobRecursive(job, false);
+          }
+
+          for (const auto & status : statuses)
+          {
+            persistJobStatusInternal(status.first, status.second.errors, status.second.lastRun, status.second.files);
+          }
+        } catch (...) {
+          m_db.rollback();
+          throw;
+        }
+        m_db.commit();
+      }
+
       std::vector<openstudio::runmanager::Job> loadJobsImpl(bool isWorkflow, const std::string &workflowkey)
       {
         LOG(Trace, "Loading jobs with workflow key: " << workflowkey);
@@ -45,6 +45,7 @@
 #include "../../../ruleset/OSArgument.hpp"
 
 #include <fstream>
+#include <algorithm>
 
 #include <resources.hxx>
 
@@ -321,4 +322,53 @@ TEST_F(RunManagerTestFixture, JobStatePersistence_Uncompleted)
   }
 }
 
+TEST_F(RunManagerTestFixture, JobStatePersistence_WriteBehind)
+{
+  openstudio::path outdir = openstudio::tempDir() / openstudio::toPath("JobStatePersistence_WriteBehind");
+  openstudio::path db = outdir / openstudio::toPath("test.db");
+  boost::filesystem::create_directories(outdir);
+  boost::filesystem::remove(db);
+
+  {
+    openstudio::runmanager::RunManager rm(db, true, true);
+
+    // many small job trees, queued faster than they are written
+    for (int i = 0; i < 200; ++i)
+    {
+      openstudio::runmanager::Workflow wf("null->null");
+      wf.addParam(openstudio::runmanager::JobParam("flatoutdir"));
+      rm.enqueue(wf.create(outdir), true);
+    }
+    ASSERT_EQ(rm.getJobs().size(), 400u);
+
+    // removing a job must not be undone by a pending write of its tree
+    std::vector<openstudio::runmanager::Job> jobs = rm.getJobs();
+    auto removed = std::find_if(jobs.begin(), jobs.end(),
+        [](const openstudio::runmanager::Job &t_job) { return !t_job.parent(); });
+    ASSERT_TRUE(removed != jobs.end());
+    rm.remove(*removed);
+    ASSERT_EQ(rm.getJobs().size(), 398u);
+
+    rm.setPaused(false);
+    rm.waitForFinished();
+
+    ASSERT_FALSE(rm.workPending());
+  }
+
+  {
+    // everything queued before a clean shutdown has been written
+    openstudio::runmanager::RunManager rm(db, true, true);
+
+    ASSERT_FALSE(rm.workPending());
+
+    std::vector<openstudio::runmanager::Job> jobs = rm.getJobs();
+    ASSERT_EQ(jobs.size(), 398u);
+
+    for (const auto & job : jobs)
+    {
+      EXPECT_TRUE(job.lastRun());
+      EXPECT_TRUE(job.errors().succeeded());
+    }
+  }
+}
 
@@ -283,6 +283,13 @@ namespace detail {
         errors.push_back(std::make_pair(ErrorType::Warning, efwarning));
       }
 
+      if (m_error_file->numWarnings() > efwarnings.size())
+      {
+        errors.push_back(std::make_pair(ErrorType::Warning, 
+              boost::lexical_cast<std::string>(m_error_file->numWarnings() - efwarnings.size()) 
+              + " repeated warnings are not listed, see eplusout.err"));
+      }
+
       for (const auto & efsevereError : efsevereErrors)
       {
         errors.push_back(std::make_pair(ErrorType::Error, efsevereError));
@@ -835,6 +842,39 @@ namespace detail {
 
   void ToolBasedJob::processOutputFileChanged(const openstudio::runmanager::FileInfo &f)
   {
+    if (f.filename == "eplusout.err" && boost::filesystem::exists(f.fullPath))
+    {
+      QWriteLocker l(&m_mutex);
+      size_t numFatalErrors = 0;
+      if (m_live_error_file && m_live_error_path == f.fullPath)
+      {
+        numFatalErrors = m_live_error_file->fatalErrors().size();
+        m_live_error_file->update();
+      } else {
+        m_live_error_path = f.fullPath;
+        m_live_error_file = openstudio::energyplus::ErrorFile(f.fullPath);
+      }
+
+      std::vector<std::string> fatalErrors = m_live_error_file->fatalErrors();
+      for (size_t i = numFatalErrors; i < fatalErrors.size(); ++i)
+      {
+        LOG(Error, "ToolBasedJob " << toString(uuid()) << " EnergyPlus fatal error: " << fatalErrors[i]);
+      }
+
+      if (fatalErrors.size() > numFatalErrors)
+      {
+        // report the failure now rather than when EnergyPlus exits,
+        // processResultFiles replaces this with the whole file at exit
+        m_error_info.errorFile(*m_live_error_file);
+        JobErrors e = m_error_info.errors();
+        l.unlock();
+        setErrors(e);
+        emitStateChanged();
+      } else {
+        l.unlock();
+      }
+    }
+
     emitOutputFileChanged(f);
   }
 
@@ -997,8 +1037,16 @@ namespace detail {
     if (boost::filesystem::exists(errpath))
     {
       LOG(Debug, "Setting error file: " << openstudio::toString(errpath));
-      m_error_info.errorFile(openstudio::energyplus::ErrorFile(errpath));
+      if (m_live_error_file && m_live_error_path == errpath)
+      {
+        // only the tail written since the last change notification still needs to be read
+        m_live_error_file->update();
+        m_error_info.errorFile(*m_live_error_file);
+      } else {
+        m_error_info.errorFile(openstudio::energyplus::ErrorFile(errpath));
+      }
     }
+    m_live_error_file.reset();
 
     std::vector<FileInfo> resultpaths = t_outfiles.getAllByFilename("result.ossr").files();
     if (!resultpaths.empty())
@@ -259,6 +259,10 @@ namespace detail {
       /// Current collected error information for the running job
       ErrorInfo m_error_info;
 
+      /// eplusout.err followed while the current process runs, so fatal errors are logged as they are written
+      boost::optional<openstudio::energyplus::ErrorFile> m_live_error_file;
+      openstudio::path m_live_error_path;
+
       bool m_noOutputError; ///< if no output file is generated then it is an error case
 
       size_t m_currentToolIndex; ///< Index of the currently processing tool for this job
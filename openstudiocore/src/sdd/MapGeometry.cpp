@@ -292,7 +292,7 @@ namespace sdd {
 
     OS_ASSERT(!nameElement.isNull());
     std::string spaceName = escapeName(nameElement.text());
-    boost::optional<model::Space> space = buildingStory.model().getModelObjectByName<model::Space>(spaceName);
+    boost::optional<model::Space> space = modelObjectByName<model::Space>(buildingStory.model(), spaceName);
     OS_ASSERT(space); // what type of error handling do we want?
 
     space->setBuildingStory(buildingStory);
@@ -300,7 +300,7 @@ namespace sdd {
     QDomElement thermalZoneElement = element.firstChildElement("ThrmlZnRef");
     OS_ASSERT(!thermalZoneElement.isNull());
     std::string thermalZoneName = escapeName(thermalZoneElement.text());
-    boost::optional<model::ThermalZone> thermalZone = space->model().getModelObjectByName<model::ThermalZone>(thermalZoneName);
+    boost::optional<model::ThermalZone> thermalZone = modelObjectByName<model::ThermalZone>(space->model(), thermalZoneName);
     OS_ASSERT(thermalZone);
     space->setThermalZone(*thermalZone);
 
@@ -411,7 +411,7 @@ namespace sdd {
 
       equipment.setName(spaceName + " Water Use Equipment");
 
-      if( boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(hotWtrHtgSchRefElement.text().toStdString()) )
+      if( boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, hotWtrHtgSchRefElement.text().toStdString()) )
       {
         equipment.setFlowRateFractionSchedule(schedule.get());
       }
@@ -484,7 +484,7 @@ namespace sdd {
           openstudio::model::ScheduleRuleset activitySchedule(model, totalHeatRateSI);
           activitySchedule.setName(name + " People Activity Level");
 
-          //boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>("Activity Level");
+          //boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = modelObjectByName<model::ScheduleTypeLimits>(model, "Activity Level");
           //if (!scheduleTypeLimits){
           //  scheduleTypeLimits = model::ScheduleTypeLimits(model);
           //  scheduleTypeLimits->setName("Activity Level");
@@ -501,7 +501,7 @@ namespace sdd {
 
           if (!occSchRefElement.isNull()){
             std::string scheduleName = escapeName(occSchRefElement.text());
-            boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
             if (schedule){
               people.setNumberofPeopleSchedule(*schedule);
             }else{
@@ -570,7 +570,7 @@ namespace sdd {
 
             if (!infSchRefElement.isNull()){
               std::string scheduleName = escapeName(infSchRefElement.text());
-              boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+              boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
               if (schedule){
                 spaceInfiltrationDesignFlowRate.setSchedule(*schedule);
               }else{
@@ -645,7 +645,7 @@ namespace sdd {
 
         if (!intLtgRegSchRefElement.isNull()){
           std::string scheduleName = escapeName(intLtgRegSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             lights.setSchedule(*schedule);
           }else{
@@ -689,7 +689,7 @@ namespace sdd {
 
         if (!intLtgNonRegSchRefElement.isNull()){
           std::string scheduleName = escapeName(intLtgNonRegSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             lights.setSchedule(*schedule);
           }else{
@@ -754,7 +754,7 @@ namespace sdd {
 
         if (!recptPwrDensSchRefElement.isNull()){
           std::string scheduleName = escapeName(recptPwrDensSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -806,7 +806,7 @@ namespace sdd {
 
         if (!gasEqpPwrDensSchRefElement.isNull()){
           std::string scheduleName = escapeName(gasEqpPwrDensSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             gasEquipment.setSchedule(*schedule);
           }else{
@@ -857,7 +857,7 @@ namespace sdd {
 
         if (!procElecSchRefElement.isNull()){
           std::string scheduleName = escapeName(procElecSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -908,7 +908,7 @@ namespace sdd {
 
         if (!commRfrgEqpSchRefElement.isNull()){
           std::string scheduleName = escapeName(commRfrgEqpSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -954,7 +954,7 @@ namespace sdd {
 
         if (!elevSchRefElement.isNull()){
           std::string scheduleName = escapeName(elevSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1000,7 +1000,7 @@ namespace sdd {
 
         if (!escalSchRefElement.isNull()){
           std::string scheduleName = escapeName(escalSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1051,7 +1051,7 @@ namespace sdd {
 
         if (!procGasSchRefElement.isNull()){
           std::string scheduleName = escapeName(procGasSchRefElement.text());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule){
             gasEquipment.setSchedule(*schedule);
           }else{
@@ -1121,7 +1121,7 @@ namespace sdd {
     QDomElement constructionReferenceElement = element.firstChildElement("ConsAssmRef");
     if(!constructionReferenceElement.isNull()){
       std::string constructionName = escapeName(constructionReferenceElement.text());
-      boost::optional<model::ConstructionBase> construction = space.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+      boost::optional<model::ConstructionBase> construction = modelObjectByName<model::ConstructionBase>(space.model(), constructionName);
       if(construction){
         surface.setConstruction(*construction);
       }else{
@@ -1243,7 +1243,7 @@ namespace sdd {
     QDomElement adjacentSpaceElement = element.firstChildElement("AdjacentSpcRef");
     if (!adjacentSpaceElement.isNull()){
       std::string adjacentSpaceName = escapeName(adjacentSpaceElement.text());
-      boost::optional<model::Space> otherSpace = space.model().getModelObjectByName<model::Space>(adjacentSpaceName);
+      boost::optional<model::Space> otherSpace = modelObjectByName<model::Space>(space.model(), adjacentSpaceName);
       OS_ASSERT(otherSpace); // what type of error handling do we want?
 
       // clone the surface and sub surfaces with reverse vertices
@@ -1309,7 +1309,7 @@ namespace sdd {
       QDomElement constructionReferenceElement = element.firstChildElement("FenConsRef");
       if(!constructionReferenceElement.isNull()){
         std::string constructionName = escapeName(constructionReferenceElement.text());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = modelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if(construction){
           subSurface.setConstruction(*construction);
         }else{
@@ -1324,7 +1324,7 @@ namespace sdd {
       QDomElement constructionReferenceElement = element.firstChildElement("DrConsRef");
       if(!constructionReferenceElement.isNull()){
         std::string constructionName = escapeName(constructionReferenceElement.text());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = modelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if(construction){
           subSurface.setConstruction(*construction);
         }else{
@@ -1339,7 +1339,7 @@ namespace sdd {
       QDomElement constructionReferenceElement = element.firstChildElement("FenConsRef");
       if(!constructionReferenceElement.isNull()){
         std::string constructionName = escapeName(constructionReferenceElement.text());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = modelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if(construction){
           subSurface.setConstruction(*construction);
         }else{
@@ -1452,7 +1452,7 @@ namespace sdd {
           QDomElement scheduleReferenceElement = element.firstChildElement("TransSchRef");
           if (!scheduleReferenceElement.isNull()){
             scheduleName = escapeName(scheduleReferenceElement.text());
-            schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            schedule = modelObjectByName<model::Schedule>(model, scheduleName);
             if (!schedule){
               LOG(Error, "Cannot find shading schedule '" << scheduleName << "' for shading surface '" << name << "'");
             }
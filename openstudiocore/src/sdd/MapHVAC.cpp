@@ -508,7 +508,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
   boost::optional<model::Schedule> availabilitySchedule; 
   if( ! airHndlrAvailSchElement.isNull() )
   {
-      availabilitySchedule = model.getModelObjectByName<model::Schedule>(airHndlrAvailSchElement.text().toStdString());
+      availabilitySchedule = modelObjectByName<model::Schedule>(model, airHndlrAvailSchElement.text().toStdString());
   }
 
   if( availabilitySchedule )
@@ -937,7 +937,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
       // MinOAFracSchRef
       QDomElement minOAFracSchRefElement = airSystemOACtrlElement.firstChildElement("MinOAFracSchRef");
       if( boost::optional<model::Schedule> schedule = 
-          model.getModelObjectByName<model::Schedule>(minOAFracSchRefElement.text().toStdString()) )
+          modelObjectByName<model::Schedule>(model, minOAFracSchRefElement.text().toStdString()) )
       {
         oaController.setMinimumFractionofOutdoorAirSchedule(schedule.get());
       }
@@ -945,7 +945,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
       // MaxOAFracSchRef
       QDomElement maxOAFracSchRefElement = airSystemOACtrlElement.firstChildElement("MaxOAFracSchRef");
       if( boost::optional<model::Schedule> schedule = 
-          model.getModelObjectByName<model::Schedule>(maxOAFracSchRefElement.text().toStdString()) ) {
+          modelObjectByName<model::Schedule>(model, maxOAFracSchRefElement.text().toStdString()) ) {
         oaController.setMaximumFractionofOutdoorAirSchedule(schedule.get());
       } else {
         // MaxOARat
@@ -997,7 +997,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
         QDomElement oaSchRefElement = airSystemOACtrlElement.firstChildElement("OASchRef");
 
         boost::optional<model::Schedule> schedule; 
-        schedule = model.getModelObjectByName<model::Schedule>(oaSchRefElement.text().toStdString());
+        schedule = modelObjectByName<model::Schedule>(model, oaSchRefElement.text().toStdString());
 
         if( schedule )
         {
@@ -1259,7 +1259,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
   {
     QDomElement clgSetPtSchRefElement = airSystemElement.firstChildElement("ClgSetptSchRef");
 
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(clgSetPtSchRefElement.text().toStdString());
+    boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, clgSetPtSchRefElement.text().toStdString());
 
     if( ! schedule )
     {
@@ -1557,8 +1557,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
     QDomElement hirCurveElement = 
       heatingCoilElement.firstChildElement("FurnHIR_fPLRCrvRef");
     hirCurve = 
-      model.getModelObjectByName<model::Curve>(
-        hirCurveElement.text().toStdString());
+      modelObjectByName<model::Curve>(model, hirCurveElement.text().toStdString());
     if( hirCurve )
     {
       coil.setPartLoadFractionCorrelationCurve(hirCurve.get());
@@ -1771,8 +1770,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement totalHeatingCapacityFunctionofTemperatureCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpCap_fTempCrvRef");
       totalHeatingCapacityFunctionofTemperatureCurve = 
-        model.getModelObjectByName<model::Curve>(
-          totalHeatingCapacityFunctionofTemperatureCurveElement.text().toStdString());
+        modelObjectByName<model::Curve>(model, totalHeatingCapacityFunctionofTemperatureCurveElement.text().toStdString());
 
       if( ! totalHeatingCapacityFunctionofTemperatureCurve )
       {
@@ -1792,8 +1790,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement totalHeatingCapacityFunctionofFlowFractionCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpCap_fFlowCrvRef");
       totalHeatingCapacityFunctionofFlowFractionCurve = 
-        model.getModelObjectByName<model::Curve>(
-          totalHeatingCapacityFunctionofFlowFractionCurveElement.text().toStdString());
+        modelObjectByName<model::Curve>(model, totalHeatingCapacityFunctionofFlowFractionCurveElement.text().toStdString());
 
       if( ! totalHeatingCapacityFunctionofFlowFractionCurve )
       {
@@ -1813,8 +1810,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement energyInputRatioFunctionofTemperatureCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpEIR_fTempCrvRef");
       energyInputRatioFunctionofTemperatureCurve = 
-        model.getModelObjectByName<model::Curve>(
-          energyInputRatioFunctionofTemperatureCurveElement.text().toStdString());
+        modelObjectByName<model::Curve>(model, energyInputRatioFunctionofTemperatureCurveElement.text().toStdString());
 
       if( ! energyInputRatioFunctionofTemperatureCurve )
       {
@@ -1834,8 +1830,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement energyInputRatioFunctionofFlowFractionCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpEIR_fFlowCrvRef");
       energyInputRatioFunctionofFlowFractionCurve = 
-        model.getModelObjectByName<model::Curve>(
-          energyInputRatioFunctionofFlowFractionCurveElement.text().toStdString());
+        modelObjectByName<model::Curve>(model, energyInputRatioFunctionofFlowFractionCurveElement.text().toStdString());
 
       if( ! energyInputRatioFunctionofFlowFractionCurve )
       {
@@ -1854,8 +1849,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement partLoadFractionCorrelationCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpEIR_fPLFCrvRef");
       partLoadFractionCorrelationCurve = 
-        model.getModelObjectByName<model::Curve>(
-          partLoadFractionCorrelationCurveElement.text().toStdString());
+        modelObjectByName<model::Curve>(model, partLoadFractionCorrelationCurveElement.text().toStdString());
 
       if( ! partLoadFractionCorrelationCurve )
       {
@@ -2138,7 +2132,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
         // Pwr_fPLRCrvRef
         QDomElement pwr_fPLRCrvElement = fanElement.firstChildElement("Pwr_fPLRCrvRef");
         boost::optional<model::Curve> pwr_fPLRCrv;
-        pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().toStdString());
+        pwr_fPLRCrv = modelObjectByName<model::Curve>(model, pwr_fPLRCrvElement.text().toStdString());
         if( pwr_fPLRCrv )
         {
           fan.setFanPowerRatioFunctionofSpeedRatioCurve(pwr_fPLRCrv.get());
@@ -2264,7 +2258,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
     // Pwr_fPLRCrvRef
     QDomElement pwr_fPLRCrvElement = fanElement.firstChildElement("Pwr_fPLRCrvRef");
     boost::optional<model::Curve> pwr_fPLRCrv;
-    pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().toStdString());
+    pwr_fPLRCrv = modelObjectByName<model::Curve>(model, pwr_fPLRCrvElement.text().toStdString());
     if( pwr_fPLRCrv )
     {
       if( boost::optional<model::CurveCubic> curveCubic = pwr_fPLRCrv->optionalCast<model::CurveCubic>() )
@@ -2591,7 +2585,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofTemp;
       QDomElement cap_fTempCrvRefElement = coolingCoilElement.firstChildElement("Cap_fTempCrvRef");
-      coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().toStdString());
+      coolingCurveFofTemp = modelObjectByName<model::Curve>(model, cap_fTempCrvRefElement.text().toStdString());
       if( ! coolingCurveFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fTempCrvRef");
@@ -2615,7 +2609,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       
       boost::optional<model::Curve> coolingCurveFofFlow;
       QDomElement cap_fFlowCrvRefElement = coolingCoilElement.firstChildElement("Cap_fFlowCrvRef");
-      coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().toStdString());
+      coolingCurveFofFlow = modelObjectByName<model::Curve>(model, cap_fFlowCrvRefElement.text().toStdString());
       if( ! coolingCurveFofFlow )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fFlowCrvRef");
@@ -2635,7 +2629,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofTemp;
       QDomElement dxEIR_fTempCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fTempCrvRef");
-      energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().toStdString());
+      energyInputRatioFofTemp = modelObjectByName<model::Curve>(model, dxEIR_fTempCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fTempCrvRef");
@@ -2659,7 +2653,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofFlow;
       QDomElement dxEIR_fFlowCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fFlowCrvRef");
-      energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().toStdString());
+      energyInputRatioFofFlow = modelObjectByName<model::Curve>(model, dxEIR_fFlowCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofFlow )
       {
         model::CurveQuadratic _energyInputRatioFofFlow(model);
@@ -2675,7 +2669,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> partLoadFraction;
       QDomElement dxEIR_fPLFCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fPLFCrvRef");
-      partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().toStdString());
+      partLoadFraction = modelObjectByName<model::Curve>(model, dxEIR_fPLFCrvRefElement.text().toStdString());
       if( ! partLoadFraction )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fPLFCrvRef");
@@ -2785,7 +2779,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofTemp;
       QDomElement cap_fTempCrvRefElement = coolingCoilElement.firstChildElement("Cap_fTempCrvRef");
-      coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().toStdString());
+      coolingCurveFofTemp = modelObjectByName<model::Curve>(model, cap_fTempCrvRefElement.text().toStdString());
       if( ! coolingCurveFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fTempCrvRef");
@@ -2809,7 +2803,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       
       boost::optional<model::Curve> coolingCurveFofFlow;
       QDomElement cap_fFlowCrvRefElement = coolingCoilElement.firstChildElement("Cap_fFlowCrvRef");
-      coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().toStdString());
+      coolingCurveFofFlow = modelObjectByName<model::Curve>(model, cap_fFlowCrvRefElement.text().toStdString());
       if( ! coolingCurveFofFlow )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fFlowCrvRef");
@@ -2829,7 +2823,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofTemp;
       QDomElement dxEIR_fTempCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fTempCrvRef");
-      energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().toStdString());
+      energyInputRatioFofTemp = modelObjectByName<model::Curve>(model, dxEIR_fTempCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fTempCrvRef");
@@ -2853,7 +2847,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofFlow;
       QDomElement dxEIR_fFlowCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fFlowCrvRef");
-      energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().toStdString());
+      energyInputRatioFofFlow = modelObjectByName<model::Curve>(model, dxEIR_fFlowCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofFlow )
       {
         model::CurveQuadratic _energyInputRatioFofFlow(model);
@@ -2869,7 +2863,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> partLoadFraction;
       QDomElement dxEIR_fPLFCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fPLFCrvRef");
-      partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().toStdString());
+      partLoadFraction = modelObjectByName<model::Curve>(model, dxEIR_fPLFCrvRefElement.text().toStdString());
       if( ! partLoadFraction )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fPLFCrvRef");
@@ -3100,7 +3094,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   // Name
   QDomElement nameElement = thermalZoneElement.firstChildElement("Name");
   std::string name = nameElement.text().toStdString();
-  optionalThermalZone = model.getModelObjectByName<model::ThermalZone>(name);
+  optionalThermalZone = modelObjectByName<model::ThermalZone>(model, name);
 
   if( ! optionalThermalZone )
   {
@@ -3256,7 +3250,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhAvailSchRefElement = thermalZoneElement.firstChildElement("ExhAvailSchRef");
     std::string exhAvailSchRef = escapeName(exhAvailSchRefElement.text());
-    boost::optional<model::Schedule> exhAvailSch = model.getModelObjectByName<model::Schedule>(exhAvailSchRef);
+    boost::optional<model::Schedule> exhAvailSch = modelObjectByName<model::Schedule>(model, exhAvailSchRef);
     if( exhAvailSch )
     {
       exhaustFan.setAvailabilitySchedule(exhAvailSch.get());
@@ -3279,7 +3273,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhFlowSchRefElement = thermalZoneElement.firstChildElement("ExhFlowSchRef");
     std::string exhFlowSchRef = escapeName(exhFlowSchRefElement.text());
-    boost::optional<model::Schedule> exhFlowSch = model.getModelObjectByName<model::Schedule>(exhFlowSchRef);
+    boost::optional<model::Schedule> exhFlowSch = modelObjectByName<model::Schedule>(model, exhFlowSchRef);
     if( exhFlowSch )
     {
       exhaustFan.setFlowFractionSchedule(exhFlowSch.get());
@@ -3297,7 +3291,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhMinTempSchRefElement = thermalZoneElement.firstChildElement("ExhMinTempSchRef");
     std::string exhMinTempSchRef = escapeName(exhMinTempSchRefElement.text());
-    boost::optional<model::Schedule> exhMinTempSch = model.getModelObjectByName<model::Schedule>(exhMinTempSchRef);
+    boost::optional<model::Schedule> exhMinTempSch = modelObjectByName<model::Schedule>(model, exhMinTempSchRef);
     if( exhMinTempSch )
     {
       exhaustFan.setMinimumZoneTemperatureLimitSchedule(exhMinTempSch.get());
@@ -3305,7 +3299,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhBalancedSchRefElement = thermalZoneElement.firstChildElement("ExhBalancedSchRef");
     std::string exhBalancedSchRef = escapeName(exhBalancedSchRefElement.text());
-    boost::optional<model::Schedule> exhBalancedSch = model.getModelObjectByName<model::Schedule>(exhBalancedSchRef);
+    boost::optional<model::Schedule> exhBalancedSch = modelObjectByName<model::Schedule>(model, exhBalancedSchRef);
     if( exhBalancedSch )
     {
       exhaustFan.setBalancedExhaustFractionSchedule(exhBalancedSch.get());
@@ -3530,7 +3524,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   // ThermalZoneVentilationSystem
   if( ventSysRefElement.text() != primAirCondSysRefElement.text() )
   {
-    airLoopHVAC = model.getModelObjectByName<model::AirLoopHVAC>(ventSysRefElement.text().toStdString());
+    airLoopHVAC = modelObjectByName<model::AirLoopHVAC>(model, ventSysRefElement.text().toStdString());
 
     if( airLoopHVAC && ! thermalZone.airLoopHVAC() )
     {
@@ -3540,7 +3534,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
         {
           airLoopHVAC->addBranchForZone(thermalZone,trmlUnit->cast<model::StraightComponent>());
           QDomElement inducedAirZnRefElement = trmlUnitElement.firstChildElement("InducedAirZnRef");
-          if( boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().toStdString()) )
+          if( boost::optional<model::ThermalZone> tz = modelObjectByName<model::ThermalZone>(model, inducedAirZnRefElement.text().toStdString()) )
           {
              if( tz->isPlenum() )
              {
@@ -3621,7 +3615,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   }
   else
   {
-    airLoopHVAC = model.getModelObjectByName<model::AirLoopHVAC>(primAirCondSysRefElement.text().toStdString());
+    airLoopHVAC = modelObjectByName<model::AirLoopHVAC>(model, primAirCondSysRefElement.text().toStdString());
 
     if( airLoopHVAC && ! thermalZone.airLoopHVAC() )
     {
@@ -3631,7 +3625,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
         {
           airLoopHVAC->addBranchForZone(thermalZone,trmlUnit->cast<model::StraightComponent>());
           QDomElement inducedAirZnRefElement = trmlUnitElement.firstChildElement("InducedAirZnRef");
-          if( boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().toStdString()) )
+          if( boost::optional<model::ThermalZone> tz = modelObjectByName<model::ThermalZone>(model, inducedAirZnRefElement.text().toStdString()) )
           {
              if( tz->isPlenum() )
              {
@@ -3668,7 +3662,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   QDomElement clgTstatSchRefElement = thermalZoneElement.firstChildElement("ClgTstatSchRef");
   if (!clgTstatSchRefElement.isNull()){
     std::string scheduleName = escapeName(clgTstatSchRefElement.text());
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+    boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
     if (schedule){
       if (optionalThermostat){
         optionalThermostat->setCoolingSchedule(*schedule);
@@ -3698,7 +3692,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   QDomElement htgTstatSchRefElement = thermalZoneElement.firstChildElement("HtgTstatSchRef");
   if (!htgTstatSchRefElement.isNull()){
     std::string scheduleName = escapeName(htgTstatSchRefElement.text());
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+    boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, scheduleName);
     if (schedule){
       if (optionalThermostat){
         optionalThermostat->setHeatingSchedule(*schedule);
@@ -3731,7 +3725,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   {
     QDomElement rtnPlenumZnRefElement = thermalZoneElement.firstChildElement("RetPlenumZnRef");
     boost::optional<model::ThermalZone> returnPlenumZone;
-    returnPlenumZone = model.getModelObjectByName<model::ThermalZone>(rtnPlenumZnRefElement.text().toStdString()); 
+    returnPlenumZone = modelObjectByName<model::ThermalZone>(model, rtnPlenumZnRefElement.text().toStdString()); 
     if( returnPlenumZone )
     {
       thermalZone.setReturnPlenum(returnPlenumZone.get());  
@@ -3739,7 +3733,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement supPlenumZnRefElement = thermalZoneElement.firstChildElement("SupPlenumZnRef");
     boost::optional<model::ThermalZone> supplyPlenumZone;
-    supplyPlenumZone = model.getModelObjectByName<model::ThermalZone>(supPlenumZnRefElement.text().toStdString());
+    supplyPlenumZone = modelObjectByName<model::ThermalZone>(model, supPlenumZnRefElement.text().toStdString());
     if( supplyPlenumZone )
     {
       thermalZone.setSupplyPlenum(supplyPlenumZone.get());
@@ -3789,7 +3783,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
 
   // AvailSchRef
   QDomElement availSchRefElement = trmlUnitElement.firstChildElement("AvailSchRef");
-  boost::optional<model::Schedule> availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().toStdString());
+  boost::optional<model::Schedule> availSch = modelObjectByName<model::Schedule>(model, availSchRefElement.text().toStdString());
 
   // Type
   QDomElement typeElement = trmlUnitElement.firstChildElement("Type");
@@ -3829,7 +3823,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
     model::AirTerminalSingleDuctVAVNoReheat terminal(model,schedule);
 
     QDomElement minAirFracSchRefElement = trmlUnitElement.firstChildElement("MinAirFracSchRef");
-    if( boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().toStdString()) )
+    if( boost::optional<model::Schedule> minAirFracSch = modelObjectByName<model::Schedule>(model, minAirFracSchRefElement.text().toStdString()) )
     {
       terminal.setZoneMinimumAirFlowInputMethod("Scheduled");
       terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
@@ -3883,7 +3877,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
     model::AirTerminalSingleDuctVAVReheat terminal(model,schedule,coil.get());
 
     QDomElement minAirFracSchRefElement = trmlUnitElement.firstChildElement("MinAirFracSchRef");
-    if( boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().toStdString()) )
+    if( boost::optional<model::Schedule> minAirFracSch = modelObjectByName<model::Schedule>(model, minAirFracSchRefElement.text().toStdString()) )
     {
       terminal.setZoneMinimumAirFlowMethod("Scheduled");
       terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
@@ -4194,7 +4188,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
 
   QDomElement nameElement = fluidSysElement.firstChildElement("Name");
 
-  if( boost::optional<model::PlantLoop> plant = model.getModelObjectByName<model::PlantLoop>(nameElement.text().toStdString()) )
+  if( boost::optional<model::PlantLoop> plant = modelObjectByName<model::PlantLoop>(model, nameElement.text().toStdString()) )
   {
     return plant.get();
   }
@@ -4617,7 +4611,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
   {
     QDomElement tempSetPtSchRefElement = fluidSysElement.firstChildElement("TempSetptSchRef");
 
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(tempSetPtSchRefElement.text().toStdString());
+    boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, tempSetPtSchRefElement.text().toStdString());
 
     if( ! schedule )
     {
@@ -5054,7 +5048,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translatePump
 
     boost::optional<model::CurveCubic> pwr_fPLRCrv;
     QDomElement pwr_fPLRCrvRefElement = pumpElement.firstChildElement("Pwr_fPLRCrvRef");
-    pwr_fPLRCrv = model.getModelObjectByName<model::CurveCubic>(pwr_fPLRCrvRefElement.text().toStdString());
+    pwr_fPLRCrv = modelObjectByName<model::CurveCubic>(model, pwr_fPLRCrvRefElement.text().toStdString());
 
     if( pwr_fPLRCrv )
     {
@@ -5116,7 +5110,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateBoil
 
   boost::optional<model::Curve> hirfPLRCrv;
   QDomElement hirfPLRCrvRefElement = boilerElement.firstChildElement("HIR_fPLRCrvRef");
-  hirfPLRCrv = model.getModelObjectByName<model::Curve>(hirfPLRCrvRefElement.text().toStdString());
+  hirfPLRCrv = modelObjectByName<model::Curve>(model, hirfPLRCrvRefElement.text().toStdString());
   if( hirfPLRCrv )
   {
     boiler.setNormalizedBoilerEfficiencyCurve(hirfPLRCrv.get());
@@ -5315,7 +5309,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateHtRe
 
     boost::optional<model::CurveCubic> vsdFanPwrRatio_fQRatio;
     QDomElement vsdFanPwrRatio_fQRatioElement = htRejElement.firstChildElement("VSDFanPwrRatio_fQRatio");
-    vsdFanPwrRatio_fQRatio = model.getModelObjectByName<model::CurveCubic>(vsdFanPwrRatio_fQRatioElement.text().toStdString());
+    vsdFanPwrRatio_fQRatio = modelObjectByName<model::CurveCubic>(model, vsdFanPwrRatio_fQRatioElement.text().toStdString());
 
     if( vsdFanPwrRatio_fQRatio )
     {
@@ -5432,7 +5426,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
   boost::optional<model::CurveBiquadratic> cap_fTempCrv;
   QDomElement cap_fTempCrvElement = chillerElement.firstChildElement("Cap_fTempCrvRef");
-  cap_fTempCrv = model.getModelObjectByName<model::CurveBiquadratic>(cap_fTempCrvElement.text().toStdString());
+  cap_fTempCrv = modelObjectByName<model::CurveBiquadratic>(model, cap_fTempCrvElement.text().toStdString());
   if( ! cap_fTempCrv )
   {
     LOG(Error,"Coil: " << nameElement.text().toStdString() << " Broken Cap_fTempCrv");
@@ -5454,7 +5448,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
   boost::optional<model::CurveBiquadratic> eir_fTempCrv;
   QDomElement eir_fTempCrvElement = chillerElement.firstChildElement("EIR_fTempCrvRef");
-  eir_fTempCrv = model.getModelObjectByName<model::CurveBiquadratic>(eir_fTempCrvElement.text().toStdString());
+  eir_fTempCrv = modelObjectByName<model::CurveBiquadratic>(model, eir_fTempCrvElement.text().toStdString());
   if( ! eir_fTempCrv )
   {
     LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken EIR_fTempCrvRef");
@@ -5476,7 +5470,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
   boost::optional<model::CurveQuadratic> eir_fPLRCrv;
   QDomElement eir_fPLRCrvElement = chillerElement.firstChildElement("EIR_fPLRCrvRef");
-  eir_fPLRCrv = model.getModelObjectByName<model::CurveQuadratic>(eir_fPLRCrvElement.text().toStdString());
+  eir_fPLRCrv = modelObjectByName<model::CurveQuadratic>(model, eir_fPLRCrvElement.text().toStdString());
   if( ! eir_fPLRCrv )
   {
     LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken EIR_fPLRCrvRef");
@@ -5716,7 +5710,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
   // HIR_fPLRCrvRef
 
   QDomElement hirfPLRCrvRefElement = element.firstChildElement("HIR_fPLRCrvRef");
-  boost::optional<model::CurveCubic> hirfPLRCrv = model.getModelObjectByName<model::CurveCubic>(hirfPLRCrvRefElement.text().toStdString());
+  boost::optional<model::CurveCubic> hirfPLRCrv = modelObjectByName<model::CurveCubic>(model, hirfPLRCrvRefElement.text().toStdString());
   if( hirfPLRCrv )
   {
     waterHeaterMixed.setPartLoadFactorCurve(hirfPLRCrv.get());
@@ -5764,7 +5758,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateZnSy
 
   if( ! scheduleElement.isNull() )
   {
-    schedule = model.getModelObjectByName<model::Schedule>(scheduleElement.text().toStdString()); 
+    schedule = modelObjectByName<model::Schedule>(model, scheduleElement.text().toStdString()); 
   }
 
   if( ! schedule )
@@ -6711,8 +6705,14 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCrvQ
   return curve;
 }
 
-QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const QDomDocument & doc)
+void ReverseTranslator::indexElements(const QDomDocument& doc)
 {
+  m_znSysElementMap.clear();
+  m_airSysElementMap.clear();
+  m_trmlUnitElementMap.clear();
+
+  // insert does not replace existing entries, so the first matching element in the document wins
+
   QDomNodeList znSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("ZnSys");
 
   for (int i = 0; i < znSysElements.count(); i++)
@@ -6721,51 +6721,57 @@ QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const
 
     QDomElement znSysNameElement = znSysElement.firstChildElement("Name");
 
-    if( znSysNameElement.text() == znSysName )
-    {
-      return znSysElement;
-    }
+    m_znSysElementMap.insert(std::make_pair(znSysNameElement.text(), znSysElement));
   }
 
-  return QDomElement();
-}
-
-QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc)
-{
   QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-  
+
   for( int i = 0; i < airSystemElements.count(); i++ )
   {
     QDomElement airSystemElement = airSystemElements.at(i).toElement();
+    QDomElement airSystemNameElement = airSystemElement.firstChildElement("Name");
+
+    m_airSysElementMap.insert(std::make_pair(airSystemNameElement.text().toUpper(), airSystemElement));
+
     QDomNodeList terminalElements = airSystemElement.elementsByTagName("TrmlUnit");
     for( int j = 0; j < terminalElements.count(); j++ )
     {
       QDomElement terminalElement = terminalElements.at(j).toElement();
       QDomElement zoneServedElement = terminalElement.firstChildElement("ZnServedRef");
-  
-      if(zoneName.compare(zoneServedElement.text(),Qt::CaseInsensitive) == 0)
-      {
-        return terminalElement;
-      }
+
+      m_trmlUnitElementMap.insert(std::make_pair(zoneServedElement.text().toUpper(), terminalElement));
     }
   }
+}
+
+QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const QDomDocument & doc)
+{
+  auto it = m_znSysElementMap.find(znSysName);
+  if( it != m_znSysElementMap.end() )
+  {
+    return it->second;
+  }
+
+  return QDomElement();
+}
+
+QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc)
+{
+  auto it = m_trmlUnitElementMap.find(zoneName.toUpper());
+  if( it != m_trmlUnitElementMap.end() )
+  {
+    return it->second;
+  }
 
   return QDomElement();
 }
 
 QDomElement ReverseTranslator::findAirSysElement(const QString & airSysName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-  
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  auto it = m_airSysElementMap.find(airSysName.toUpper());
+  if( it != m_airSysElementMap.end() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomElement airSystemNameElement = airSystemElement.firstChildElement("Name");
-  
-    if(airSysName.compare(airSystemNameElement.text(),Qt::CaseInsensitive) == 0)
-    {
-      return airSystemElement;
-    }
+    return it->second;
   }
 
   return QDomElement();
@@ -55,7 +55,7 @@ namespace sdd {
 
     OS_ASSERT(!typeElement.isNull());
     std::string type = escapeName(typeElement.text());
-    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>(type);
+    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = modelObjectByName<model::ScheduleTypeLimits>(model, type);
     bool isTemperature = false;
     if (type == "Temperature"){
       isTemperature = true;
@@ -127,13 +127,13 @@ namespace sdd {
 
     OS_ASSERT(!typeElement.isNull());
     std::string type = escapeName(typeElement.text());
-    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>(type);
+    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = modelObjectByName<model::ScheduleTypeLimits>(model, type);
     if (scheduleTypeLimits){
       //scheduleWeek.setScheduleTypeLimits(*scheduleTypeLimits);
     }
 
     if (!schDaySunRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDaySunRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDaySunRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setSundaySchedule(*scheduleDay);
       }else{
@@ -142,7 +142,7 @@ namespace sdd {
     }
 
     if (!schDayMonRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayMonRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayMonRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setMondaySchedule(*scheduleDay);
       }else{
@@ -151,7 +151,7 @@ namespace sdd {
     }
 
     if (!schDayTueRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayTueRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayTueRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setTuesdaySchedule(*scheduleDay);
       }else{
@@ -160,7 +160,7 @@ namespace sdd {
     }
 
     if (!schDayWedRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayWedRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayWedRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setWednesdaySchedule(*scheduleDay);
       }else{
@@ -169,7 +169,7 @@ namespace sdd {
     }
 
     if (!schDayThuRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayThuRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayThuRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setThursdaySchedule(*scheduleDay);
       }else{
@@ -178,7 +178,7 @@ namespace sdd {
     }
 
     if (!schDayFriRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayFriRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayFriRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setFridaySchedule(*scheduleDay);
       }else{
@@ -187,7 +187,7 @@ namespace sdd {
     }
 
     if (!schDaySatRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDaySatRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDaySatRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setSaturdaySchedule(*scheduleDay);
       }else{
@@ -196,7 +196,7 @@ namespace sdd {
     }
    
     if (!schDayHolRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayHolRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayHolRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setHolidaySchedule(*scheduleDay);
         scheduleWeek.setCustomDay1Schedule(*scheduleDay);
@@ -207,7 +207,7 @@ namespace sdd {
     }
 
     if (!schDayClgDDRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayClgDDRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayClgDDRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setSummerDesignDaySchedule(*scheduleDay);
       }else{
@@ -216,7 +216,7 @@ namespace sdd {
     }
 
     if (!schDayHtgDDRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayHtgDDRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = modelObjectByName<model::ScheduleDay>(model, escapeName(schDayHtgDDRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setWinterDesignDaySchedule(*scheduleDay);
       }else{
@@ -240,7 +240,7 @@ namespace sdd {
 
     OS_ASSERT(!typeElement.isNull());
     std::string type = escapeName(typeElement.text());
-    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>(type);
+    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = modelObjectByName<model::ScheduleTypeLimits>(model, type);
     if (scheduleTypeLimits){
       scheduleYear.setScheduleTypeLimits(*scheduleTypeLimits);
     }
@@ -257,7 +257,7 @@ namespace sdd {
       QDomElement endDayElement = endDayElements.at(i).toElement();
       QDomElement schWeekRefElement = schWeekRefElements.at(i).toElement();
 
-      boost::optional<model::ScheduleWeek> scheduleWeek = model.getModelObjectByName<model::ScheduleWeek>(escapeName(schWeekRefElement.text()));
+      boost::optional<model::ScheduleWeek> scheduleWeek = modelObjectByName<model::ScheduleWeek>(model, escapeName(schWeekRefElement.text()));
       if (scheduleWeek){
 
         boost::optional<model::YearDescription> yearDescription = model.getOptionalUniqueModelObject<model::YearDescription>();
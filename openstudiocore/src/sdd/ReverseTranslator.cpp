@@ -19,6 +19,7 @@
 
 #include "ReverseTranslator.hpp"
 #include "../model/Model.hpp"
+#include "../model/Model_Impl.hpp"
 #include "../model/Component.hpp"
 #include "../model/ModelObject.hpp"
 #include "../model/ModelObject_Impl.hpp"
@@ -86,6 +87,7 @@
 #include "../utilities/filetypes/EpwFile.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/idf/WorkspaceObject_Impl.hpp"
 #include "../utilities/units/QuantityConverter.hpp"
 #include "../utilities/units/IPUnit.hpp"
 #include "../utilities/units/SIUnit.hpp"
@@ -98,6 +100,9 @@
 #include "../utilities/units/UnitFactory.hpp"
 #include "../utilities/units/Unit.hpp"
 
+#include <boost/algorithm/string/case_conv.hpp>
+#include <set>
+
 #include <QFile>
 #include <QDomDocument>
 #include <QDomElement>
@@ -127,6 +132,7 @@ namespace sdd {
 
   ReverseTranslator::~ReverseTranslator()
   {
+    untrackNames();
   }
 
   boost::optional<openstudio::model::Model> ReverseTranslator::loadModel(const openstudio::path& path, ProgressBar* progressBar){
@@ -224,6 +230,10 @@ namespace sdd {
       result = openstudio::model::Model();
       result->setFastNaming(true);
 
+      trackNames(*result);
+
+      indexElements(doc);
+
       // do runperiod
       boost::optional<model::ModelObject> runPeriod = translateRunPeriod(projectElement, doc, *result);
       //OS_ASSERT(!runPeriod.empty()); // what type of error handling do we want?
@@ -1198,6 +1208,8 @@ namespace sdd {
       rt.setToleranceforTimeCoolingSetpointNotMet(0.56);
       rt.setToleranceforTimeHeatingSetpointNotMet(0.56);
     }
+
+    untrackNames();
     
     return result;
   }
@@ -1368,7 +1380,7 @@ namespace sdd {
 
     QDomElement wtrMnTempSchRefElement = element.firstChildElement("WtrMnTempSchRef");
     if (!wtrMnTempSchRefElement.isNull()){
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(wtrMnTempSchRefElement.text().toStdString());
+      boost::optional<model::Schedule> schedule = modelObjectByName<model::Schedule>(model, wtrMnTempSchRefElement.text().toStdString());
       if (schedule){
         model::SiteWaterMainsTemperature waterMains = model.getUniqueModelObject<model::SiteWaterMainsTemperature>();
         waterMains.setTemperatureSchedule(*schedule);
@@ -1488,7 +1500,7 @@ boost::optional<model::PlantLoop> ReverseTranslator::loopForSupplySegment(const
           nameElement.text().toLower() == fluidSegmentName.toLower()
         )
       {
-        boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString());
+        boost::optional<model::PlantLoop> loop = modelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().toStdString());
 
         return loop; 
       }
@@ -1528,7 +1540,7 @@ boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSuppl
             nameElement.text().toLower() == fluidSegmentName.toLower()
           )
         {
-          if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
+          if( boost::optional<model::PlantLoop> loop = modelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().toStdString()) )
           {
             return loop; 
           }
@@ -1547,6 +1559,94 @@ boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSuppl
   return result;
 }
 
+std::vector<WorkspaceObject> ReverseTranslator::indexedObjectsByName(const openstudio::model::Model& model, const std::string& name) const
+{
+  std::vector<WorkspaceObject> result;
+
+  auto range = m_nameIndex.equal_range(boost::to_upper_copy(name));
+  for( auto it = range.first; it != range.second; ++it )
+  {
+    if( boost::optional<WorkspaceObject> object = model.getObject(it->second) )
+    {
+      result.push_back(*object);
+    }
+  }
+
+  return result;
+}
+
+void ReverseTranslator::trackNames(openstudio::model::Model& model)
+{
+  untrackNames();
+  m_nameIndex.clear();
+  m_nameIndexKeys.clear();
+
+  std::shared_ptr<model::detail::Model_Impl> modelImpl = model.getImpl<model::detail::Model_Impl>();
+
+  m_nameIndexConnections.push_back(QObject::connect(modelImpl.get(),
+    static_cast<void (model::detail::Model_Impl::*)(const WorkspaceObject &, const IddObjectType &, const UUID &) const>(&model::detail::Model_Impl::addWorkspaceObject),
+    [this](const WorkspaceObject & object, const IddObjectType &, const UUID &) { trackName(object); }));
+
+  m_nameIndexConnections.push_back(QObject::connect(modelImpl.get(),
+    static_cast<void (model::detail::Model_Impl::*)(const WorkspaceObject &, const IddObjectType &, const UUID &) const>(&model::detail::Model_Impl::removeWorkspaceObject),
+    [this](const WorkspaceObject &, const IddObjectType &, const UUID & handle) { indexName(handle, boost::none); }));
+
+  for( const WorkspaceObject& object : model.objects() )
+  {
+    trackName(object);
+  }
+}
+
+void ReverseTranslator::untrackNames()
+{
+  for( const QMetaObject::Connection& connection : m_nameIndexConnections )
+  {
+    QObject::disconnect(connection);
+  }
+  m_nameIndexConnections.clear();
+}
+
+void ReverseTranslator::trackName(const WorkspaceObject& object)
+{
+  // the object is disconnected from the model before it is removed, so renames after that are ignored
+  Handle handle = object.handle();
+  detail::WorkspaceObject_Impl* objectImpl = object.getImpl<detail::WorkspaceObject_Impl>().get();
+  m_nameIndexConnections.push_back(QObject::connect(objectImpl, &detail::IdfObject_Impl::onNameChange,
+    [this, objectImpl, handle]() {
+      if( objectImpl->initialized() )
+      {
+        indexName(handle, objectImpl->name());
+      }
+    }));
+
+  indexName(handle, object.name());
+}
+
+void ReverseTranslator::indexName(const Handle& handle, const boost::optional<std::string>& name)
+{
+  auto it = m_nameIndexKeys.find(handle);
+  if( it != m_nameIndexKeys.end() )
+  {
+    auto range = m_nameIndex.equal_range(it->second);
+    for( auto jt = range.first; jt != range.second; ++jt )
+    {
+      if( jt->second == handle )
+      {
+        m_nameIndex.erase(jt);
+        break;
+      }
+    }
+    m_nameIndexKeys.erase(it);
+  }
+
+  if( name )
+  {
+    std::string key = boost::to_upper_copy(*name);
+    m_nameIndex.insert(std::make_pair(key, handle));
+    m_nameIndexKeys[handle] = key;
+  }
+}
+
 //TODO probably should be in OS proper
 //helper method to do unit conversions;
 boost::optional<double> ReverseTranslator::unitToUnit(const double& val, const std::string& fstUnitString, const std::string& secUnitString)
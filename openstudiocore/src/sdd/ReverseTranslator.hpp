@@ -30,8 +30,12 @@
 #include "../model/Schedule.hpp"
 #include "../model/ConstructionBase.hpp"
 
+#include <QDomElement>
+#include <QObject>
+
+#include <map>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
 
 namespace openstudio {
@@ -129,6 +133,47 @@ namespace sdd {
 
     QDomElement findAirSysElement(const QString & airSysName,const QDomDocument & doc);
 
+    // Builds the ZnSys, AirSys and TrmlUnit lookup tables used by the find*Element methods.
+    // Called once per document so that these lookups do not search the whole document each time.
+    void indexElements(const QDomDocument& doc);
+    std::map<QString, QDomElement> m_znSysElementMap;
+    std::map<QString, QDomElement> m_airSysElementMap;
+    std::map<QString, QDomElement> m_trmlUnitElementMap;
+
+    // Returns the object of type T with this name (case insensitive), replaces Model::getModelObjectByName
+    // which searches every object in the model.  Names are resolved through m_nameIndex, which trackNames
+    // keeps current as objects are added to, removed from and renamed in the model being translated.
+    template <typename T>
+    boost::optional<T> modelObjectByName(const openstudio::model::Model& model, const std::string& name)
+    {
+      for (const WorkspaceObject& object : indexedObjectsByName(model, name)){
+        if (boost::optional<T> result = object.optionalCast<T>()){
+          return result;
+        }
+      }
+      return boost::none;
+    }
+
+    // objects in m_nameIndex under this name
+    std::vector<WorkspaceObject> indexedObjectsByName(const openstudio::model::Model& model, const std::string& name) const;
+
+    // indexes every object in model by name, then follows additions, removals and renames until untrackNames
+    void trackNames(openstudio::model::Model& model);
+
+    // disconnects everything trackNames connected to
+    void untrackNames();
+
+    // indexes object under its current name and follows its renames
+    void trackName(const WorkspaceObject& object);
+
+    // moves handle to the key for name in m_nameIndex, or drops it if there is no name
+    void indexName(const Handle& handle, const boost::optional<std::string>& name);
+
+    // object handles keyed by upper case name, and the key each handle is currently under
+    std::multimap<std::string, Handle> m_nameIndex;
+    std::map<Handle, std::string> m_nameIndexKeys;
+    std::vector<QMetaObject::Connection> m_nameIndexConnections;
+
     // Return the "TrmlUnit" element serving zoneName
     QDomElement findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc);
 
@@ -45,6 +45,7 @@
 #include "../model/ModelObject_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/units/QuantityConverter.hpp"
 
 #include <QApplication>
 #include <QBoxLayout>
@@ -483,6 +484,118 @@ QWidget * OSGridController::makeWidget(model::ModelObject t_mo, const QSharedPoi
   return widget;
 }
 
+namespace {
+
+  QString doubleText(double value)
+  {
+    return QString::number(value);
+  }
+
+  QString doubleText(const boost::optional<double> & value)
+  {
+    return value ? QString::number(*value) : QString();
+  }
+
+  QString quantityText(double value, const QString & modelUnits, const QString & displayUnits)
+  {
+    boost::optional<double> displayValue = convert(value, toString(modelUnits), toString(displayUnits));
+    return displayValue ? QString::number(*displayValue) : QString::number(value);
+  }
+
+  QString quantityText(const boost::optional<double> & value, const QString & modelUnits, const QString & displayUnits)
+  {
+    return value ? quantityText(*value, modelUnits, displayUnits) : QString();
+  }
+
+}
+
+QString OSGridController::conceptText(model::ModelObject t_mo, const QSharedPointer<BaseConcept> &t_baseConcept,
+                                      std::vector<model::ModelObject> & t_relatedObjects)
+{
+  // Mirrors the dispatch in makeWidget, but only reads the value that the widget would display
+  if(QSharedPointer<CheckBoxConcept> checkBoxConcept = t_baseConcept.dynamicCast<CheckBoxConcept>()){
+    return checkBoxConcept->get(t_mo) ? "Yes" : "No";
+  } else if(QSharedPointer<ComboBoxConcept> comboBoxConcept = t_baseConcept.dynamicCast<ComboBoxConcept>()) {
+    return toQString(comboBoxConcept->choiceConcept(t_mo)->get());
+  } else if(QSharedPointer<ValueEditConcept<double> > doubleEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<double> >()) {
+    return doubleText(doubleEditConcept->get(t_mo));
+  } else if(QSharedPointer<OptionalValueEditConcept<double> > optionalDoubleEditConcept = t_baseConcept.dynamicCast<OptionalValueEditConcept<double> >()) {
+    return doubleText(optionalDoubleEditConcept->get(t_mo));
+  } else if(QSharedPointer<ValueEditVoidReturnConcept<double> > doubleEditVoidReturnConcept = t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<double> >()) {
+    return doubleText(doubleEditVoidReturnConcept->get(t_mo));
+  } else if(QSharedPointer<OptionalValueEditVoidReturnConcept<double> > optionalDoubleEditVoidReturnConcept = t_baseConcept.dynamicCast<OptionalValueEditVoidReturnConcept<double> >()) {
+    return doubleText(optionalDoubleEditVoidReturnConcept->get(t_mo));
+  } else if(QSharedPointer<ValueEditConcept<int> > integerEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<int> >()) {
+    return QString::number(integerEditConcept->get(t_mo));
+  } else if(QSharedPointer<ValueEditConcept<std::string> > lineEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<std::string> >()) {
+    return toQString(lineEditConcept->get(t_mo));
+  } else if(QSharedPointer<LoadNameConcept> loadNameConcept = t_baseConcept.dynamicCast<LoadNameConcept>()) {
+    boost::optional<std::string> name = loadNameConcept->get(t_mo, true);
+    return name ? toQString(*name) : QString();
+  } else if(QSharedPointer<NameLineEditConcept> nameLineEditConcept = t_baseConcept.dynamicCast<NameLineEditConcept>()) {
+    boost::optional<std::string> name = nameLineEditConcept->get(t_mo, true);
+    return name ? toQString(*name) : QString();
+  } else if(QSharedPointer<QuantityEditConcept<double> > quantityEditConcept = t_baseConcept.dynamicCast<QuantityEditConcept<double> >()) {
+    return quantityText(quantityEditConcept->get(t_mo), quantityEditConcept->modelUnits(),
+                        m_isIP ? quantityEditConcept->ipUnits() : quantityEditConcept->siUnits());
+  } else if(QSharedPointer<OptionalQuantityEditConcept<double> > optionalQuantityEditConcept = t_baseConcept.dynamicCast<OptionalQuantityEditConcept<double> >()) {
+    return quantityText(optionalQuantityEditConcept->get(t_mo), optionalQuantityEditConcept->modelUnits(),
+                        m_isIP ? optionalQuantityEditConcept->ipUnits() : optionalQuantityEditConcept->siUnits());
+  } else if(QSharedPointer<QuantityEditVoidReturnConcept<double> > quantityEditVoidReturnConcept = t_baseConcept.dynamicCast<QuantityEditVoidReturnConcept<double> >()) {
+    return quantityText(quantityEditVoidReturnConcept->get(t_mo), quantityEditVoidReturnConcept->modelUnits(),
+                        m_isIP ? quantityEditVoidReturnConcept->ipUnits() : quantityEditVoidReturnConcept->siUnits());
+  } else if(QSharedPointer<OptionalQuantityEditVoidReturnConcept<double> > optionalQuantityEditVoidReturnConcept = t_baseConcept.dynamicCast<OptionalQuantityEditVoidReturnConcept<double> >()) {
+    return quantityText(optionalQuantityEditVoidReturnConcept->get(t_mo), optionalQuantityEditVoidReturnConcept->modelUnits(),
+                        m_isIP ? optionalQuantityEditVoidReturnConcept->ipUnits() : optionalQuantityEditVoidReturnConcept->siUnits());
+  } else if(QSharedPointer<ValueEditConcept<unsigned> > unsignedEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<unsigned> >()) {
+    return QString::number(unsignedEditConcept->get(t_mo));
+  } else if(QSharedPointer<DropZoneConcept> dropZoneConcept = t_baseConcept.dynamicCast<DropZoneConcept>()) {
+    boost::optional<model::ModelObject> modelObject = dropZoneConcept->get(t_mo);
+    if (!modelObject) return QString();
+    t_relatedObjects.push_back(*modelObject);
+    return toQString(modelObject->name().get());
+  } else if(QSharedPointer<DataSourceAdapter> dataSource = t_baseConcept.dynamicCast<DataSourceAdapter>()) {
+    QStringList lines;
+    for (auto &item : dataSource->source().items(t_mo))
+    {
+      if (item) {
+        model::ModelObject itemObject = item->cast<model::ModelObject>();
+        t_relatedObjects.push_back(itemObject);
+        lines << conceptText(itemObject, dataSource->innerConcept(), t_relatedObjects);
+      } else {
+        lines << QString();
+      }
+    }
+    return lines.join("\n");
+  }
+
+  // RenderingColorConcept and anything else without a textual value
+  return QString();
+}
+
+QString OSGridController::cellText(int row, int column)
+{
+  OS_ASSERT(row >= 0);
+  OS_ASSERT(column >= 0);
+  OS_ASSERT(static_cast<int>(m_baseConcepts.size()) > column);
+
+  if(m_hasHorizontalHeader && row == 0){
+    return m_baseConcepts[column]->headingLabel();
+  }
+
+  std::vector<model::ModelObject> relatedObjects;
+  QString text = conceptText(modelObject(row), m_baseConcepts[column], relatedObjects);
+
+  // the row's own object is watched by connectToModelObjects, the text may also come from other objects
+  for (const auto & relatedObject : relatedObjects){
+    m_relatedRows[relatedObject.handle()].insert(row);
+    connect(relatedObject.getImpl<model::detail::ModelObject_Impl>().get(), SIGNAL(onChange()),
+            this, SLOT(onRelatedModelObjectChanged()), Qt::UniqueConnection);
+  }
+
+  return text;
+}
+
 OSGridView * OSGridController::gridView(){
   auto gridView = qobject_cast<OSGridView *>(this->parent());
   OS_ASSERT(gridView);
@@ -634,8 +747,8 @@ QWidget * OSGridController::widgetAt(int row, int column)
 
   auto wrapper = new QPushButton();
   if (modelObjectRow >= 0 && column == 0){
-    auto size = m_cellBtnGrp->buttons().size();
-    m_cellBtnGrp->addButton(wrapper, size);
+    // rows may be materialized out of order by a virtualized OSGridView, so key the button on its row
+    m_cellBtnGrp->addButton(wrapper, modelObjectRow);
   }
 
   wrapper->setObjectName("TableCell");
@@ -959,6 +1072,44 @@ void OSGridController::disconnectFromModel()
   disconnect(m_model.getImpl<openstudio::model::detail::Model_Impl>().get());
 }
 
+void OSGridController::connectToModelObjects()
+{
+  // rows may have moved, cellText records them again as they are painted
+  m_relatedRows.clear();
+
+  for (const auto & modelObject : m_modelObjects){
+    connect(modelObject.getImpl<model::detail::ModelObject_Impl>().get(), SIGNAL(onChange()),
+            this, SLOT(onModelObjectChanged()), Qt::UniqueConnection);
+  }
+}
+
+void OSGridController::onModelObjectChanged()
+{
+  const auto * impl = qobject_cast<const model::detail::ModelObject_Impl *>(sender());
+  if (!impl) return;
+
+  Handle handle = impl->handle();
+  for (unsigned i = 0; i < m_modelObjects.size(); i++){
+    if (m_modelObjects[i].handle() == handle){
+      gridView()->invalidateRow(rowIndexFromModelIndex(i));
+      return;
+    }
+  }
+}
+
+void OSGridController::onRelatedModelObjectChanged()
+{
+  const auto * impl = qobject_cast<const model::detail::ModelObject_Impl *>(sender());
+  if (!impl) return;
+
+  auto it = m_relatedRows.find(impl->handle());
+  if (it == m_relatedRows.end()) return;
+
+  for (int row : it->second){
+    gridView()->invalidateRow(row);
+  }
+}
+
 void OSGridController::onSelectionCleared()
 {
   //gridView()->requestRefreshAll(); TODO still needed???
@@ -1000,8 +1151,13 @@ void OSGridController::onAddWorkspaceObject(const WorkspaceObject& object, const
 void OSGridController::onObjectRemoved(boost::optional<model::ParentObject> parent)
 {
   if (parent) {
-    // We have a parent we can search for in our current list of modelObjects and just delete that 1 row
-    this->requestRefreshGrid(); // TODO replace this with a by-row refresh only
+    // We have a parent we can search for in our current list of modelObjects and just redraw that 1 row
+    auto it = std::find(m_modelObjects.begin(), m_modelObjects.end(), parent->cast<model::ModelObject>());
+    if (it != m_modelObjects.end()) {
+      gridView()->requestRefreshRow(rowIndexFromModelIndex(std::distance(m_modelObjects.begin(), it)));
+    } else {
+      this->requestRefreshGrid();
+    }
   }
   else {
     // We don't know which row needs to be redrawn, so we have to do the whole grid
@@ -32,6 +32,8 @@
 
 #include <string>
 #include <functional>
+#include <map>
+#include <set>
 #include <vector>
 #include <QObject>
 #include <QSharedPointer>
@@ -454,6 +456,10 @@ public:
 
   QWidget * widgetAt(int row, int column);
 
+  // The text a cell displays, read from its concept without constructing any widgets.
+  // OSGridView uses this to paint rows that do not currently have editors.
+  QString cellText(int row, int column);
+
   // Call this function on a model update
   virtual void refreshModelObjects() = 0;
 
@@ -461,6 +467,9 @@ public:
 
   void disconnectFromModel();
 
+  // Listen for changes to each object in m_modelObjects, so that an edit only invalidates its own row
+  void connectToModelObjects();
+
 protected:
 
   // This function determines the category for
@@ -521,6 +530,13 @@ private:
 
   QWidget * makeWidget(model::ModelObject t_mo, const QSharedPointer<BaseConcept> &t_baseConcept);
 
+  // t_relatedObjects gets the objects other than t_mo that the text was read from
+  QString conceptText(model::ModelObject t_mo, const QSharedPointer<BaseConcept> &t_baseConcept,
+                      std::vector<model::ModelObject> & t_relatedObjects);
+
+  // rows whose cell text was read from each related object, see cellText
+  std::map<Handle, std::set<int> > m_relatedRows;
+
   void loadQSettings();
 
   void saveQSettings() const;
@@ -590,6 +606,10 @@ private slots:
 
   void onObjectRemoved(boost::optional<model::ParentObject> parent);
 
+  void onModelObjectChanged();
+
+  void onRelatedModelObjectChanged();
+
 };
 
 class HorizontalHeaderWidget : public QWidget
@@ -40,6 +40,8 @@
 #include <QButtonGroup>
 #include <QHideEvent>
 #include <QLabel>
+#include <QPainter>
+#include <QPaintEvent>
 #include <QPushButton>
 #include <QScrollArea>
 #include <QShowEvent>
@@ -57,6 +59,111 @@
 
 namespace openstudio {
 
+OSGridChunk::OSGridChunk(OSGridView * gridView, int index, QWidget * parent)
+  : QWidget(parent),
+    m_gridView(gridView),
+    m_index(index),
+    m_materialized(true)
+{
+}
+
+void OSGridChunk::setMaterialized()
+{
+  m_materialized = true;
+  m_cellText.clear();
+  setMinimumSize(0, 0);
+}
+
+void OSGridChunk::setDematerialized(int rowCount, int height, int width)
+{
+  m_materialized = false;
+  m_cellText.clear();
+  m_cellText.resize(rowCount);
+  setMinimumSize(width, height);
+  update();
+}
+
+void OSGridChunk::invalidateRow(int row)
+{
+  if (row >= 0 && row < static_cast<int>(m_cellText.size())) {
+    m_cellText[row].clear();
+    if (!m_materialized) {
+      update();
+    }
+  }
+}
+
+const std::vector<QString> & OSGridChunk::rowText(int row)
+{
+  OS_ASSERT(!m_materialized);
+  OS_ASSERT(row >= 0 && row < static_cast<int>(m_cellText.size()));
+
+  std::vector<QString> & text = m_cellText[row];
+  if (text.empty()) {
+    OSGridController * gridController = m_gridView->m_gridController;
+    OS_ASSERT(gridController);
+
+    int gridRow = m_index * OSGridView::ROWS_PER_LAYOUT + row;
+    for (int j = 0; j < gridController->columnCount(); j++) {
+      text.push_back(gridController->cellText(gridRow, j));
+    }
+  }
+  return text;
+}
+
+void OSGridChunk::paintEvent(QPaintEvent * event)
+{
+  QWidget::paintEvent(event);
+
+  if (m_materialized || m_cellText.empty()) return;
+
+  OSGridController * gridController = m_gridView->m_gridController;
+  OS_ASSERT(gridController);
+
+  const int columnCount = gridController->columnCount();
+  const int rowCount = static_cast<int>(m_cellText.size());
+  const double rowHeight = static_cast<double>(height()) / rowCount;
+
+  int firstRow = std::max(0, static_cast<int>(event->rect().top() / rowHeight));
+  int lastRow = std::min(rowCount - 1, static_cast<int>(event->rect().bottom() / rowHeight));
+
+  QPainter painter(this);
+  painter.setPen(Qt::black);
+
+  for (int i = firstRow; i <= lastRow; i++)
+  {
+    int row = m_index * OSGridView::ROWS_PER_LAYOUT + i;
+
+    // pulls the text for this row the first time it is painted
+    const std::vector<QString> & text = rowText(i);
+
+    int top = static_cast<int>(i * rowHeight);
+    int bottom = static_cast<int>((i + 1) * rowHeight);
+    int left = 0;
+    for (int j = 0; j < columnCount; j++) {
+      int width = OSGridView::DEFAULT_COLUMN_WIDTH;
+      if (j < static_cast<int>(m_gridView->m_columnWidths.size()) && m_gridView->m_columnWidths[j] > 0) {
+        width = m_gridView->m_columnWidths[j];
+      }
+
+      // same colors and borders as OSGridController::cellStyle
+      QRect cell(left, top, width, bottom - top);
+      painter.fillRect(cell, QColor(row % 2 ? "#ededed" : "#cecece"));
+      painter.drawLine(cell.topRight(), cell.bottomRight());
+      painter.drawLine(cell.bottomLeft(), cell.bottomRight());
+      if (j == 0) {
+        painter.drawLine(cell.topLeft(), cell.bottomLeft());
+      }
+      painter.drawText(cell.adjusted(5, 0, -5, 0), Qt::AlignLeft | Qt::AlignVCenter, text[j]);
+
+      left += width;
+    }
+  }
+
+  // this chunk is on screen, give it real editors
+  m_gridView->requestMaterializeChunk(m_index);
+}
+
 QGridLayout *OSGridView::makeGridLayout()
 {
   auto gridLayout = new QGridLayout();
@@ -186,12 +293,25 @@ void OSGridView::setGridController(OSGridController * gridController)
 
 void OSGridView::refreshCell(int row, int column)
 {
-  // removeWidget may not be safe this contexts
-  OS_ASSERT(false); // TODO
+  auto layoutnum = row / ROWS_PER_LAYOUT;
+  auto relativerow = row % ROWS_PER_LAYOUT;
+
+  // a row without editors is repainted from fresh text, see invalidateRow
+  if (layoutnum >= static_cast<int>(m_chunks.size()) || !m_chunks[layoutnum]->isMaterialized()) return;
+
+  QGridLayout * layout = m_gridLayouts.at(layoutnum);
+  QLayoutItem * item = layout->itemAtPosition(relativerow, column);
+  if (item) {
+    layout->removeItem(item);
+    delete item->widget();
+    delete item;
+  }
 
-  removeWidget(row,column);
+  addWidget(row, column);
 
-  addWidget(row,column);
+  if (relativerow == 0 && column < static_cast<int>(m_columnWidths.size())) {
+    itemAtPosition(row, column)->widget()->setMinimumWidth(m_columnWidths[column]);
+  }
 }
 
 void OSGridView::requestAddRow(int row)
@@ -250,6 +370,176 @@ void OSGridView::refreshRow(int row)
   {
     refreshCell(row, j);
   }
+
+  invalidateRow(row);
+
+  if (row == m_gridController->m_oldIndex) {
+    m_gridController->selectRow(row, true);
+  }
+}
+
+void OSGridView::invalidateRow(int row)
+{
+  auto layoutnum = row / ROWS_PER_LAYOUT;
+  if (layoutnum < static_cast<int>(m_chunks.size())) {
+    m_chunks[layoutnum]->invalidateRow(row % ROWS_PER_LAYOUT);
+  }
+}
+
+void OSGridView::setVirtualized(bool virtualized)
+{
+  if (m_virtualized != virtualized) {
+    m_virtualized = virtualized;
+    requestRefreshAll();
+  }
+}
+
+bool OSGridView::isVirtualized() const
+{
+  return m_virtualized;
+}
+
+int OSGridView::materializedRowCount() const
+{
+  int result = 0;
+  for (unsigned i = 0; i < m_chunks.size(); i++) {
+    if (m_chunks[i]->isMaterialized()) {
+      result += chunkRowCount(i);
+    }
+  }
+  return result;
+}
+
+int OSGridView::chunkCount() const
+{
+  return m_chunks.size();
+}
+
+std::vector<QString> OSGridView::rowText(int row)
+{
+  auto layoutnum = row / ROWS_PER_LAYOUT;
+  if (layoutnum >= static_cast<int>(m_chunks.size()) || m_chunks[layoutnum]->isMaterialized()) {
+    return std::vector<QString>();
+  }
+  return m_chunks[layoutnum]->rowText(row % ROWS_PER_LAYOUT);
+}
+
+void OSGridView::addChunks(unsigned count)
+{
+  while (m_chunks.size() < count)
+  {
+    auto grid = makeGridLayout();
+    OS_ASSERT(grid);
+
+    auto chunk = new OSGridChunk(this, m_chunks.size());
+    chunk->setLayout(grid);
+
+    m_gridLayouts.push_back(grid);
+    m_chunks.push_back(chunk);
+    OS_ASSERT(m_contentLayout);
+    m_contentLayout->addWidget(chunk);
+  }
+}
+
+void OSGridView::removeChunks(unsigned count)
+{
+  while (m_chunks.size() > count)
+  {
+    // the chunk owns its grid layout and any editors left in it, deleting it also takes it out of m_contentLayout
+    delete m_chunks.back();
+    m_chunks.pop_back();
+    m_gridLayouts.pop_back();
+  }
+}
+
+int OSGridView::chunkRowCount(int index) const
+{
+  if (!m_gridController) return 0;
+
+  int rowCount = m_gridController->rowCount() - index * ROWS_PER_LAYOUT;
+  if (rowCount > ROWS_PER_LAYOUT) rowCount = ROWS_PER_LAYOUT;
+  return rowCount > 0 ? rowCount : 0;
+}
+
+void OSGridView::requestMaterializeChunk(int index)
+{
+  if (m_chunksToMaterialize.empty()) {
+    QTimer::singleShot(0, this, SLOT(materializeRequestedChunks()));
+  }
+  m_chunksToMaterialize.insert(index);
+}
+
+void OSGridView::materializeRequestedChunks()
+{
+  std::set<int> chunks;
+  chunks.swap(m_chunksToMaterialize);
+
+  bool changed = false;
+  for (int index : chunks) {
+    if (index < static_cast<int>(m_chunks.size()) && !m_chunks[index]->isMaterialized() && !m_chunks[index]->visibleRegion().isEmpty()) {
+      materializeChunk(index);
+      changed = true;
+    }
+  }
+
+  if (!changed) return;
+
+  // release the editors of chunks that have scrolled out of view, the header chunk always keeps its editors
+  for (unsigned i = 1; i < m_chunks.size(); i++) {
+    if (m_chunks[i]->isMaterialized() && chunks.find(i) == chunks.end() && m_chunks[i]->visibleRegion().isEmpty()) {
+      dematerializeChunk(i);
+    }
+  }
+
+  normalizeColumnWidths();
+}
+
+void OSGridView::materializeChunk(int index)
+{
+  OS_ASSERT(m_gridController);
+
+  int firstRow = index * ROWS_PER_LAYOUT;
+  int lastRow = firstRow + chunkRowCount(index);
+  for (int i = firstRow; i < lastRow; i++)
+  {
+    for (int j = 0; j < m_gridController->columnCount(); j++)
+    {
+      addWidget(i, j);
+    }
+  }
+
+  m_chunks[index]->setMaterialized();
+
+  int selectedRow = m_gridController->m_oldIndex;
+  if (selectedRow >= firstRow && selectedRow < lastRow) {
+    m_gridController->selectRow(selectedRow, true);
+  }
+}
+
+void OSGridView::dematerializeChunk(int index)
+{
+  OSGridChunk * chunk = m_chunks[index];
+  int rowCount = chunkRowCount(index);
+
+  // keep the height the editors had so the scroll position does not jump
+  int height = (chunk->isMaterialized() && m_gridLayouts[index]->count() > 0) ? chunk->height() : 0;
+  if (height <= 0) {
+    height = rowCount * DEFAULT_ROW_HEIGHT;
+  }
+
+  int width = 0;
+  for (int j = 0; j < m_gridController->columnCount(); j++) {
+    width += (j < static_cast<int>(m_columnWidths.size()) && m_columnWidths[j] > 0) ? m_columnWidths[j] : DEFAULT_COLUMN_WIDTH;
+  }
+
+  QLayoutItem * child;
+  while ((child = m_gridLayouts[index]->takeAt(0)) != nullptr)
+  {
+    delete child->widget();
+    delete child;
+  }
+
+  chunk->setDematerialized(rowCount, rowCount > 0 ? height : 0, rowCount > 0 ? width : 0);
 }
 
 QLayoutItem * OSGridView::itemAtPosition(int row, int column)
@@ -358,6 +648,8 @@ void OSGridView::requestRefreshRow(int t_row)
 
   m_timer.start();
 
+  m_rowsToRefresh.insert(t_row);
+
   m_queueRequests.emplace_back(RefreshRow);
 }
 
@@ -386,24 +678,23 @@ void OSGridView::doRefresh()
 
   m_queueRequests.clear();
 
-  //if (has_refresh_all) {
-  //  refreshAll();
-  //}
-  //else if (has_refresh_grid) {
-  //  refreshGrid(); // This now causes a crash
-  //}
-  //else if (has_add_row) {
-  //  addRow(m_rowToAdd);
-  //}
-  //else if (has_remove_row) {
-  //  removeRow(m_rowToRemove);
-  //}
-  //else {
-  //  // Should never get here
-  //  OS_ASSERT(false);
-  //}
-
-  refreshAll(); // TODO remove this and uncomment the block above for finer granularity refreshes
+  // adding or removing a row shifts every row after it, and with them the chunk each row lives in,
+  // the cell button ids and the cached text, which are all keyed on the model row. addRow and
+  // removeRow only touch the widgets at one position, so those requests still rebuild the grid.
+  // in virtualized mode that only builds editors for the header chunk and the chunks on screen.
+  if (has_refresh_all || has_refresh_grid || has_add_row || has_remove_row) {
+    refreshAll();
+  }
+  else {
+    // only rows whose model objects changed
+    std::set<int> rows;
+    rows.swap(m_rowsToRefresh);
+    for (int row : rows) {
+      if (row < m_gridController->rowCount()) {
+        refreshRow(row);
+      }
+    }
+  }
   setEnabled(true);
 }
 
@@ -411,22 +702,35 @@ void OSGridView::refreshAll()
 {
   std::cout << " REFRESHALL CALLED " << std::endl;
   m_queueRequests.clear();
+  m_rowsToRefresh.clear();
+  m_chunksToMaterialize.clear();
   deleteAll();
 
   if (m_gridController)
   {
     m_gridController->refreshModelObjects();
+    m_gridController->connectToModelObjects();
+
+    unsigned chunkCount = (m_gridController->rowCount() + ROWS_PER_LAYOUT - 1) / ROWS_PER_LAYOUT;
+    addChunks(chunkCount);
+    removeChunks(chunkCount);
 
-    for (int i = 0; i < m_gridController->rowCount(); i++)
+    // in virtualized mode only the header chunk gets editors up front,
+    // the rest get them when they are first painted
+    for (unsigned i = 0; i < m_chunks.size(); i++)
     {
-      for (int j = 0; j < m_gridController->columnCount(); j++)
-      {
-        addWidget(i, j);
+      if (!m_virtualized || i == 0) {
+        materializeChunk(i);
       }
     }
 
     normalizeColumnWidths();
 
+    for (unsigned i = 1; m_virtualized && i < m_chunks.size(); i++)
+    {
+      dematerializeChunk(i);
+    }
+
     QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
 
   }
@@ -455,25 +759,33 @@ void OSGridView::normalizeColumnWidths()
 {
   std::vector<int> colmins(m_gridController->columnCount(), 0);
 
-  for( int i = 0; i < m_gridController->rowCount(); i++ )
+  // walk the layout items directly, QGridLayout::itemAtPosition is a linear search
+  int row, column, rowSpan, columnSpan;
+  for (auto layout : m_gridLayouts)
   {
-    for( int j = 0; j < m_gridController->columnCount(); j++ )
+    for (int index = 0; index < layout->count(); index++)
     {
-      const auto *w = itemAtPosition(i, j)->widget();
+      const auto *w = layout->itemAt(index)->widget();
       OS_ASSERT(w);
-      colmins[j] = std::max(colmins[j], w->minimumWidth());
+      layout->getItemPosition(index, &row, &column, &rowSpan, &columnSpan);
+      if (column < static_cast<int>(colmins.size())) {
+        colmins[column] = std::max(colmins[column], w->minimumWidth());
+      }
     }
   }
 
-  for(int i = 0; i < m_gridController->rowCount(); i += ROWS_PER_LAYOUT)
+  for (auto layout : m_gridLayouts)
   {
-    for( int j = 0; j < m_gridController->columnCount(); j++ )
+    for (int index = 0; index < layout->count(); index++)
     {
-      auto *w = itemAtPosition(i, j)->widget();
-      OS_ASSERT(w);
-      w->setMinimumWidth(colmins[j]);
+      layout->getItemPosition(index, &row, &column, &rowSpan, &columnSpan);
+      if (row == 0 && column < static_cast<int>(colmins.size())) {
+        layout->itemAt(index)->widget()->setMinimumWidth(colmins[column]);
+      }
     }
   }
+
+  m_columnWidths = colmins;
 }
 
 void OSGridView::doRowSelect()
@@ -498,15 +810,7 @@ void OSGridView::addWidget(QWidget *w, int row, int column)
   unsigned layoutindex = row / ROWS_PER_LAYOUT;
   auto relativerow = row % ROWS_PER_LAYOUT;
 
-  if (layoutindex >= m_gridLayouts.size())
-  {
-    auto grid = makeGridLayout();
-    OS_ASSERT(grid);
-
-    m_gridLayouts.push_back(grid);
-    OS_ASSERT(m_contentLayout);
-    m_contentLayout->addLayout(grid);
-  }
+  addChunks(layoutindex + 1);
 
   m_gridLayouts[layoutindex]->addWidget(w, relativerow, column);
 }
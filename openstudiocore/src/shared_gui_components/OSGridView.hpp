@@ -27,10 +27,14 @@
 
 #include "../model/ModelObject.hpp"
 
+#include <set>
+#include <vector>
+
 class QGridLayout;
 class QHideEvent;
 class QVBoxLayout;
 class QLabel;
+class QPaintEvent;
 class QShowEvent;
 class QString;
 class QLayoutItem;
@@ -42,6 +46,49 @@ class OSCollapsibleView;
 class OSDropZone;
 class OSGridController;
 class OSItem;
+class OSGridView;
+
+// One block of OSGridView::ROWS_PER_LAYOUT rows, laid out by its own QGridLayout.
+// While the block has no editors it paints its rows from cell text that is pulled
+// from the OSGridController the first time each row is painted, and then asks
+// the grid view to create the editors.
+class OSGridChunk : public QWidget
+{
+public:
+
+  OSGridChunk(OSGridView * gridView, int index, QWidget * parent = nullptr);
+
+  virtual ~OSGridChunk() {}
+
+  bool isMaterialized() const { return m_materialized; }
+
+  // rows now have editors, the placeholder size and cached text are dropped
+  void setMaterialized();
+
+  // rows no longer have editors, reserve height for them and paint them from cached text
+  void setDematerialized(int rowCount, int height, int width);
+
+  // drop the cached text for a row, row is relative to the start of this chunk
+  void invalidateRow(int row);
+
+  // the text a row is painted with, pulled from the OSGridController if it is not cached,
+  // row is relative to the start of this chunk and the chunk must not have editors
+  const std::vector<QString> & rowText(int row);
+
+protected:
+
+  virtual void paintEvent(QPaintEvent * event);
+
+private:
+
+  OSGridView * m_gridView;
+
+  int m_index;
+
+  bool m_materialized;
+
+  std::vector<std::vector<QString> > m_cellText;
+};
 
 class OSGridView : public QWidget
 {
@@ -68,6 +115,24 @@ public:
 
   void requestAddRow(int row);
 
+  // In virtualized mode only the header block and the blocks scrolled into view have editors,
+  // the remaining rows are painted from cell text. Virtualized mode is off by default.
+  void setVirtualized(bool virtualized);
+
+  bool isVirtualized() const;
+
+  // number of rows, including the header, that currently have editors
+  int materializedRowCount() const;
+
+  // number of blocks of ROWS_PER_LAYOUT rows, with or without editors
+  int chunkCount() const;
+
+  // the text a row without editors is painted with, empty if the row has editors
+  std::vector<QString> rowText(int row);
+
+  // drop any cached text for a row after its model object changes
+  void invalidateRow(int row);
+
 protected:
 
   virtual void hideEvent(QHideEvent * event);
@@ -122,8 +187,12 @@ private slots:
 
   void selectRowDeterminedByModelSubTabView();
 
+  void materializeRequestedChunks();
+
 private:
 
+  friend class OSGridChunk;
+
   enum QueueType
   {
     AddRow,
@@ -147,12 +216,41 @@ private:
 
   void removeRow(int row);
 
+  // make sure there are at least count chunks, each with its own grid layout
+  void addChunks(unsigned count);
+
+  // destroy the chunks beyond the first count, along with their grid layouts and editors
+  void removeChunks(unsigned count);
+
+  int chunkRowCount(int index) const;
+
+  void requestMaterializeChunk(int index);
+
+  void materializeChunk(int index);
+
+  void dematerializeChunk(int index);
+
   static const int ROWS_PER_LAYOUT = 100;
 
+  // placeholder row height and column width until real editors have been measured
+  static const int DEFAULT_ROW_HEIGHT = 35;
+
+  static const int DEFAULT_COLUMN_WIDTH = 100;
+
   QVBoxLayout * m_contentLayout;
 
   std::vector<QGridLayout *> m_gridLayouts;
 
+  std::vector<OSGridChunk *> m_chunks;
+
+  std::vector<int> m_columnWidths;
+
+  std::set<int> m_chunksToMaterialize;
+
+  std::set<int> m_rowsToRefresh;
+
+  bool m_virtualized = false;
+
   OSCollapsibleView * m_CollapsibleView;
 
   OSGridController * m_gridController;
@@ -37,7 +37,9 @@
 #include <QSqlError>
 #include <QSqlQuery>
 #include <QSqlResult>
+#include <QStringList>
 
+#include <boost/filesystem/operations.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include <algorithm>
@@ -46,10 +48,30 @@
 
 namespace openstudio{
 
+  namespace {
+
+    // modification time and size of a component or measure xml file, empty if the file cannot be read
+    boost::optional<std::pair<std::time_t, std::uintmax_t> > xmlStamp(const openstudio::path& xmlPath)
+    {
+      boost::system::error_code ec;
+      std::time_t lastModified = boost::filesystem::last_write_time(xmlPath, ec);
+      if (ec) {
+        return boost::none;
+      }
+      std::uintmax_t size = boost::filesystem::file_size(xmlPath, ec);
+      if (ec) {
+        return boost::none;
+      }
+      return std::make_pair(lastModified, size);
+    }
+
+  }
+
   LocalBCL::LocalBCL(const path& libraryPath):
     m_libraryPath(QDir().cleanPath(toQString(libraryPath))),
     m_dbName(QString("/components.sql")),
-    dbVersion("1.3")
+    dbVersion("1.3"),
+    m_hasSearchIndex(false)
   {
     //Make sure a QApplication exists
     openstudio::Application::instance().application(false);
@@ -79,6 +101,9 @@ namespace openstudio{
     //Check for out-of-date database
     updateLocalDb();
 
+    //Build the full text search index if this library does not have one yet
+    m_hasSearchIndex = createSearchIndex();
+
     //Retrieve oauthConsumerKeys from database
     QSqlQuery query(database);
     query.exec("SELECT data FROM Settings WHERE name='prodAuthKey'");
@@ -284,6 +309,115 @@ namespace openstudio{
     return false;
   }
 
+  bool LocalBCL::createSearchIndex()
+  {
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    QSqlQuery query(database);
+
+    if (query.exec("SELECT name FROM sqlite_master WHERE type='table' AND name='ComponentsSearch'") && query.next())
+    {
+      return true;
+    }
+
+    // the search tables are keyed on the rowid of the Components and Measures rows,
+    // the triggers keep them in sync with every insert and delete made by any writer
+    if (!database.transaction())
+    {
+      return false;
+    }
+    bool success = query.exec("CREATE VIRTUAL TABLE ComponentsSearch USING fts4(name, description)");
+    success = success && query.exec("CREATE VIRTUAL TABLE MeasuresSearch USING fts4(name, description, modeler_description)");
+    success = success && query.exec("CREATE TRIGGER ComponentsSearchInsert AFTER INSERT ON Components BEGIN "
+      "INSERT INTO ComponentsSearch (docid, name, description) VALUES (new.rowid, new.name, new.description); END");
+    success = success && query.exec("CREATE TRIGGER ComponentsSearchDelete AFTER DELETE ON Components BEGIN "
+      "DELETE FROM ComponentsSearch WHERE docid = old.rowid; END");
+    success = success && query.exec("CREATE TRIGGER MeasuresSearchInsert AFTER INSERT ON Measures BEGIN "
+      "INSERT INTO MeasuresSearch (docid, name, description, modeler_description) "
+      "VALUES (new.rowid, new.name, new.description, new.modeler_description); END");
+    success = success && query.exec("CREATE TRIGGER MeasuresSearchDelete AFTER DELETE ON Measures BEGIN "
+      "DELETE FROM MeasuresSearch WHERE docid = old.rowid; END");
+    success = success && query.exec("INSERT INTO ComponentsSearch (docid, name, description) "
+      "SELECT rowid, name, description FROM Components");
+    success = success && query.exec("INSERT INTO MeasuresSearch (docid, name, description, modeler_description) "
+      "SELECT rowid, name, description, modeler_description FROM Measures");
+
+    if (success)
+    {
+      return database.commit();
+    }
+
+    LOG(Warn, "Full text search is not available for the local BCL, falling back to LIKE queries: "
+      << toString(query.lastError().text()));
+    database.rollback();
+    return false;
+  }
+
+  QString LocalBCL::searchQuery(const std::string& searchTerm)
+  {
+    QStringList words;
+    for (QString word : toQString(searchTerm).simplified().split(' ', QString::SkipEmptyParts))
+    {
+      word.remove('"');
+      if (!word.isEmpty())
+      {
+        words << "\"" + word + "\"*";
+      }
+    }
+    return words.join(" ");
+  }
+
+  boost::optional<BCLComponent> LocalBCL::loadComponent(const QString& uid, const QString& versionId) const
+  {
+    openstudio::path dir = toPath(m_libraryPath) / toPath(uid) / toPath(versionId);
+    UidVersionId key(toString(uid), toString(versionId));
+
+    boost::optional<XmlStamp> stamp = xmlStamp(dir / toPath("component.xml"));
+    if (!stamp)
+    {
+      m_componentCache.erase(key);
+      // DLM: this does not look like it is handling error of missing file correctly
+      return BCLComponent(toString(dir));
+    }
+
+    auto it = m_componentCache.find(key);
+    if (it != m_componentCache.end() && it->second.first == *stamp)
+    {
+      return it->second.second;
+    }
+
+    BCLComponent component(toString(dir));
+    m_componentCache.erase(key);
+    m_componentCache.insert(std::make_pair(key, std::make_pair(*stamp, component)));
+    return component;
+  }
+
+  boost::optional<BCLMeasure> LocalBCL::loadMeasure(const QString& uid, const QString& versionId) const
+  {
+    openstudio::path dir = toPath(m_libraryPath) / toPath(uid) / toPath(versionId);
+    UidVersionId key(toString(uid), toString(versionId));
+
+    boost::optional<XmlStamp> stamp = xmlStamp(dir / toPath("measure.xml"));
+    if (!stamp)
+    {
+      m_measureCache.erase(key);
+      return boost::none;
+    }
+
+    auto it = m_measureCache.find(key);
+    if (it != m_measureCache.end() && it->second.first == *stamp)
+    {
+      return it->second.second;
+    }
+
+    boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+    m_measureCache.erase(key);
+    if (measure)
+    {
+      m_measureCache.insert(std::make_pair(key, std::make_pair(*stamp, *measure)));
+    }
+    return measure;
+  }
+
   /// Inherited members
 
   boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, const std::string& versionId) const
@@ -295,14 +429,14 @@ namespace openstudio{
       query.exec(QString("SELECT version_id FROM Components WHERE uid='%1'").arg(escape(uid)));
       if (query.next())
       {
-        return boost::optional<BCLComponent>(toString(m_libraryPath) + "/" + uid + "/" + toString(query.value(0).toString()));
+        return loadComponent(toQString(uid), query.value(0).toString());
       }
       return boost::none;
     }
     query.exec(QString("SELECT version_id FROM Components WHERE uid='%1' AND version_id='%2'").arg(escape(uid), escape(versionId)));
     if (query.next())
     {
-      return boost::optional<BCLComponent>(toString(m_libraryPath) + "/" + uid + "/" + versionId);
+      return loadComponent(toQString(uid), toQString(versionId));
     }
     return boost::none;
   }
@@ -316,20 +450,14 @@ namespace openstudio{
       query.exec(QString("SELECT version_id FROM Measures WHERE uid='%1'").arg(escape(uid)));
       if (query.next())
       {
-        try{
-          return boost::optional<BCLMeasure>(toPath(m_libraryPath) / toPath(uid) / toPath(toString(query.value(0).toString())));
-        }catch(const std::exception&){
-        }
+        return loadMeasure(toQString(uid), query.value(0).toString());
       }
       return boost::none;
     }
     query.exec(QString("SELECT version_id FROM Measures WHERE uid='%1' AND version_id='%2'").arg(escape(uid), escape(versionId)));
     if (query.next())
     {
-      try{
-        return boost::optional<BCLMeasure>(toPath(m_libraryPath) / toPath(uid) / toPath(versionId));
-      }catch(const std::exception&){
-      }
+      return loadMeasure(toQString(uid), toQString(versionId));
     }
     return boost::none;
   }
@@ -342,8 +470,7 @@ namespace openstudio{
     query.exec("SELECT uid, version_id FROM Components");
     while (query.next())
     {
-      // DLM: this does not look like it is handling error of missing file correctly
-      boost::optional<BCLComponent> current(toString(toPath(m_libraryPath) / toPath(query.value(0).toString()) / toPath(query.value(1).toString())));
+      boost::optional<BCLComponent> current = loadComponent(query.value(0).toString(), query.value(1).toString());
       if (current)
       {
         allComponents.push_back(*current);
@@ -360,7 +487,7 @@ namespace openstudio{
     query.exec("SELECT uid, version_id FROM Measures");
     while (query.next())
     {
-      boost::optional<BCLMeasure> current = BCLMeasure::load(toPath(m_libraryPath) / toPath(query.value(0).toString()) / toPath(query.value(1).toString()));
+      boost::optional<BCLMeasure> current = loadMeasure(query.value(0).toString(), query.value(1).toString());
       if (current)
       {
         allMeasures.push_back(*current);
@@ -385,14 +512,32 @@ namespace openstudio{
   std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm,
     const std::string& componentType) const 
   {
+    QString terms = searchQuery(searchTerm);
+    if (terms.isEmpty())
+    {
+      return components();
+    }
+
     std::vector<BCLComponent> results;
     QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
     QSqlQuery query(database);
-    query.exec(toQString("SELECT uid, version_id FROM Components where name LIKE \"%"+searchTerm+"%\" OR description LIKE \"%"+searchTerm+"%\""));
+    if (m_hasSearchIndex)
+    {
+      query.prepare("SELECT uid, version_id FROM Components WHERE rowid IN "
+        "(SELECT docid FROM ComponentsSearch WHERE ComponentsSearch MATCH :terms)");
+      query.bindValue(":terms", terms);
+    }
+    else
+    {
+      QString pattern = "%" + toQString(searchTerm) + "%";
+      query.prepare("SELECT uid, version_id FROM Components WHERE name LIKE :name OR description LIKE :description");
+      query.bindValue(":name", pattern);
+      query.bindValue(":description", pattern);
+    }
+    query.exec();
     while (query.next())
     {
-      // DLM: this does not look like it is handling error of missing file correctly
-      boost::optional<BCLComponent> current(toString(toPath(m_libraryPath) / toPath(query.value(0).toString()) / toPath(query.value(1).toString())));
+      boost::optional<BCLComponent> current = loadComponent(query.value(0).toString(), query.value(1).toString());
       if (current)
       {
         results.push_back(*current);
@@ -410,14 +555,34 @@ namespace openstudio{
   std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm,
     const std::string& componentType) const 
   {
+    QString terms = searchQuery(searchTerm);
+    if (terms.isEmpty())
+    {
+      return measures();
+    }
+
     std::vector<BCLMeasure> results;
     QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
     QSqlQuery query(database);
-    query.exec(toQString("SELECT uid, version_id FROM Measures where name LIKE \"%"+searchTerm+"%\""
-      "OR description LIKE \"%"+searchTerm+"%\" OR modeler_description LIKE \"%"+searchTerm+"%\""));
+    if (m_hasSearchIndex)
+    {
+      query.prepare("SELECT uid, version_id FROM Measures WHERE rowid IN "
+        "(SELECT docid FROM MeasuresSearch WHERE MeasuresSearch MATCH :terms)");
+      query.bindValue(":terms", terms);
+    }
+    else
+    {
+      QString pattern = "%" + toQString(searchTerm) + "%";
+      query.prepare("SELECT uid, version_id FROM Measures WHERE name LIKE :name "
+        "OR description LIKE :description OR modeler_description LIKE :modelerDescription");
+      query.bindValue(":name", pattern);
+      query.bindValue(":description", pattern);
+      query.bindValue(":modelerDescription", pattern);
+    }
+    query.exec();
     while (query.next())
     {
-      boost::optional<BCLMeasure> current = BCLMeasure::load(toPath(m_libraryPath) / toPath(query.value(0).toString()) / toPath(query.value(1).toString()));
+      boost::optional<BCLMeasure> current = loadMeasure(query.value(0).toString(), query.value(1).toString());
       if (current)
       {
         results.push_back(*current);
@@ -436,205 +601,318 @@ namespace openstudio{
 
   bool LocalBCL::addComponent(BCLComponent& component)
   {
-    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
-    QSqlQuery query(database);
-    //Check for uid
-    if (!component.uid().empty() && !component.versionId().empty())
+    return addComponents(std::vector<BCLComponent>(1, component));
+  }
+
+  bool LocalBCL::removeComponent(BCLComponent& component)
+  {
+    return removeComponents(std::vector<BCLComponent>(1, component));
+  }
+
+  bool LocalBCL::addMeasure(BCLMeasure& measure)
+  {
+    return addMeasures(std::vector<BCLMeasure>(1, measure));
+  }
+
+  bool LocalBCL::removeMeasure(BCLMeasure& measure)
+  {
+    return removeMeasures(std::vector<BCLMeasure>(1, measure));
+  }
+
+  bool LocalBCL::addComponents(const std::vector<BCLComponent>& components)
+  {
+    //Check for uid, if a uid and version id is repeated the last component wins
+    std::map<UidVersionId, unsigned> lastIndex;
+    for (unsigned i = 0; i < components.size(); ++i)
     {
-      if (!query.exec(QString("DELETE FROM Components WHERE uid='%1' AND version_id='%2'").arg(
-        escape(component.uid()), escape(component.versionId()))))
+      if (components[i].uid().empty() || components[i].versionId().empty())
+      {
         return false;
+      }
+      lastIndex[UidVersionId(components[i].uid(), components[i].versionId())] = i;
+    }
 
-      if (!query.exec(QString("INSERT INTO Components (uid, version_id, name, description, "
-        "date_added, date_modified) VALUES('%1', '%2', '%3', '%4', %5, %6)").arg(
-        escape(component.uid()), escape(component.versionId()), escape(component.name()),
-        escape(component.description()), "datetime('now','localtime')", "datetime('now','localtime')")))
-        return false;
+    std::vector<UidVersionId> uidVersionIds;
+    for (const auto& entry : lastIndex)
+    {
+      uidVersionIds.push_back(entry.first);
+      m_componentCache.erase(entry.first);
+    }
 
-      //Insert files
-      if (!query.exec(QString("DELETE FROM Files WHERE uid='%1' AND version_id='%2'").arg(
-          escape(component.uid()), escape(component.versionId()))))
-          return false;
-      if (!component.files().empty())
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    if (!database.transaction())
+    {
+      return false;
+    }
+
+    bool success = removeEntries(database, "Components", uidVersionIds);
+
+    QSqlQuery componentQuery(database);
+    QSqlQuery fileQuery(database);
+    QSqlQuery attributeQuery(database);
+    success = success && componentQuery.prepare("INSERT INTO Components (uid, version_id, name, description, "
+      "date_added, date_modified) VALUES (:uid, :versionId, :name, :description, "
+      "datetime('now','localtime'), datetime('now','localtime'))");
+    success = success && fileQuery.prepare("INSERT INTO Files (uid, version_id, filename, filetype) "
+      "VALUES (:uid, :versionId, :filename, :filetype)");
+    success = success && attributeQuery.prepare("INSERT INTO Attributes (uid, version_id, name, value, units, type) "
+      "VALUES (:uid, :versionId, :name, :value, :units, :type)");
+
+    for (unsigned i = 0; success && i < components.size(); ++i)
+    {
+      const BCLComponent& component = components[i];
+      if (lastIndex[UidVersionId(component.uid(), component.versionId())] != i)
       {
-        for (int i=0; i < (int) component.files().size(); i++)
-        {
-          if (!query.exec(QString("INSERT INTO Files (uid, version_id, filename, filetype) "
-            "VALUES('%1', '%2', '%3', '%4')").arg(escape(component.uid()), escape(component.versionId()),
-            escape(component.files()[i]), escape(component.filetypes()[i]))))
-            return false;
-        }
+        continue;
       }
-      //Insert attributes
-      if (!query.exec(QString("DELETE FROM Attributes WHERE uid='%1' AND version_id='%2'").arg(
-          escape(component.uid()), escape(component.versionId()))))
-          return false;
-      if (!component.attributes().empty())
+
+      componentQuery.bindValue(":uid", toQString(component.uid()));
+      componentQuery.bindValue(":versionId", toQString(component.versionId()));
+      componentQuery.bindValue(":name", toQString(component.name()));
+      componentQuery.bindValue(":description", toQString(component.description()));
+      success = componentQuery.exec();
+
+      //Insert files
+      std::vector<std::string> files = component.files();
+      std::vector<std::string> filetypes = component.filetypes();
+      for (unsigned j = 0; success && j < files.size(); ++j)
       {
-        for (const Attribute& attribute : component.attributes())
-        {
-          std::string dataValue, dataType;
-          if (attribute.valueType().value() == AttributeValueType::Boolean) {
-            dataValue = boost::lexical_cast<std::string>(attribute.valueAsBoolean());
-            dataType = "boolean";
-          } else if (attribute.valueType().value() == AttributeValueType::Integer) {
-            dataValue = boost::lexical_cast<std::string>(attribute.valueAsInteger());
-            dataType = "int";
-          } else if (attribute.valueType().value() == AttributeValueType::Double) {
-            dataValue = formatString(attribute.valueAsDouble());
-            dataType = "float";
-          } else {
-            dataValue = attribute.valueAsString();
-            dataType = "string";
-          }
-
-          if (!query.exec(QString("INSERT INTO Attributes (uid, version_id, name, value, units, type) "
-            "VALUES('%1', '%2', '%3', '%4', '%5', '%6')").arg(escape(component.uid()), escape(component.versionId()),
-            escape(attribute.name()), escape(dataValue), escape(attribute.units() ? attribute.units().get() : ""),
-            escape(dataType))))
-            return false;
-        }
+        fileQuery.bindValue(":uid", toQString(component.uid()));
+        fileQuery.bindValue(":versionId", toQString(component.versionId()));
+        fileQuery.bindValue(":filename", toQString(files[j]));
+        fileQuery.bindValue(":filetype", toQString(filetypes[j]));
+        success = fileQuery.exec();
       }
-      return true;
+
+      //Insert attributes
+      success = success && insertAttributes(attributeQuery, component.uid(), component.versionId(), component.attributes());
+    }
+
+    if (success)
+    {
+      return database.commit();
     }
 
+    database.rollback();
     return false;
   }
 
-  bool LocalBCL::removeComponent(BCLComponent& component)
+  bool LocalBCL::removeComponents(const std::vector<BCLComponent>& components)
   {
-    // if uid is empty or not found in database return false
-    if (component.uid().empty() || component.versionId().empty()){
-      return false;
-    }
-
-    // proceed deleting component
-    openstudio::path pathToRemove = toPath(m_libraryPath) / toPath(component.uid()) / toPath(component.versionId());
-    QDir dir(toQString(pathToRemove.parent_path()));
-    dir.setFilter(QDir::AllDirs | QDir::NoDotAndDotDot);
-    // Only one versionId, delete the uid directory
-    if (dir.entryInfoList().size() == 1)
+    bool result = true;
+    std::vector<UidVersionId> uidVersionIds;
+    for (const BCLComponent& component : components)
     {
-      pathToRemove = pathToRemove.parent_path();
+      // if uid is empty or not found in database return false
+      if (component.uid().empty() || component.versionId().empty()){
+        result = false;
+        continue;
+      }
+
+      // proceed deleting component
+      openstudio::path pathToRemove = toPath(m_libraryPath) / toPath(component.uid()) / toPath(component.versionId());
+      QDir dir(toQString(pathToRemove.parent_path()));
+      dir.setFilter(QDir::AllDirs | QDir::NoDotAndDotDot);
+      // Only one versionId, delete the uid directory
+      if (dir.entryInfoList().size() == 1)
+      {
+        pathToRemove = pathToRemove.parent_path();
+      }
+      removeDirectory(pathToRemove);
+
+      uidVersionIds.push_back(UidVersionId(component.uid(), component.versionId()));
+      m_componentCache.erase(uidVersionIds.back());
     }
-    removeDirectory(pathToRemove);
 
     QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
-    QSqlQuery query(database);
-    bool test = query.exec(QString("DELETE FROM Components WHERE uid='%1' AND version_id='%2'").arg(escape(component.uid()),
-      escape(component.versionId())));
+    bool test = database.transaction();
     OS_ASSERT(test);
 
-    test = query.exec(QString("DELETE FROM Files WHERE uid='%1' AND version_id='%2'").arg(escape(component.uid()),
-      escape(component.versionId())));
+    test = removeEntries(database, "Components", uidVersionIds);
     OS_ASSERT(test);
 
-    test = query.exec(QString("DELETE FROM Attributes WHERE uid='%1' AND version_id='%2'").arg(escape(component.uid()),
-      escape(component.versionId())));
+    test = database.commit();
     OS_ASSERT(test);
 
-    return true;
+    return result;
   }
 
-  bool LocalBCL::addMeasure(BCLMeasure& measure)
+  bool LocalBCL::addMeasures(const std::vector<BCLMeasure>& measures)
   {
-    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
-    QSqlQuery query(database);
-    //Check for uid
-    if (!measure.uid().empty() && !measure.versionId().empty())
+    //Check for uid, if a uid and version id is repeated the last measure wins
+    std::map<UidVersionId, unsigned> lastIndex;
+    for (unsigned i = 0; i < measures.size(); ++i)
     {
-      if (!query.exec(QString("DELETE FROM Measures WHERE uid='%1' AND version_id='%2'").arg(
-        escape(measure.uid()), escape(measure.versionId()))))
+      if (measures[i].uid().empty() || measures[i].versionId().empty())
+      {
         return false;
+      }
+      lastIndex[UidVersionId(measures[i].uid(), measures[i].versionId())] = i;
+    }
 
-      if (!query.exec(QString("INSERT INTO Measures (uid, version_id, name, description, modeler_description, "
-        "date_added, date_modified) VALUES('%1', '%2', '%3', '%4', '%5', %6, %7)").arg(
-        escape(measure.uid()), escape(measure.versionId()), escape(measure.name()), escape(measure.description()),
-        escape(measure.modelerDescription()), "datetime('now','localtime')", "datetime('now','localtime')")))
-        return false;
+    std::vector<UidVersionId> uidVersionIds;
+    for (const auto& entry : lastIndex)
+    {
+      uidVersionIds.push_back(entry.first);
+      m_measureCache.erase(entry.first);
+    }
 
-      //Insert files
-      if (!query.exec(QString("DELETE FROM Files WHERE uid='%1' AND version_id='%2'").arg(
-          escape(measure.uid()), escape(measure.versionId()))))
-          return false;
-      if (!measure.files().empty())
+    QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
+    if (!database.transaction())
+    {
+      return false;
+    }
+
+    bool success = removeEntries(database, "Measures", uidVersionIds);
+
+    QSqlQuery measureQuery(database);
+    QSqlQuery fileQuery(database);
+    QSqlQuery attributeQuery(database);
+    success = success && measureQuery.prepare("INSERT INTO Measures (uid, version_id, name, description, modeler_description, "
+      "date_added, date_modified) VALUES (:uid, :versionId, :name, :description, :modelerDescription, "
+      "datetime('now','localtime'), datetime('now','localtime'))");
+    success = success && fileQuery.prepare("INSERT INTO Files (uid, version_id, filename, filetype, usage_type, checksum) "
+      "VALUES (:uid, :versionId, :filename, :filetype, :usageType, :checksum)");
+    success = success && attributeQuery.prepare("INSERT INTO Attributes (uid, version_id, name, value, units, type) "
+      "VALUES (:uid, :versionId, :name, :value, :units, :type)");
+
+    for (unsigned i = 0; success && i < measures.size(); ++i)
+    {
+      const BCLMeasure& measure = measures[i];
+      if (lastIndex[UidVersionId(measure.uid(), measure.versionId())] != i)
       {
-        for (const BCLFileReference& file : measure.files())
-        {
-          if (!query.exec(QString("INSERT INTO Files (uid, version_id, filename, filetype, usage_type, checksum) "
-            "VALUES('%1', '%2', '%3', '%4', '%5', '%6')").arg(escape(measure.uid()), escape(measure.versionId()),
-            escape(file.fileName()), escape(file.fileType()), escape(file.usageType()), escape(file.checksum()))))
-            return false;
-        }
+        continue;
       }
 
-      //Insert attributes
-      if (!query.exec(QString("DELETE FROM Attributes WHERE uid='%1' AND version_id='%2'").arg(
-          escape(measure.uid()), escape(measure.versionId()))))
-          return false;
-      if (!measure.attributes().empty())
+      measureQuery.bindValue(":uid", toQString(measure.uid()));
+      measureQuery.bindValue(":versionId", toQString(measure.versionId()));
+      measureQuery.bindValue(":name", toQString(measure.name()));
+      measureQuery.bindValue(":description", toQString(measure.description()));
+      measureQuery.bindValue(":modelerDescription", toQString(measure.modelerDescription()));
+      success = measureQuery.exec();
+
+      //Insert files
+      for (const BCLFileReference& file : measure.files())
       {
-        for (const Attribute& attribute : measure.attributes())
+        if (!success)
         {
-          std::string dataValue, dataType;
-          if (attribute.valueType().value() == AttributeValueType::Boolean) {
-            dataValue = boost::lexical_cast<std::string>(attribute.valueAsBoolean());
-            dataType = "boolean";
-          } else if (attribute.valueType().value() == AttributeValueType::Integer) {
-            dataValue = boost::lexical_cast<std::string>(attribute.valueAsInteger());
-            dataType = "int";
-          } else if (attribute.valueType().value() == AttributeValueType::Double) {
-            dataValue = formatString(attribute.valueAsDouble());
-            dataType = "float";
-          } else {
-            dataValue = attribute.valueAsString();
-            dataType = "string";
-          }
-
-          if (!query.exec(QString("INSERT INTO Attributes (uid, version_id, name, value, units, type) "
-            "VALUES('%1', '%2', '%3', '%4', '%5', '%6')").arg(escape(measure.uid()), escape(measure.versionId()),
-            escape(attribute.name()), escape(dataValue), escape(attribute.units() ? attribute.units().get() : ""),
-            escape(dataType))))
-            return false;
+          break;
         }
+        fileQuery.bindValue(":uid", toQString(measure.uid()));
+        fileQuery.bindValue(":versionId", toQString(measure.versionId()));
+        fileQuery.bindValue(":filename", toQString(file.fileName()));
+        fileQuery.bindValue(":filetype", toQString(file.fileType()));
+        fileQuery.bindValue(":usageType", toQString(file.usageType()));
+        fileQuery.bindValue(":checksum", toQString(file.checksum()));
+        success = fileQuery.exec();
       }
-      return true;
+
+      //Insert attributes
+      success = success && insertAttributes(attributeQuery, measure.uid(), measure.versionId(), measure.attributes());
     }
+
+    if (success)
+    {
+      return database.commit();
+    }
+
+    database.rollback();
     return false;
   }
 
-  bool LocalBCL::removeMeasure(BCLMeasure& measure)
+  bool LocalBCL::removeMeasures(const std::vector<BCLMeasure>& measures)
   {
-    // if uid is empty or not found in database return false
-    if (measure.uid().empty() || measure.versionId().empty()){
-      return false;
-    }
-
-    // proceed deleting measure
-    openstudio::path pathToRemove = toPath(m_libraryPath) / toPath(measure.uid()) / toPath(measure.versionId());
-    QDir dir(toQString(pathToRemove.parent_path()));
-    dir.setFilter(QDir::AllDirs | QDir::NoDotAndDotDot);
-    // Only one versionId, delete the uid directory
-    if (dir.entryInfoList().size() == 1)
+    bool result = true;
+    std::vector<UidVersionId> uidVersionIds;
+    for (const BCLMeasure& measure : measures)
     {
-      pathToRemove = pathToRemove.parent_path();
+      // if uid is empty or not found in database return false
+      if (measure.uid().empty() || measure.versionId().empty()){
+        result = false;
+        continue;
+      }
+
+      // proceed deleting measure
+      openstudio::path pathToRemove = toPath(m_libraryPath) / toPath(measure.uid()) / toPath(measure.versionId());
+      QDir dir(toQString(pathToRemove.parent_path()));
+      dir.setFilter(QDir::AllDirs | QDir::NoDotAndDotDot);
+      // Only one versionId, delete the uid directory
+      if (dir.entryInfoList().size() == 1)
+      {
+        pathToRemove = pathToRemove.parent_path();
+      }
+      removeDirectory(pathToRemove);
+
+      uidVersionIds.push_back(UidVersionId(measure.uid(), measure.versionId()));
+      m_measureCache.erase(uidVersionIds.back());
     }
-    removeDirectory(pathToRemove);
 
     QSqlDatabase database = QSqlDatabase::database(m_libraryPath+m_dbName);
-    QSqlQuery query(database);
-    bool test = query.exec(QString("DELETE FROM Measures WHERE uid='%1' AND version_id='%2'").arg(escape(measure.uid()),
-      escape(measure.versionId())));
+    bool test = database.transaction();
     OS_ASSERT(test);
 
-    test = query.exec(QString("DELETE FROM Files WHERE uid='%1' AND version_id='%2'").arg(escape(measure.uid()),
-      escape(measure.versionId())));
+    test = removeEntries(database, "Measures", uidVersionIds);
     OS_ASSERT(test);
 
-    test = query.exec(QString("DELETE FROM Attributes WHERE uid='%1' AND version_id='%2'").arg(escape(measure.uid()),
-      escape(measure.versionId())));
+    test = database.commit();
     OS_ASSERT(test);
 
+    return result;
+  }
+
+  bool LocalBCL::removeEntries(QSqlDatabase& database, const QString& table,
+    const std::vector<std::pair<std::string, std::string> >& uidVersionIds)
+  {
+    bool success = true;
+    for (const QString& tableName : QStringList() << table << "Files" << "Attributes")
+    {
+      QSqlQuery query(database);
+      success = success && query.prepare(QString("DELETE FROM %1 WHERE uid = :uid AND version_id = :versionId").arg(tableName));
+      for (const auto& uidVersionId : uidVersionIds)
+      {
+        if (!success)
+        {
+          break;
+        }
+        query.bindValue(":uid", toQString(uidVersionId.first));
+        query.bindValue(":versionId", toQString(uidVersionId.second));
+        success = query.exec();
+      }
+    }
+    return success;
+  }
+
+  bool LocalBCL::insertAttributes(QSqlQuery& query, const std::string& uid, const std::string& versionId,
+    const std::vector<Attribute>& attributes)
+  {
+    for (const Attribute& attribute : attributes)
+    {
+      std::string dataValue, dataType;
+      if (attribute.valueType().value() == AttributeValueType::Boolean) {
+        dataValue = boost::lexical_cast<std::string>(attribute.valueAsBoolean());
+        dataType = "boolean";
+      } else if (attribute.valueType().value() == AttributeValueType::Integer) {
+        dataValue = boost::lexical_cast<std::string>(attribute.valueAsInteger());
+        dataType = "int";
+      } else if (attribute.valueType().value() == AttributeValueType::Double) {
+        dataValue = formatString(attribute.valueAsDouble());
+        dataType = "float";
+      } else {
+        dataValue = attribute.valueAsString();
+        dataType = "string";
+      }
+
+      query.bindValue(":uid", toQString(uid));
+      query.bindValue(":versionId", toQString(versionId));
+      query.bindValue(":name", toQString(attribute.name()));
+      query.bindValue(":value", toQString(dataValue));
+      query.bindValue(":units", toQString(attribute.units() ? attribute.units().get() : ""));
+      query.bindValue(":type", toQString(dataType));
+      if (!query.exec())
+      {
+        return false;
+      }
+    }
     return true;
   }
 
@@ -867,6 +1145,10 @@ namespace openstudio{
       if (!success) return false;
     }
 
+    m_componentCache.clear();
+    m_measureCache.clear();
+    m_hasSearchIndex = createSearchIndex();
+
     QSettings settings("OpenStudio", "LocalBCL");
     settings.setValue("libraryPath", path);
 
@@ -24,10 +24,14 @@
 #include "../core/Optional.hpp"
 #include "../core/Path.hpp"
 
+#include <cstdint>
+#include <ctime>
+#include <map>
 #include <string>
 #include <vector>
 
 class QSqlDatabase;
+class QSqlQuery;
 class QWidget;
 
 namespace openstudio{
@@ -87,14 +91,16 @@ namespace openstudio{
     std::vector<std::string> measureUids() const;
 
     // TODO: make this take a vector of remote bcl filters
-    /// Perform a component search of the library
+    /// Perform a component search of the library, every word in searchTerm must prefix match
+    /// a word in the component name or description, an empty searchTerm returns all components
     std::vector<BCLComponent> searchComponents(const std::string& searchTerm,
       const std::string& componentType) const;
     std::vector<BCLComponent> searchComponents(const std::string& searchTerm,
       const unsigned componentTypeTID) const;
 
     // TODO: make this take a vector of remote bcl filters
-    /// Perform a measure search of the library
+    /// Perform a measure search of the library, every word in searchTerm must prefix match a word
+    /// in the measure name, description, or modeler description, an empty searchTerm returns all measures
     virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm,
       const std::string& componentType) const;
     virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm,
@@ -116,6 +122,22 @@ namespace openstudio{
     /// Remove a measure from the local library and delete its directory
     bool removeMeasure(BCLMeasure& measure);
 
+    /// Add components to the local library in a single transaction, returns false and
+    /// leaves the library unchanged if any component cannot be added
+    bool addComponents(const std::vector<BCLComponent>& components);
+
+    /// Remove components from the local library in a single transaction and delete their directories,
+    /// returns false if any component does not have a uid and version id
+    bool removeComponents(const std::vector<BCLComponent>& components);
+
+    /// Add measures to the local library in a single transaction, returns false and
+    /// leaves the library unchanged if any measure cannot be added
+    bool addMeasures(const std::vector<BCLMeasure>& measures);
+
+    /// Remove measures from the local library in a single transaction and delete their directories,
+    /// returns false if any measure does not have a uid and version id
+    bool removeMeasures(const std::vector<BCLMeasure>& measures);
+
     /// Search for components with attributes matching those in searchTerms
     std::vector<BCLComponent> componentAttributeSearch(const std::vector<std::pair<std::string, std::string> >& searchTerms) const;
 
@@ -148,6 +170,8 @@ namespace openstudio{
     //@}
   private:
 
+    REGISTER_LOGGER("openstudio.LocalBCL");
+
     /// private constructor
     LocalBCL(const path& libraryPath);
 
@@ -158,6 +182,25 @@ namespace openstudio{
 
     bool updateLocalDb();
 
+    // creates the full text search tables and the triggers that keep them in sync with
+    // Components and Measures if they do not exist, returns false if full text search is unavailable
+    bool createSearchIndex();
+
+    // converts a search term to a full text search query, each word becomes a prefix match
+    static QString searchQuery(const std::string& searchTerm);
+
+    // loads a component or measure from the library, reusing the parsed metadata if the
+    // modification time and size of its xml file have not changed since it was last loaded
+    boost::optional<BCLComponent> loadComponent(const QString& uid, const QString& versionId) const;
+    boost::optional<BCLMeasure> loadMeasure(const QString& uid, const QString& versionId) const;
+
+    // deletes rows for the given uid, version id pairs from table, Files, and Attributes
+    bool removeEntries(QSqlDatabase& database, const QString& table,
+      const std::vector<std::pair<std::string, std::string> >& uidVersionIds);
+
+    bool insertAttributes(QSqlQuery& query, const std::string& uid, const std::string& versionId,
+      const std::vector<Attribute>& attributes);
+
     bool validateProdAuthKey(const std::string& authKey);
     bool validateDevAuthKey(const std::string& authKey);
 
@@ -176,6 +219,12 @@ namespace openstudio{
     QString dbVersion;
     std::string m_prodAuthKey;
     std::string m_devAuthKey;
+    bool m_hasSearchIndex;
+
+    typedef std::pair<std::string, std::string> UidVersionId;
+    typedef std::pair<std::time_t, std::uintmax_t> XmlStamp;
+    mutable std::map<UidVersionId, std::pair<XmlStamp, BCLComponent> > m_componentCache;
+    mutable std::map<UidVersionId, std::pair<XmlStamp, BCLMeasure> > m_measureCache;
   };
 
 } // openstudio
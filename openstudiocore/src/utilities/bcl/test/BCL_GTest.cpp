@@ -33,6 +33,8 @@
 #include <QDir>
 #include <QFileInfo>
 
+#include <boost/lexical_cast.hpp>
+
 #include <time.h>
 
 using namespace openstudio;
@@ -424,3 +426,67 @@ TEST_F(BCLFixture, RemoteBCLMetaSearchTest)
   }
   EXPECT_TRUE(result->taxonomyTerms().empty());
 }
+
+TEST_F(BCLFixture, LocalBCL_SearchAndBatch)
+{
+  openstudio::path scratch = boost::filesystem::system_complete(toPath("./LocalBCLSearch/"));
+  if (exists(scratch)){
+    removeDirectory(scratch);
+  }
+  ASSERT_FALSE(exists(scratch));
+
+  openstudio::path libraryPath = toPath(LocalBCL::instance().libraryPath());
+
+  std::vector<BCLMeasure> measures;
+  for (unsigned i = 0; i < 20; ++i){
+    std::string name = "Qwzx Search Measure " + boost::lexical_cast<std::string>(i);
+    std::string className = BCLMeasure::makeClassName(name);
+    BCLMeasure measure(name, className, scratch / toPath(className), "Envelope.Fenestration",
+                       MeasureType::ModelMeasure, (i % 2 == 0) ? "Even plover" : "Odd plover", "Modeler Description");
+    boost::optional<BCLMeasure> installed = measure.clone(libraryPath / toPath(measure.uid()) / toPath(measure.versionId()));
+    ASSERT_TRUE(installed);
+    measures.push_back(*installed);
+  }
+
+  EXPECT_TRUE(LocalBCL::instance().addMeasures(measures));
+
+  // adding again replaces the existing rows
+  EXPECT_TRUE(LocalBCL::instance().addMeasures(measures));
+
+  // each word prefix matches a word in the name, description, or modeler description
+  EXPECT_EQ(20u, LocalBCL::instance().searchMeasures("qwzx", "").size());
+  EXPECT_EQ(20u, LocalBCL::instance().searchMeasures("Qwz", "").size());
+  EXPECT_EQ(10u, LocalBCL::instance().searchMeasures("qwzx even plover", "").size());
+  EXPECT_EQ(20u, LocalBCL::instance().searchMeasures("qwzx \"plover", "").size());
+  std::vector<BCLMeasure> results = LocalBCL::instance().searchMeasures("qwzx 7", "");
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(measures[7].uid(), results[0].uid());
+  EXPECT_EQ(measures[7].versionId(), results[0].versionId());
+
+  // repeated lookups return the same metadata, whether parsed or cached
+  for (unsigned i = 0; i < 2; ++i){
+    for (const BCLMeasure& measure : measures){
+      boost::optional<BCLMeasure> found = LocalBCL::instance().getMeasure(measure.uid(), measure.versionId());
+      ASSERT_TRUE(found);
+      EXPECT_EQ(measure.uid(), found->uid());
+      EXPECT_EQ(measure.versionId(), found->versionId());
+      EXPECT_EQ(measure.name(), found->name());
+      EXPECT_EQ(measure.description(), found->description());
+      EXPECT_EQ(measure.directory(), found->directory());
+    }
+  }
+
+  // a component without a version id fails the whole batch
+  std::vector<BCLComponent> invalid(1, BCLComponent());
+  EXPECT_FALSE(LocalBCL::instance().addComponents(invalid));
+  EXPECT_FALSE(LocalBCL::instance().removeComponents(invalid));
+
+  EXPECT_TRUE(LocalBCL::instance().removeMeasures(measures));
+  EXPECT_TRUE(LocalBCL::instance().searchMeasures("qwzx", "").empty());
+  for (const BCLMeasure& measure : measures){
+    EXPECT_FALSE(LocalBCL::instance().getMeasure(measure.uid(), measure.versionId()));
+    EXPECT_FALSE(exists(libraryPath / toPath(measure.uid()) / toPath(measure.versionId())));
+  }
+
+  removeDirectory(scratch);
+}
@@ -29,8 +29,8 @@ namespace openstudio{
 
   namespace detail{
 
-    FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path)
-      : m_path(path)
+    FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path, bool asynchronous)
+      : LogSink_Impl(asynchronous), m_path(path)
     {
       m_ofs = boost::shared_ptr<boost::filesystem::ofstream>(new boost::filesystem::ofstream(path));
       this->setStream(m_ofs);
@@ -52,6 +52,10 @@ namespace openstudio{
 
     std::vector<LogMessage> FileLogSink_Impl::logMessages() const
     {
+      if (this->isAsynchronous()){
+        this->sink()->flush();
+      }
+
       boost::filesystem::ifstream ifs(m_path);
       std::string line;
       std::string text;
@@ -68,6 +72,12 @@ namespace openstudio{
     OS_ASSERT(getImpl<detail::FileLogSink_Impl>());
   }
 
+  FileLogSink::FileLogSink(const openstudio::path& path, bool asynchronous)
+    : LogSink(boost::shared_ptr<detail::FileLogSink_Impl>(new detail::FileLogSink_Impl(path, asynchronous)))
+  {
+    OS_ASSERT(getImpl<detail::FileLogSink_Impl>());
+  }
+
   openstudio::path FileLogSink::path() const
   {
     return this->getImpl<detail::FileLogSink_Impl>()->path();
@@ -35,10 +35,15 @@ namespace openstudio{
     /// and registers in the global logger
     FileLogSink(const openstudio::path& path);
 
+    /// constructor takes path of file, opens in write mode positioned at file beginning
+    /// and registers in the global logger, if asynchronous messages are queued and written
+    /// by a background thread so logging threads never wait on file I/O
+    FileLogSink(const openstudio::path& path, bool asynchronous);
+
     /// returns the path that log messages are written to
     openstudio::path path() const;
 
-    /// get messages out of the file content
+    /// get messages out of the file content, waits for queued messages to be written
     std::vector<LogMessage> logMessages() const;
 
   };
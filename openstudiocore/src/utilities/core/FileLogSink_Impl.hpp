@@ -36,7 +36,7 @@ namespace openstudio{
 
       /// constructor takes path of file, opens in write mode positioned at file beginning
       /// and registers in the global logger
-      FileLogSink_Impl(const openstudio::path& path);
+      FileLogSink_Impl(const openstudio::path& path, bool asynchronous = false);
 
       /// destructor, does not disable log sink
       virtual ~FileLogSink_Impl();
@@ -44,7 +44,7 @@ namespace openstudio{
       /// returns the path that log messages are written to
       openstudio::path path() const;
 
-      /// get messages out of the file content
+      /// get messages out of the file content, waits for queued messages to be written
       std::vector<LogMessage> logMessages() const;
 
       private:
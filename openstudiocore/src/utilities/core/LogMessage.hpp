@@ -25,6 +25,7 @@
 #include "String.hpp"
 
 #include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/text_ostream_backend.hpp>
 #include <boost/log/sources/severity_channel_logger.hpp>
 
@@ -48,6 +49,9 @@ namespace openstudio{
   /// Type of stream sink used
   typedef boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend> LogSinkBackend;
 
+  /// Type of stream sink used by asynchronous sinks, records are queued and written by a background thread
+  typedef boost::log::sinks::asynchronous_sink<boost::log::sinks::text_ostream_backend> AsynchronousLogSinkBackend;
+
   /// Type of logger used
   typedef boost::log::sources::severity_channel_logger_mt<LogLevel> LoggerType;
 
@@ -30,10 +30,17 @@
 #include <boost/log/expressions/attr.hpp>
 #include <boost/log/attributes/value_extraction.hpp>
 
+#include <boost/weak_ptr.hpp>
+
 #include <QReadWriteLock>
 #include <QWriteLocker>
+#include <QMutex>
 #include <QThread>
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+
 namespace sinks = boost::log::sinks;
 namespace keywords = boost::log::keywords;
 namespace expr = boost::log::expressions;
@@ -42,30 +49,70 @@ namespace openstudio{
 
   namespace detail{
 
-    LogSink_Impl::LogSink_Impl()
+    namespace {
+
+      struct SinkFilter
+      {
+        boost::weak_ptr<sinks::sink> sink;
+        LogLevel logLevel;
+        boost::optional<boost::regex> channelRegex;
+      };
+
+      typedef std::map<const sinks::sink*, SinkFilter> SinkFilterMap;
+
+      // filters are kept until the sink itself is destroyed, the logger may keep a sink enabled after its LogSink is gone
+      QMutex& sinkFiltersMutex()
+      {
+        static QMutex mutex;
+        return mutex;
+      }
+
+      SinkFilterMap& sinkFilters()
+      {
+        static SinkFilterMap filters;
+        return filters;
+      }
+
+      std::atomic<unsigned>& sinkFilterGeneration()
+      {
+        static std::atomic<unsigned> generation(0);
+        return generation;
+      }
+
+    }
+
+    LogSink_Impl::LogSink_Impl(bool asynchronous)
       : m_mutex(new QReadWriteLock()), m_threadId(nullptr)
     {
-      m_sink = boost::shared_ptr<LogSinkBackend>(new LogSinkBackend());
+      if (asynchronous){
+        m_asynchronousSink = boost::shared_ptr<AsynchronousLogSinkBackend>(new AsynchronousLogSinkBackend());
+      }else{
+        m_sink = boost::shared_ptr<LogSinkBackend>(new LogSinkBackend());
+      }
     }
 
     LogSink_Impl::~LogSink_Impl()
     {
+      if (m_asynchronousSink){
+        m_asynchronousSink->flush();
+      }
+
       delete m_mutex;
     }
 
     bool LogSink_Impl::isEnabled() const
     {
-      return Logger::instance().findSink(m_sink);
+      return Logger::instance().findSink(this->sink());
     }
 
     void LogSink_Impl::enable()
     {
-      Logger::instance().addSink(m_sink);
+      Logger::instance().addSink(this->sink());
     }
 
     void LogSink_Impl::disable()
     {
-      Logger::instance().removeSink(m_sink);
+      Logger::instance().removeSink(this->sink());
     }
 
     boost::optional<LogLevel> LogSink_Impl::logLevel() const
@@ -137,7 +184,11 @@ namespace openstudio{
 
       m_autoFlush = autoFlush;
 
-      m_sink->locked_backend()->auto_flush(autoFlush);
+      if (m_asynchronousSink){
+        m_asynchronousSink->locked_backend()->auto_flush(autoFlush);
+      }else{
+        m_sink->locked_backend()->auto_flush(autoFlush);
+      }
     }
   
     QThread* LogSink_Impl::threadId() const
@@ -165,17 +216,70 @@ namespace openstudio{
       this->updateFilter(l);
     }
 
+    bool LogSink_Impl::isAsynchronous() const
+    {
+      QReadLocker l(m_mutex);
+
+      return bool(m_asynchronousSink);
+    }
+
+    void LogSink_Impl::flush()
+    {
+      this->sink()->flush();
+    }
+
+    boost::optional<LogLevel> LogSink_Impl::minimumLogLevel(const std::set<boost::shared_ptr<sinks::sink> >& sinks,
+                                                            const boost::optional<LogChannel>& channel)
+    {
+      boost::optional<LogLevel> result;
+
+      QMutexLocker l(&sinkFiltersMutex());
+
+      SinkFilterMap& filters = sinkFilters();
+      for (auto it = filters.begin(); it != filters.end(); ){
+        if (it->second.sink.expired()){
+          it = filters.erase(it);
+        }else{
+          ++it;
+        }
+      }
+
+      for (const auto& sink : sinks){
+        auto it = filters.find(sink.get());
+        if (it == filters.end()){
+          return Trace;
+        }
+        if (channel && it->second.channelRegex && !boost::regex_match(*channel, *it->second.channelRegex)){
+          continue;
+        }
+        if (!result || (it->second.logLevel < *result)){
+          result = it->second.logLevel;
+        }
+      }
+
+      return result;
+    }
+
+    unsigned LogSink_Impl::filterGeneration()
+    {
+      return sinkFilterGeneration().load();
+    }
+
     void LogSink_Impl::setStream(boost::shared_ptr<std::ostream> os)
     {
       QWriteLocker l(m_mutex);
 
-      m_sink->locked_backend()->add_stream(os);
+      if (m_asynchronousSink){
+        m_asynchronousSink->locked_backend()->add_stream(os);
+      }else{
+        m_sink->locked_backend()->add_stream(os);
+      }
 
       // set formatting, seems like you have to call this after the stream is added
       // DLM@20110701: would like to format Severity as string but can't figure out how to do it
       // because you can't overload operator<< for an enum type
       // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
-      m_sink->set_formatter(expr::stream
+      this->frontend()->set_formatter(expr::stream
         << "[" << expr::attr< LogChannel >("Channel")
         << "] <" << expr::attr< LogLevel >("Severity")
         << "> " << expr::smessage);
@@ -193,16 +297,29 @@ namespace openstudio{
       this->setAutoFlush(true);  
     }
       
-    boost::shared_ptr<LogSinkBackend> LogSink_Impl::sink() const
+    boost::shared_ptr<sinks::sink> LogSink_Impl::sink() const
     {
       QReadLocker l(m_mutex);
 
+      if (m_asynchronousSink){
+        return m_asynchronousSink;
+      }
+      return m_sink;
+    }
+
+    boost::shared_ptr<sinks::basic_formatting_sink_frontend<char> > LogSink_Impl::frontend() const
+    {
+      if (m_asynchronousSink){
+        return m_asynchronousSink;
+      }
       return m_sink;
     }
 
     void LogSink_Impl::updateFilter(const QWriteLocker& l)
     {
-      m_sink->reset_filter();
+      boost::shared_ptr<sinks::basic_formatting_sink_frontend<char> > frontend = this->frontend();
+
+      frontend->reset_filter();
 
       LogLevel filterLogLevel = Trace;
       if (m_logLevel){
@@ -215,14 +332,21 @@ namespace openstudio{
       }
 
       if (m_threadId){
-        m_sink->set_filter(expr::attr< LogLevel >("Severity") >= filterLogLevel &&
-                           expr::attr< QThread* >("QThread") == m_threadId &&
-                           expr::matches(expr::attr< LogChannel >("Channel"), filterChannelRegex));
+        frontend->set_filter(expr::attr< LogLevel >("Severity") >= filterLogLevel &&
+                             expr::attr< QThread* >("QThread") == m_threadId &&
+                             expr::matches(expr::attr< LogChannel >("Channel"), filterChannelRegex));
       }else{
-        m_sink->set_filter(expr::attr< LogLevel >("Severity") >= filterLogLevel &&
-                           expr::matches(expr::attr< LogChannel >("Channel"), filterChannelRegex));
+        frontend->set_filter(expr::attr< LogLevel >("Severity") >= filterLogLevel &&
+                             expr::matches(expr::attr< LogChannel >("Channel"), filterChannelRegex));
       }
-     
+
+      // publish the filter so the logger can skip formatting messages that no sink accepts
+      QMutexLocker filtersLock(&sinkFiltersMutex());
+      SinkFilter& sinkFilter = sinkFilters()[frontend.get()];
+      sinkFilter.sink = frontend;
+      sinkFilter.logLevel = filterLogLevel;
+      sinkFilter.channelRegex = m_channelRegex;
+      ++sinkFilterGeneration();
     }
 
   } // detail
@@ -310,12 +434,22 @@ namespace openstudio{
     m_impl->resetThreadId();
   }
 
+  bool LogSink::isAsynchronous() const
+  {
+    return m_impl->isAsynchronous();
+  }
+
+  void LogSink::flush()
+  {
+    m_impl->flush();
+  }
+
   void LogSink::setStream(boost::shared_ptr<std::ostream> os)
   {
     m_impl->setStream(os);
   }
     
-  boost::shared_ptr<LogSinkBackend> LogSink::sink() const
+  boost::shared_ptr<boost::log::sinks::sink> LogSink::sink() const
   {
     return m_impl->sink();
   }
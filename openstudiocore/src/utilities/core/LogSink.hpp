@@ -89,6 +89,12 @@ namespace openstudio{
     /// reset the thread id that messages are filtered by
     void resetThreadId();
 
+    /// are messages queued and written by a background thread
+    bool isAsynchronous() const;
+
+    /// write out all messages logged so far, blocks until the queue of an asynchronous sink is empty
+    void flush();
+
   protected:
 
     friend class LoggerSingleton;
@@ -103,7 +109,7 @@ namespace openstudio{
     void setStream(boost::shared_ptr<std::ostream> os);
 
     // for adding cout and cerr sinks to logger
-    boost::shared_ptr<LogSinkBackend> sink() const;
+    boost::shared_ptr<boost::log::sinks::sink> sink() const;
 
     // get the impl
     template<typename T>
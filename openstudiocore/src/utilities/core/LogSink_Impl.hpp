@@ -27,6 +27,8 @@
 
 #include <boost/optional.hpp>
 
+#include <set>
+
 class QReadWriteLock;
 class QWriteLocker;
 class QThread;
@@ -91,18 +93,32 @@ namespace openstudio{
       /// reset the thread id that messages are filtered by
       void resetThreadId();
 
+      /// are messages queued and written by a background thread
+      bool isAsynchronous() const;
+
+      /// write out all messages logged so far, blocks until the queue of an asynchronous sink is empty
+      void flush();
+
+      /// lowest level accepted by any of sinks, on channel if given, or none if no sink accepts anything.
+      /// sinks whose filter is not known are assumed to accept every level
+      static boost::optional<LogLevel> minimumLogLevel(const std::set<boost::shared_ptr<boost::log::sinks::sink> >& sinks,
+                                                       const boost::optional<LogChannel>& channel);
+
+      /// incremented each time the filter of any sink changes
+      static unsigned filterGeneration();
+
     protected:
 
       friend class openstudio::LogSink;
 
-      // does not register in the global logger
-      LogSink_Impl();
+      // does not register in the global logger, asynchronous sinks start their writer thread here
+      LogSink_Impl(bool asynchronous = false);
 
       // must be set in the constructor
       void setStream(boost::shared_ptr<std::ostream> os);
 
       // for adding cout and cerr sinks to logger
-      boost::shared_ptr<LogSinkBackend> sink() const;
+      boost::shared_ptr<boost::log::sinks::sink> sink() const;
 
       mutable QReadWriteLock* m_mutex;
 
@@ -110,11 +126,16 @@ namespace openstudio{
 
       void updateFilter(const QWriteLocker& l);
 
+      // filter and formatter are common to synchronous and asynchronous sinks
+      boost::shared_ptr<boost::log::sinks::basic_formatting_sink_frontend<char> > frontend() const;
+
       boost::optional<LogLevel> m_logLevel;
       boost::optional<boost::regex> m_channelRegex;
       bool m_autoFlush;
       QThread* m_threadId;
+      // exactly one of these is set
       boost::shared_ptr<LogSinkBackend> m_sink;
+      boost::shared_ptr<AsynchronousLogSinkBackend> m_asynchronousSink;
     };
 
   } // detail
@@ -18,6 +18,7 @@
 **********************************************************************/
 
 #include "Logger.hpp"
+#include "LogSink_Impl.hpp"
 
 #include <boost/log/common.hpp>
 #include <boost/log/core/record.hpp>
@@ -35,6 +36,7 @@
 
 #include <boost/utility/empty_deleter.hpp>
 
+#include <atomic>
 #include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -49,6 +51,15 @@ namespace keywords = boost::log::keywords;
 
 namespace openstudio{
 
+  namespace {
+
+    // lowest level accepted by the enabled sinks and the sink filter generation it was computed for,
+    // read on every LOG call so they are atomics rather than members guarded by the logger's lock
+    std::atomic<int> enabledLogLevel(Trace);
+    std::atomic<unsigned> enabledLogLevelGeneration(~0u);
+
+  }
+
   // handle Qt messages
   void logQtMessage(QtMsgType type, const char *msg)
   {
@@ -80,6 +91,16 @@ namespace openstudio{
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
+  bool logLevelEnabled(LogLevel level)
+  {
+    return openstudio::Logger::instance().logLevelEnabled(level);
+  }
+
+  bool logChannelEnabled(LogLevel level, const std::string& channel)
+  {
+    return openstudio::Logger::instance().logChannelEnabled(level, channel);
+  }
+
   LoggerSingleton::LoggerSingleton()
     : m_mutex(new QReadWriteLock())
   {
@@ -107,6 +128,16 @@ namespace openstudio{
     // unregister Qt message handler
     //qInstallMsgHandler(consoleLogQtMessage);
 
+    // write out messages still queued in asynchronous sinks and stop their writer threads
+    for (const auto& sink : m_sinks){
+      boost::shared_ptr<AsynchronousLogSinkBackend> asynchronousSink = boost::dynamic_pointer_cast<AsynchronousLogSinkBackend>(sink);
+      if (asynchronousSink){
+        boost::log::core::get()->remove_sink(sink);
+        asynchronousSink->stop();
+        asynchronousSink->feed_records();
+      }
+    }
+
     delete m_mutex;
   }
 
@@ -149,7 +180,60 @@ namespace openstudio{
     return it->second;
   }
 
-  bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink)
+  bool LoggerSingleton::logLevelEnabled(LogLevel level)
+  {
+    if (enabledLogLevelGeneration.load() != detail::LogSink_Impl::filterGeneration()){
+      updateLogLevels();
+    }
+
+    return level >= enabledLogLevel.load();
+  }
+
+  bool LoggerSingleton::logChannelEnabled(LogLevel level, const LogChannel& logChannel)
+  {
+    if (!logLevelEnabled(level)){
+      return false;
+    }
+
+    {
+      QReadLocker l(m_mutex);
+
+      auto it = m_channelLogLevels.find(logChannel);
+      if (it != m_channelLogLevels.end()){
+        return it->second && (level >= *(it->second));
+      }
+    }
+
+    // matching channel filters is the expensive part, only done once per channel until sinks change
+    QWriteLocker l(m_mutex);
+
+    boost::optional<LogLevel> channelLogLevel = detail::LogSink_Impl::minimumLogLevel(m_sinks, logChannel);
+    m_channelLogLevels[logChannel] = channelLogLevel;
+
+    return channelLogLevel && (level >= *channelLogLevel);
+  }
+
+  void LoggerSingleton::updateLogLevels()
+  {
+    QWriteLocker l(m_mutex);
+
+    // read the generation first so a filter changed while computing triggers another update
+    unsigned generation = detail::LogSink_Impl::filterGeneration();
+
+    boost::optional<LogLevel> logLevel = detail::LogSink_Impl::minimumLogLevel(m_sinks, boost::none);
+    if (logLevel){
+      enabledLogLevel = *logLevel;
+    }else{
+      // no sink accepts anything
+      enabledLogLevel = Fatal + 1;
+    }
+
+    m_channelLogLevels.clear();
+
+    enabledLogLevelGeneration = generation;
+  }
+
+  bool LoggerSingleton::findSink(boost::shared_ptr<boost::log::sinks::sink> sink)
   {
     QWriteLocker l(m_mutex);
 
@@ -158,7 +242,7 @@ namespace openstudio{
     return (it != m_sinks.end());
   }
 
-  void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink)
+  void LoggerSingleton::addSink(boost::shared_ptr<boost::log::sinks::sink> sink)
   {
     QWriteLocker l(m_mutex);
 
@@ -174,10 +258,13 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
+
+      // enabled sinks changed, recompute levels on next check
+      enabledLogLevelGeneration = ~0u;
     }
   }
 
-  void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkBackend> sink)
+  void LoggerSingleton::removeSink(boost::shared_ptr<boost::log::sinks::sink> sink)
   {
     QWriteLocker l(m_mutex);
 
@@ -193,6 +280,13 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
+
+      // enabled sinks changed, recompute levels on next check
+      enabledLogLevelGeneration = ~0u;
+
+      // drain the queue of an asynchronous sink so its messages can be read back
+      l2.unlock();
+      sink->flush();
     }
   }
 
@@ -28,6 +28,7 @@
 #include "LogSink.hpp"
 
 #include <boost/shared_ptr.hpp>
+#include <boost/optional.hpp>
 
 #include <sstream>
 #include <set>
@@ -48,9 +49,9 @@ class QWriteLocker;
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// log a message from outside a registered class, the message is only formatted if an enabled sink may accept it
 #define LOG_FREE(__level__, __channel__, __message__) \
-  { \
+  if (!openstudio::logLevelEnabled(__level__) || !openstudio::logChannelEnabled(__level__, __channel__)) {} else { \
     std::stringstream _ss1; \
     _ss1 << __message__; \
     openstudio::logFree(__level__, __channel__, _ss1.str()); \
@@ -70,6 +71,12 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+  /// returns true if any enabled sink may accept messages at level, does not lock
+  UTILITIES_API bool logLevelEnabled(LogLevel level);
+
+  /// returns true if any enabled sink may accept messages at level on channel
+  UTILITIES_API bool logChannelEnabled(LogLevel level, const std::string& channel);
+
   /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
@@ -92,24 +99,34 @@ namespace openstudio{
     /// exist a new logger will be set up at the default level
     LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+    /// returns true if any enabled sink may accept messages at level, does not lock unless sinks have changed
+    bool logLevelEnabled(LogLevel level);
+
+    /// returns true if any enabled sink may accept messages at level on channel, result is cached per channel
+    bool logChannelEnabled(LogLevel level, const LogChannel& logChannel);
+
    protected:
 
     friend class detail::LogSink_Impl;
 
     /// is the sink found in the logging core
-    bool findSink(boost::shared_ptr<LogSinkBackend> sink);
+    bool findSink(boost::shared_ptr<boost::log::sinks::sink> sink);
 
     /// adds a sink to the logging core, equivalent to logSink.enable()
-    void addSink(boost::shared_ptr<LogSinkBackend> sink);
+    void addSink(boost::shared_ptr<boost::log::sinks::sink> sink);
 
     /// removes a sink to the logging core, equivalent to logSink.disable()
-    void removeSink(boost::shared_ptr<LogSinkBackend> sink);
+    /// queued messages of an asynchronous sink are written out before returning
+    void removeSink(boost::shared_ptr<boost::log::sinks::sink> sink);
 
    private:
 
     /// private constructor
     LoggerSingleton();
 
+    /// recompute the lowest level accepted by the enabled sinks and clear the channel cache
+    void updateLogLevels();
+
     mutable QReadWriteLock* m_mutex;
 
     /// standard out logger
@@ -123,8 +140,12 @@ namespace openstudio{
     LoggerMapType m_loggerMap;
 
     /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
-    typedef std::set<boost::shared_ptr<LogSinkBackend> > SinkSetType;
+    typedef std::set<boost::shared_ptr<boost::log::sinks::sink> > SinkSetType;
     SinkSetType m_sinks;
+
+    /// lowest level accepted on each channel by the enabled sinks, none if no sink accepts the channel
+    typedef std::map<LogChannel, boost::optional<LogLevel> > ChannelLogLevelMapType;
+    ChannelLogLevelMapType m_channelLogLevels;
   };
 
 #if _WIN32 || _MSC_VER
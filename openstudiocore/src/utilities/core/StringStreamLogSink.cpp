@@ -33,8 +33,8 @@ namespace openstudio{
 
   namespace detail{
 
-    StringStreamLogSink_Impl::StringStreamLogSink_Impl()
-      : m_stringstream(new std::stringstream)
+    StringStreamLogSink_Impl::StringStreamLogSink_Impl(bool asynchronous)
+      : LogSink_Impl(asynchronous), m_stringstream(new std::stringstream)
     {
       this->setStream(m_stringstream);
       this->enable();
@@ -50,6 +50,10 @@ namespace openstudio{
 
     std::string StringStreamLogSink_Impl::string() const
     {
+      if (this->isAsynchronous()){
+        this->sink()->flush();
+      }
+
       QReadLocker l(m_mutex);
 
       return m_stringstream->str();
@@ -75,6 +79,12 @@ namespace openstudio{
     OS_ASSERT(getImpl<detail::StringStreamLogSink_Impl>());
   }
 
+  StringStreamLogSink::StringStreamLogSink(bool asynchronous)
+    : LogSink(boost::shared_ptr<detail::StringStreamLogSink_Impl>(new detail::StringStreamLogSink_Impl(asynchronous)))
+  {
+    OS_ASSERT(getImpl<detail::StringStreamLogSink_Impl>());
+  }
+
   std::string StringStreamLogSink::string() const
   {
     return this->getImpl<detail::StringStreamLogSink_Impl>()->string();
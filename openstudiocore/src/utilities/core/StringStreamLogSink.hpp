@@ -33,7 +33,11 @@ namespace openstudio{
     /// constructor makes a new string stream to write to and registers in the global logger
     StringStreamLogSink();
 
-    /// get the string stream's content
+    /// constructor makes a new string stream to write to and registers in the global logger,
+    /// if asynchronous messages are queued and written by a background thread
+    explicit StringStreamLogSink(bool asynchronous);
+
+    /// get the string stream's content, waits for queued messages to be written
     std::string string() const;
 
     /// get messages out of the string stream's content
@@ -33,12 +33,12 @@ namespace openstudio{
       public:
 
       /// constructor makes a new string stream to write to and registers in the global logger
-      StringStreamLogSink_Impl();
+      StringStreamLogSink_Impl(bool asynchronous = false);
 
       /// destructor, disables log sink
       virtual ~StringStreamLogSink_Impl();
 
-      /// get the string stream's content
+      /// get the string stream's content, waits for queued messages to be written
       std::string string() const;
 
       /// get messages out of the string stream's content
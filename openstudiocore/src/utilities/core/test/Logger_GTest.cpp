@@ -23,6 +23,8 @@
 #include "../FileLogSink.hpp"
 #include "../StringStreamLogSink.hpp"
 
+#include <boost/timer.hpp>
+
 #include <sstream>
 
 using openstudio::toPath;
@@ -333,4 +335,120 @@ namespace
 
     EXPECT_NO_THROW(boost::filesystem::remove(path));
   }
+
+  TEST(LoggerTest, asynchronous_string_stream_logger)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink(true);
+    EXPECT_TRUE(sink.isAsynchronous());
+    sink.setChannelRegex(boost::regex("free\\..*"));
+
+    freeLogging();
+    classLogging();
+
+    // reading the content waits for the background writer
+    std::vector<LogMessage> logMessages = sink.logMessages();
+    ASSERT_EQ(2u, logMessages.size());
+    EXPECT_EQ(Debug, logMessages[0].logLevel());
+    EXPECT_EQ("free.channel", logMessages[0].logChannel());
+    EXPECT_EQ("Free Debug", logMessages[0].logMessage());
+    EXPECT_EQ(Error, logMessages[1].logLevel());
+    EXPECT_EQ("free.channel", logMessages[1].logChannel());
+    EXPECT_EQ("Free Error", logMessages[1].logMessage());
+
+    StringStreamLogSink synchronousSink;
+    EXPECT_FALSE(synchronousSink.isAsynchronous());
+  }
+
+  TEST(LoggerTest, asynchronous_file_logger)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    openstudio::path path = toPath("./asynchronous_file_logger.log");
+    boost::filesystem::remove(path);
+    ASSERT_FALSE(boost::filesystem::exists(path));
+
+    {
+      FileLogSink sink(path, true);
+      EXPECT_TRUE(sink.isAsynchronous());
+      sink.setLogLevel(Error);
+      sink.setChannelRegex(boost::regex("hello\\..*"));
+      ASSERT_TRUE(boost::filesystem::exists(path));
+
+      freeLogging();
+      classLogging();
+
+      // queued messages are written before disable returns
+      sink.disable();
+
+      std::vector<LogMessage> logMessages = sink.logMessages();
+      ASSERT_EQ(1u, logMessages.size());
+      EXPECT_EQ(Error, logMessages[0].logLevel());
+      EXPECT_EQ("hello.channel", logMessages[0].logChannel());
+      EXPECT_EQ("Hello Error", logMessages[0].logMessage());
+    }
+
+    EXPECT_NO_THROW(boost::filesystem::remove(path));
+  }
+
+  TEST(LoggerTest, disabled_logging)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Error);
+    sink.setChannelRegex(boost::regex("hello\\..*"));
+
+    // messages are only formatted if an enabled sink may accept them
+    unsigned numFormatted = 0;
+    auto message = [&numFormatted]() { ++numFormatted; return "Hello"; };
+
+    LOG_FREE(Debug, "hello.channel", message());
+    EXPECT_EQ(0u, numFormatted);
+    LOG_FREE(Error, "goodbye.channel", message());
+    EXPECT_EQ(0u, numFormatted);
+    LOG_FREE(Error, "hello.channel", message());
+    EXPECT_EQ(1u, numFormatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+
+    // filter changes take effect immediately
+    sink.setLogLevel(Debug);
+    LOG_FREE(Debug, "hello.channel", message());
+    EXPECT_EQ(2u, numFormatted);
+    ASSERT_EQ(2u, sink.logMessages().size());
+
+    sink.resetChannelRegex();
+    LOG_FREE(Debug, "goodbye.channel", message());
+    EXPECT_EQ(3u, numFormatted);
+    ASSERT_EQ(3u, sink.logMessages().size());
+  }
+
+  TEST(LoggerTest, disabled_logging_Performance)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Error);
+
+    const unsigned n = 1000000;
+
+    boost::timer t;
+    for (unsigned i = 0; i < n; ++i){
+      LOG_FREE(Debug, "disabled.channel", "Value " << i << " of " << n);
+    }
+    double disabled = t.elapsed();
+
+    t.restart();
+    for (unsigned i = 0; i < n; ++i){
+      std::stringstream ss;
+      ss << "Value " << i << " of " << n;
+    }
+    double formatting = t.elapsed();
+
+    EXPECT_TRUE(sink.logMessages().empty());
+
+    LOG_FREE(Error, "LoggerTest", "Disabled logging: " << disabled << " formatting only: " << formatting);
+    EXPECT_EQ(1u, sink.logMessages().size());
+  }
 }
@@ -24,6 +24,8 @@
 #include "../../time/Date.hpp"
 #include "../../time/Time.hpp"
 
+#include <boost/timer.hpp>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -550,3 +552,121 @@ TEST_F(DataFixture,TimeSeries_AddSubtractSameTimePeriod)
   // 2:30
   EXPECT_DOUBLE_EQ(6.75, ans.value(Time(0,1,30,0)));
 }
+
+TEST_F(DataFixture,TimeSeries_Aggregate)
+{
+  std::string units = "W";
+  DateTime startDateTime(Date(MonthOfYear(MonthOfYear::Feb),21), Time(0,1,0,0));
+  Time interval(0,1,0,0);
+
+  // aligned series are combined element-wise
+  std::vector<TimeSeries> aligned;
+  for (unsigned i = 0; i < 3; ++i){
+    Vector values(4);
+    for (unsigned j = 0; j < 4; ++j){
+      values(j) = double(i*j);
+    }
+    aligned.push_back(TimeSeries(startDateTime, interval, values, units));
+  }
+
+  TimeSeries total = sum(aligned);
+  TimeSeries average = mean(aligned);
+  TimeSeries peak = maximum(aligned);
+  ASSERT_EQ(4u, total.values().size());
+  ASSERT_EQ(4u, average.values().size());
+  ASSERT_EQ(4u, peak.values().size());
+  EXPECT_EQ(startDateTime, total.firstReportDateTime());
+  ASSERT_TRUE(total.intervalLength());
+  EXPECT_EQ(interval, total.intervalLength().get());
+  for (unsigned j = 0; j < 4; ++j){
+    EXPECT_DOUBLE_EQ(3.0*j, total.values()(j));
+    EXPECT_DOUBLE_EQ(1.0*j, average.values()(j));
+    EXPECT_DOUBLE_EQ(2.0*j, peak.values()(j));
+  }
+
+  TimeSeries pairwise = aligned[0] + aligned[1] + aligned[2];
+  EXPECT_TRUE(total.values() == pairwise.values());
+  EXPECT_TRUE(total.dateTimes() == pairwise.dateTimes());
+
+  // irregular series are resampled at all of their report times
+  DateTimeVector dateTimes;
+  dateTimes.push_back(startDateTime + Time(0,0,30,0));
+  dateTimes.push_back(startDateTime + Time(0,1,30,0));
+  dateTimes.push_back(startDateTime + Time(0,4,0,0));
+  Vector detailedValues(3);
+  detailedValues(0) = 10.0;
+  detailedValues(1) = 20.0;
+  detailedValues(2) = 30.0;
+  TimeSeries detailed(dateTimes, detailedValues, units);
+
+  std::vector<TimeSeries> irregular;
+  irregular.push_back(aligned[2]);
+  irregular.push_back(detailed);
+
+  total = sum(irregular);
+  pairwise = aligned[2] + detailed;
+  ASSERT_EQ(7u, total.values().size());
+  EXPECT_TRUE(total.values() == pairwise.values());
+  EXPECT_TRUE(total.dateTimes() == pairwise.dateTimes());
+  for (const DateTime& dateTime : total.dateTimes()){
+    EXPECT_DOUBLE_EQ(aligned[2].value(dateTime) + detailed.value(dateTime), total.value(dateTime));
+  }
+
+  peak = maximum(irregular);
+  ASSERT_EQ(7u, peak.values().size());
+  for (const DateTime& dateTime : peak.dateTimes()){
+    EXPECT_DOUBLE_EQ(std::max(aligned[2].value(dateTime), detailed.value(dateTime)), peak.value(dateTime));
+  }
+
+  TimeSeries difference = aligned[2] - detailed;
+  for (const DateTime& dateTime : difference.dateTimes()){
+    EXPECT_DOUBLE_EQ(aligned[2].value(dateTime) - detailed.value(dateTime), difference.value(dateTime));
+  }
+
+  // different units
+  irregular.push_back(TimeSeries(startDateTime, interval, detailedValues, "J"));
+  EXPECT_TRUE(sum(irregular).values().empty());
+  EXPECT_TRUE(mean(irregular).values().empty());
+}
+
+TEST_F(DataFixture,TimeSeries_Aggregate_Performance)
+{
+  std::string units = "W";
+  DateTime startDateTime(Date(MonthOfYear(MonthOfYear::Jan),1), Time(0,1,0,0));
+  Time interval(0,1,0,0);
+
+  std::vector<TimeSeries> meters;
+  for (unsigned i = 0; i < 200; ++i){
+    meters.push_back(TimeSeries(startDateTime, interval, linspace(i, i + 8759, 8760), units));
+  }
+
+  boost::timer t;
+  TimeSeries pairwise = meters.front();
+  for (unsigned i = 1; i < 20; ++i){
+    pairwise = pairwise + meters[i];
+  }
+  double pairwiseTime = t.elapsed();
+
+  t.restart();
+  TimeSeries total = sum(meters);
+  double sumTime = t.elapsed();
+
+  ASSERT_EQ(8760u, total.values().size());
+  EXPECT_DOUBLE_EQ(19900.0, total.values()(0));
+
+  // every other meter reports half an hour later, so each sum has to resample
+  std::vector<TimeSeries> offsetMeters;
+  for (unsigned i = 0; i < 20; ++i){
+    DateTime meterStart = startDateTime + Time(0,0,(i % 2)*30,0);
+    offsetMeters.push_back(TimeSeries(meterStart, interval, linspace(i, i + 8759, 8760), units));
+  }
+
+  t.restart();
+  TimeSeries offsetTotal = sum(offsetMeters);
+  double offsetSumTime = t.elapsed();
+
+  EXPECT_EQ(17520u, offsetTotal.values().size());
+
+  LOG(Info, "Summing 20 hourly meters pairwise: " << pairwiseTime << ", summing 200 aligned meters: "
+      << sumTime << ", summing 20 offset meters: " << offsetSumTime);
+}
@@ -20,8 +20,9 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
 #include <exception>
-#include <set>
+#include <iterator>
 
 using namespace std;
 using namespace boost;
@@ -30,6 +31,20 @@ namespace openstudio{
 
   namespace detail{
 
+    namespace {
+
+      // sorted union of two sorted vectors of date times, without repeats
+      DateTimeVector mergeDateTimes(const DateTimeVector& lhs, const DateTimeVector& rhs)
+      {
+        DateTimeVector result;
+        result.reserve(lhs.size() + rhs.size());
+        std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(result));
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+      }
+
+    }
+
     /// default constructor
     TimeSeries_Impl::TimeSeries_Impl():m_outOfRangeValue(0.0)
     {}
@@ -544,81 +559,155 @@ namespace openstudio{
       m_outOfRangeValue = value;
     }
 
+    bool TimeSeries_Impl::isAligned(const TimeSeries_Impl& other) const
+    {
+      if (this == &other){
+        return true;
+      }
+      return ((m_firstReportDateTime == other.m_firstReportDateTime) &&
+              (m_secondsFromFirstReport == other.m_secondsFromFirstReport));
+    }
+
     /// add timeseries
     std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const
     {
-      std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
+      if (m_units != other.units()){
+        LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+        return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+      }
 
-      // if same units
-      if (m_units == other.units()){
+      return addScaled(other, 1.0);
+    }
 
-        // make unique, ordered set of all date times
-        std::set<DateTime> dateTimesSet;
-        DateTimeVector dateTimes1 = dateTimes();
-        DateTimeVector dateTimes2 = other.dateTimes();
-        dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-        dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+    /// subtract timeseries
+    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const
+    {
+      if (m_units != other.units()){
+        LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+        return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+      }
 
-        // create vector out of set
-        DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+      return addScaled(other, -1.0);
+    }
 
-        // compute value at each date time
-        Vector values(dateTimesSet.size());
-        unsigned valueIndex = 0;
-        for (const DateTime& dt : dateTimes){
-          values[valueIndex] = value(dt) + other.value(dt);
+    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::addScaled(const TimeSeries_Impl& other, double factor) const
+    {
+      std::shared_ptr<TimeSeries_Impl> result;
 
-          LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
+      if (isAligned(other)){
 
-          ++valueIndex;
+        // same report times, work on the values directly
+        Vector values(m_values);
+        noalias(values) += factor * other.m_values;
+
+        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_secondsFromFirstReport, values, m_units));
+        if (m_intervalLength && other.m_intervalLength && (*m_intervalLength == *other.m_intervalLength)){
+          result->m_intervalLength = m_intervalLength;
         }
 
-        // make new result
-        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+      }else{
+
+        // values at every date time either series reports at
+        DateTimeVector dateTimes = mergeDateTimes(this->dateTimes(), other.dateTimes());
+        Vector values = valuesAt(dateTimes);
+        noalias(values) += factor * other.valuesAt(dateTimes);
 
+        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
       }
-      else{
-        LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+
+      return result;
+    }
+
+    Vector TimeSeries_Impl::valuesAt(const DateTimeVector& dateTimes) const
+    {
+      // walk dateTimes along with our own report times, only looking up values in between
+      DateTimeVector reportDateTimes = this->dateTimes();
+      unsigned numReports = reportDateTimes.size();
+      unsigned numDateTimes = dateTimes.size();
+
+      Vector result(numDateTimes);
+      unsigned j = 0;
+      for (unsigned i = 0; i < numDateTimes; ++i){
+        while ((j < numReports) && (reportDateTimes[j] < dateTimes[i])){
+          ++j;
+        }
+
+        // repeated report times are left to value to resolve
+        if ((j < numReports) && (reportDateTimes[j] == dateTimes[i]) &&
+            ((j + 1 == numReports) || (reportDateTimes[j + 1] != reportDateTimes[j]))){
+          result[i] = m_values[j];
+          ++j;
+        }else{
+          result[i] = value(dateTimes[i]);
+        }
       }
 
       return result;
     }
 
-    /// subtract timeseries
-    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const
+    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::aggregate(const std::vector<const TimeSeries_Impl*>& series, AggregationMethod method)
     {
       std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
 
-      // if same units
-      if (m_units == other.units()){
-
-        // make unique, ordered set of all date times
-        std::set<DateTime> dateTimesSet;
-        DateTimeVector dateTimes1 = dateTimes();
-        DateTimeVector dateTimes2 = other.dateTimes();
-        dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-        dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+      if (series.empty()){
+        return result;
+      }
 
-        // create vector out of set
-        DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+      const TimeSeries_Impl& first = *series.front();
+      bool aligned = true;
+      bool sameIntervalLength = true;
+      for (const TimeSeries_Impl* ts : series){
+        if (ts->units() != first.units()){
+          LOG(Warn, "Aggregating timeseries with different units returns an empty timeseries");
+          return result;
+        }
+        aligned = aligned && first.isAligned(*ts);
+        sameIntervalLength = sameIntervalLength && ts->m_intervalLength && first.m_intervalLength &&
+                             (*ts->m_intervalLength == *first.m_intervalLength);
+      }
 
-        // compute value at each date time
-        Vector values(dateTimesSet.size());
-        unsigned valueIndex = 0;
-        for (const DateTime& dt : dateTimes){
-          values[valueIndex] = value(dt) - other.value(dt);
+      DateTimeVector dateTimes;
+      Vector values;
+      if (aligned){
+        values = first.m_values;
+      }else{
+        dateTimes = first.dateTimes();
+        for (unsigned i = 1, n = series.size(); i < n; ++i){
+          dateTimes = mergeDateTimes(dateTimes, series[i]->dateTimes());
+        }
+        values = first.valuesAt(dateTimes);
+      }
 
-          LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
+      for (unsigned i = 1, n = series.size(); i < n; ++i){
+        const TimeSeries_Impl& ts = *series[i];
 
-          ++valueIndex;
+        // aligned series are combined element-wise straight from their values
+        Vector resampled;
+        if (!aligned){
+          resampled = ts.valuesAt(dateTimes);
         }
+        const Vector& tsValues = aligned ? ts.m_values : resampled;
 
-        // make new result
-        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+        if (method == MaximumAggregation){
+          for (unsigned j = 0, m = values.size(); j < m; ++j){
+            values[j] = std::max(values[j], tsValues[j]);
+          }
+        }else{
+          noalias(values) += tsValues;
+        }
+      }
 
+      if (method == MeanAggregation){
+        values /= static_cast<double>(series.size());
       }
-      else{
-        LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+
+      if (aligned){
+        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(first.m_firstReportDateTime, first.m_secondsFromFirstReport, values, first.m_units));
+        if (sameIntervalLength){
+          result->m_intervalLength = first.m_intervalLength;
+        }
+      }else{
+        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, first.m_units));
       }
 
       return result;
@@ -794,20 +883,43 @@ namespace openstudio{
 
   TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
     TimeSeries result;
-    bool first = true;
+    if (timeSeriesVector.empty()) {
+      return result;
+    }
+    if (timeSeriesVector.front().values().empty()) {
+      LOG_FREE(Info,"zero.sum","Could not sum the timeSeriesVector. Either the first series is empty, or the "
+        << "units are incompatible.");
+      return timeSeriesVector.front();
+    }
+
+    std::vector<const detail::TimeSeries_Impl*> impls;
     for (const TimeSeries& ts : timeSeriesVector) {
-      if (first) { result = ts; }
-      else { result = result + ts; }
-      if (result.values().empty()) { 
-        LOG_FREE(Info,"zero.sum","Could not sum the timeSeriesVector. Either the first series is empty, or the "
-          << "units are incompatible.");
-        break; 
-      }
-      first = false;
+      impls.push_back(ts.m_impl.get());
+    }
+    result = TimeSeries(detail::TimeSeries_Impl::aggregate(impls, detail::TimeSeries_Impl::SumAggregation));
+    if (result.values().empty()) {
+      LOG_FREE(Info,"zero.sum","Could not sum the timeSeriesVector. Either the first series is empty, or the "
+        << "units are incompatible.");
     }
     return result;
   }
 
+  TimeSeries mean(const std::vector<TimeSeries>& timeSeriesVector) {
+    std::vector<const detail::TimeSeries_Impl*> impls;
+    for (const TimeSeries& ts : timeSeriesVector) {
+      impls.push_back(ts.m_impl.get());
+    }
+    return TimeSeries(detail::TimeSeries_Impl::aggregate(impls, detail::TimeSeries_Impl::MeanAggregation));
+  }
+
+  TimeSeries maximum(const std::vector<TimeSeries>& timeSeriesVector) {
+    std::vector<const detail::TimeSeries_Impl*> impls;
+    for (const TimeSeries& ts : timeSeriesVector) {
+      impls.push_back(ts.m_impl.get());
+    }
+    return TimeSeries(detail::TimeSeries_Impl::aggregate(impls, detail::TimeSeries_Impl::MaximumAggregation));
+  }
+
   boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor() { 
     typedef TimeSeries (*functype)(const std::vector<TimeSeries>&);
     return std::function<TimeSeries (const std::vector<TimeSeries>&) > (functype(&sum));
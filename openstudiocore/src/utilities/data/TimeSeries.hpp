@@ -40,6 +40,9 @@ namespace openstudio{
     {
       public:
 
+        /// ways of combining several timeseries into one
+        enum AggregationMethod{SumAggregation, MeanAggregation, MaximumAggregation};
+
         /// default constructor
         TimeSeries_Impl();
 
@@ -125,6 +128,9 @@ namespace openstudio{
         /// set the value used for out of range data, defaults to 0
         void setOutOfRangeValue(double value);
 
+        /// true if other reports values at exactly the same date and times as this timeseries
+        bool isAligned(const TimeSeries_Impl& other) const;
+
         /// add timeseries
         std::shared_ptr<TimeSeries_Impl> operator+(const TimeSeries_Impl& other) const;
 
@@ -134,8 +140,19 @@ namespace openstudio{
         /** TimeSeries * double */
         std::shared_ptr<TimeSeries_Impl> operator*(double d) const;
 
+        /// combine all of series at each date and time any of them reports a value, series must all have the same units
+        /// if all of series are aligned the values are combined element-wise, otherwise each series is resampled at the
+        /// merged date and times of all of series
+        static std::shared_ptr<TimeSeries_Impl> aggregate(const std::vector<const TimeSeries_Impl*>& series, AggregationMethod method);
+
       private:
 
+        // this timeseries plus factor times other
+        std::shared_ptr<TimeSeries_Impl> addScaled(const TimeSeries_Impl& other, double factor) const;
+
+        // values at dateTimes, which must be sorted and include every date and time this timeseries reports at
+        Vector valuesAt(const DateTimeVector& dateTimes) const;
+
         REGISTER_LOGGER("utilities.TimeSeries_Impl");
         // fully qualified first report date
         DateTime m_firstReportDateTime;
@@ -276,6 +293,10 @@ namespace openstudio{
       //@}
     private:
 
+      friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+      friend UTILITIES_API TimeSeries mean(const std::vector<TimeSeries>& timeSeriesVector);
+      friend UTILITIES_API TimeSeries maximum(const std::vector<TimeSeries>& timeSeriesVector);
+
       REGISTER_LOGGER("utilities.TimeSeries");
       // constructor from impl
       TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
@@ -300,6 +321,16 @@ namespace openstudio{
   // Helper function to add up all the TimeSeries in timeSeriesVector.
   UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
+  /** Average of all the TimeSeries in timeSeriesVector at each date and time any of them reports a value.
+   *  Series that do not report at a given date and time contribute their value there, which may be their
+   *  out of range value. */
+  UTILITIES_API TimeSeries mean(const std::vector<TimeSeries>& timeSeriesVector);
+
+  /** Maximum of all the TimeSeries in timeSeriesVector at each date and time any of them reports a value.
+   *  Series that do not report at a given date and time contribute their value there, which may be their
+   *  out of range value. */
+  UTILITIES_API TimeSeries maximum(const std::vector<TimeSeries>& timeSeriesVector);
+
   /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
   UTILITIES_API boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor();
 
@@ -23,7 +23,7 @@
 #include <utilities/idd/IddEnums.hxx>
 #include "../core/Checksum.hpp"
 #include "../core/Assert.hpp"
-#include "../units/QuantityConverter.hpp"
+#include "../units/StaticUnitConversion.hpp"
 
 #include <boost/regex.hpp>
 #include <boost/lexical_cast.hpp>
@@ -492,9 +492,7 @@ boost::optional<std::string> EpwDataPoint::toWthString()
     LOG_FREE(Error,"openstudio.EpwFile",QString("Missing dry bulb temperature on %1 at %2").arg(date).arg(hms).toStdString());
     return boost::optional<std::string>();
   }
-  boost::optional<double> optdrybulb = openstudio::convert(value.get(), "C", "K");
-  OS_ASSERT(optdrybulb);
-  double drybulb = optdrybulb.get();
+  double drybulb = staticunits::convert<staticunits::Celsius,staticunits::Kelvin>(value.get());
   output << QString("%1").arg(drybulb);
   value = atmosphericStationPressure();
   if(!value)
@@ -526,9 +524,7 @@ boost::optional<std::string> EpwDataPoint::toWthString()
       LOG_FREE(Error,"openstudio.EpwFile",QString("Cannot compute humidity ratio on %1 at %2").arg(date).arg(hms).toStdString());
       return boost::optional<std::string>();
     }
-    boost::optional<double> optdewpoint = openstudio::convert(value.get(), "C", "K");
-    OS_ASSERT(optdewpoint);
-    double dewpoint = optdewpoint.get();
+    double dewpoint = staticunits::convert<staticunits::Celsius,staticunits::Kelvin>(value.get());
     pw = psat(dewpoint);
   }
   else // Have relative humidity
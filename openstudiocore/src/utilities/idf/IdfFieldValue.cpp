@@ -0,0 +1,242 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include "IdfFieldValue.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    // do not prune a pool smaller than this
+    const std::size_t minPruneSize = 1024;
+
+    const std::size_t handleTextSize = 38; // {xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}
+
+    const unsigned sizeByte = 30;
+    const unsigned kindByte = 31;
+
+  }
+
+  IdfStringPool::IdfStringPool()
+    : m_pruneSize(minPruneSize)
+  {}
+
+  std::shared_ptr<const std::string> IdfStringPool::intern(const std::string& value) {
+    // aliasing constructor, so lookups do not allocate
+    std::shared_ptr<const std::string> key(std::shared_ptr<const std::string>(), &value);
+
+    QMutexLocker lock(&m_mutex);
+    auto it = m_strings.find(key);
+    if (it != m_strings.end()) {
+      return *it;
+    }
+    if (m_strings.size() >= m_pruneSize) {
+      prune();
+    }
+    std::shared_ptr<const std::string> result = std::make_shared<const std::string>(value);
+    m_strings.insert(result);
+    return result;
+  }
+
+  unsigned IdfStringPool::size() const {
+    QMutexLocker lock(&m_mutex);
+    return m_strings.size();
+  }
+
+  std::size_t IdfStringPool::numChars() const {
+    QMutexLocker lock(&m_mutex);
+    std::size_t result = 0;
+    for (const std::shared_ptr<const std::string>& pooled : m_strings) {
+      result += pooled->size();
+    }
+    return result;
+  }
+
+  void IdfStringPool::prune() {
+    // a use_count of 1 means only the pool refers to the string, and new references can only be
+    // made through the pool, which is locked
+    for (auto it = m_strings.begin(); it != m_strings.end(); ) {
+      if (it->use_count() == 1) {
+        it = m_strings.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+    m_pruneSize = std::max(minPruneSize, 2 * m_strings.size());
+  }
+
+  IdfFieldValue::IdfFieldValue() {
+    setKind(EmptyKind);
+  }
+
+  IdfFieldValue::IdfFieldValue(const std::string& value, IdfStringPool* pool) {
+    setKind(EmptyKind);
+    if (value.empty()) {
+      return;
+    }
+
+    if (value.size() <= inlineCapacity()) {
+      std::memcpy(m_bytes, value.data(), value.size());
+      m_bytes[sizeByte] = static_cast<char>(value.size());
+      setKind(InlineKind);
+      return;
+    }
+
+    // only handles that print back to exactly the same text are stored as UUIDs
+    if ((value.size() == handleTextSize) && (value[0] == '{') && (value[handleTextSize - 1] == '}')) {
+      Handle candidate = toUUID(value);
+      if (!candidate.isNull() && (toString(candidate) == value)) {
+        std::memcpy(m_bytes, &candidate, sizeof(Handle));
+        setKind(HandleKind);
+        return;
+      }
+    }
+
+    if (pool) {
+      new (m_bytes) SharedString(pool->intern(value));
+    }
+    else {
+      new (m_bytes) SharedString(std::make_shared<const std::string>(value));
+    }
+    setKind(SharedKind);
+  }
+
+  IdfFieldValue::IdfFieldValue(const IdfFieldValue& other) {
+    setKind(EmptyKind);
+    copyFrom(other);
+  }
+
+  IdfFieldValue& IdfFieldValue::operator=(const IdfFieldValue& other) {
+    if (this != &other) {
+      clear();
+      copyFrom(other);
+    }
+    return *this;
+  }
+
+  IdfFieldValue::~IdfFieldValue() {
+    clear();
+  }
+
+  bool IdfFieldValue::empty() const {
+    return (kind() == EmptyKind);
+  }
+
+  std::size_t IdfFieldValue::size() const {
+    switch (kind()) {
+      case InlineKind :
+        return static_cast<unsigned char>(m_bytes[sizeByte]);
+      case HandleKind :
+        return handleTextSize;
+      case SharedKind :
+        return sharedString()->size();
+      default :
+        return 0;
+    }
+  }
+
+  std::string IdfFieldValue::str() const {
+    switch (kind()) {
+      case InlineKind :
+        return std::string(m_bytes, static_cast<unsigned char>(m_bytes[sizeByte]));
+      case HandleKind :
+        return toString(handle());
+      case SharedKind :
+        return *sharedString();
+      default :
+        return std::string();
+    }
+  }
+
+  bool IdfFieldValue::isHandle() const {
+    return (kind() == HandleKind);
+  }
+
+  Handle IdfFieldValue::handle() const {
+    Handle result;
+    if (kind() == HandleKind) {
+      std::memcpy(&result, m_bytes, sizeof(Handle));
+    }
+    return result;
+  }
+
+  void IdfFieldValue::intern(IdfStringPool& pool) {
+    if (kind() == SharedKind) {
+      SharedString pooled = pool.intern(*sharedString());
+      *reinterpret_cast<SharedString*>(m_bytes) = pooled;
+    }
+  }
+
+  unsigned IdfFieldValue::inlineCapacity() {
+    return sizeByte;
+  }
+
+  IdfFieldValue::Kind IdfFieldValue::kind() const {
+    return static_cast<Kind>(m_bytes[kindByte]);
+  }
+
+  void IdfFieldValue::setKind(Kind kind) {
+    m_bytes[kindByte] = static_cast<char>(kind);
+  }
+
+  const IdfFieldValue::SharedString& IdfFieldValue::sharedString() const {
+    OS_ASSERT(kind() == SharedKind);
+    return *reinterpret_cast<const SharedString*>(m_bytes);
+  }
+
+  void IdfFieldValue::copyFrom(const IdfFieldValue& other) {
+    OS_ASSERT(kind() == EmptyKind);
+    if (other.kind() == SharedKind) {
+      new (m_bytes) SharedString(other.sharedString());
+      setKind(SharedKind);
+    }
+    else {
+      std::memcpy(m_bytes, other.m_bytes, sizeof(m_bytes));
+    }
+  }
+
+  void IdfFieldValue::clear() {
+    if (kind() == SharedKind) {
+      reinterpret_cast<SharedString*>(m_bytes)->~SharedString();
+    }
+    setKind(EmptyKind);
+  }
+
+  std::ostream& operator<<(std::ostream& os, const IdfFieldValue& value) {
+    if (value.isHandle()) {
+      os << toString(value.handle());
+    }
+    else {
+      os << value.str();
+    }
+    return os;
+  }
+
+} // detail
+} // openstudio
@@ -0,0 +1,142 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef UTILITIES_IDF_IDFFIELDVALUE_HPP
+#define UTILITIES_IDF_IDFFIELDVALUE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Handle.hpp"
+
+#include <QMutex>
+
+#include <memory>
+#include <ostream>
+#include <set>
+#include <string>
+
+namespace openstudio {
+namespace detail {
+
+  /** Pool of shared, immutable strings, one per Workspace. Equal long field values in a
+   *  Workspace share one allocation. Strings no longer used by any field are dropped as the pool
+   *  grows. Thread-safe. */
+  class UTILITIES_API IdfStringPool {
+   public:
+    IdfStringPool();
+
+    /** Returns the pooled string equal to value, adding it if necessary. */
+    std::shared_ptr<const std::string> intern(const std::string& value);
+
+    /** Number of distinct strings in the pool. */
+    unsigned size() const;
+
+    /** Total number of characters in the distinct strings in the pool. */
+    std::size_t numChars() const;
+
+   private:
+    // non-copyable
+    IdfStringPool(const IdfStringPool& other);
+    IdfStringPool& operator=(const IdfStringPool& other);
+
+    struct PooledStringLess {
+      bool operator()(const std::shared_ptr<const std::string>& left,
+                      const std::shared_ptr<const std::string>& right) const
+      {
+        return *left < *right;
+      }
+    };
+    typedef std::set<std::shared_ptr<const std::string>,PooledStringLess> PooledStringSet;
+
+    // removes strings only the pool refers to, called when the pool reaches m_pruneSize
+    void prune();
+
+    mutable QMutex m_mutex;
+    PooledStringSet m_strings;
+    std::size_t m_pruneSize;
+  };
+
+  /** Storage for one IdfObject field. Text in handle format is kept as a 16 byte UUID and short
+   *  text is kept inline, so neither allocates. Longer text is shared, through the Workspace's
+   *  IdfStringPool if there is one. The value is always presented as the original text. */
+  class UTILITIES_API IdfFieldValue {
+   public:
+    /** Empty value. */
+    IdfFieldValue();
+
+    /** Stores value, sharing it through pool if pool is not null and value is long text. */
+    IdfFieldValue(const std::string& value, IdfStringPool* pool);
+
+    IdfFieldValue(const IdfFieldValue& other);
+
+    IdfFieldValue& operator=(const IdfFieldValue& other);
+
+    ~IdfFieldValue();
+
+    bool empty() const;
+
+    /** Number of characters in the text of this value. */
+    std::size_t size() const;
+
+    /** The text of this value. */
+    std::string str() const;
+
+    /** Returns true if the text of this value is a handle. */
+    bool isHandle() const;
+
+    /** The handle this value holds, or a null handle if !isHandle(). */
+    Handle handle() const;
+
+    /** Re-shares long text through pool. */
+    void intern(IdfStringPool& pool);
+
+    /** Maximum number of characters stored inline. */
+    static unsigned inlineCapacity();
+
+   private:
+    enum Kind {
+      EmptyKind = 0,
+      InlineKind,
+      HandleKind,
+      SharedKind
+    };
+
+    typedef std::shared_ptr<const std::string> SharedString;
+
+    Kind kind() const;
+    void setKind(Kind kind);
+
+    const SharedString& sharedString() const;
+    void copyFrom(const IdfFieldValue& other);
+    void clear();
+
+    // bytes 0-29 hold inline text, a UUID, or a SharedString. byte 30 holds the inline text
+    // size, byte 31 the Kind.
+    union {
+      char m_bytes[32];
+      double m_align;
+    };
+  };
+
+  UTILITIES_API std::ostream& operator<<(std::ostream& os, const IdfFieldValue& value);
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_IDF_IDFFIELDVALUE_HPP
@@ -45,10 +45,59 @@
 #include <boost/iostreams/filter/newline.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentMap>
+
 #include <sstream>
 
 namespace openstudio {
 
+namespace {
+
+  /// number of objects IdfFile::parse constructs at a time
+  const unsigned idfParseBatchSize = 4096;
+
+  /// text of an object split out by IdfFile::parse, and the object once constructed
+  struct PendingIdfObject {
+    PendingIdfObject(const std::string& t_text, const IddObject& t_iddObject, bool t_commentOnly)
+      : text(t_text), iddObject(t_iddObject), commentOnly(t_commentOnly)
+    {}
+
+    std::string text;
+    IddObject iddObject;
+    bool commentOnly;
+    OptionalIdfObject object;
+  };
+
+  /** Constructs the IdfObject for each entry of pending. Each object depends only on its own text
+   *  and its (read-only) IddObject, so batches are built on the global QThreadPool, and the
+   *  result is the same as constructing them one after another. */
+  void constructPendingIdfObjects(std::vector<PendingIdfObject>& pending) {
+    if ((pending.size() < 2u) || (QThreadPool::globalInstance()->maxThreadCount() < 2)) {
+      for (PendingIdfObject& p : pending) {
+        p.object = IdfObject::load(p.text,p.iddObject);
+      }
+      return;
+    }
+
+    // fill the lazily cached IddObject data up front, so the workers only read it
+    for (const PendingIdfObject& p : pending) {
+      p.iddObject.hasNameField();
+    }
+
+    // IdfObject_Impl is a QObject, so hand each one back to the calling thread
+    QThread* thread = QThread::currentThread();
+    QtConcurrent::blockingMap(pending, [thread](PendingIdfObject& p) {
+      p.object = IdfObject::load(p.text,p.iddObject);
+      if (p.object) {
+        p.object->getImpl<detail::IdfObject_Impl>()->moveToThread(thread);
+      }
+    });
+  }
+
+} // anonymous namespace
+
 // CONSTRUCTORS
 
 IdfFile::IdfFile(IddFileType iddFileType) 
@@ -165,13 +214,7 @@ void IdfFile::setHeader(const std::string& header) {
 
 void IdfFile::addObject(const IdfObject& object) {
   m_objects.push_back(object);
-  if (object.iddObject().isVersionObject()) {
-    m_versionObjectIndices.insert(m_objects.size() - 1);
-  }
-  else if ((object.iddObject().type() == IddObjectType::Catchall) &&
-           (object.numFields() > 0u) &&
-           (boost::regex_match(object.getString(0).get(),iddRegex::versionObjectName()))) 
-  {
+  if (isVersionObject(object)) {
     m_versionObjectIndices.insert(m_objects.size() - 1);
   }
 }
@@ -356,20 +399,7 @@ OptionalIdfFile IdfFile::load(std::istream& is,
 }
 
 OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar) {
-  // determine IddFileType
-  IddFileType iddType(IddFileType::EnergyPlus); // default
-
-  // switch if file extension equal to modelFileExtension() or componentFileExtension()
-  std::string pext = toString(boost::filesystem::extension(p));
-  if (!pext.empty()) {
-    // remove '.'
-    pext = std::string(++pext.begin(),pext.end());
-  }
-  if ((pext == modelFileExtension()) || (pext == componentFileExtension())) { 
-    iddType = IddFileType(IddFileType::OpenStudio); 
-  }
-  
-  return load(p, iddType, progressBar);
+  return load(p, loadIddFileType(p), progressBar);
 }
 
 OptionalIdfFile IdfFile::load(const path& p, 
@@ -377,16 +407,7 @@ OptionalIdfFile IdfFile::load(const path& p,
                               ProgressBar* progressBar) 
 {
   // complete path
-  path wp(p);
-
-  if (iddFileType == IddFileType::OpenStudio) {
-    // can be Model or Component
-    wp = completePathToFile(wp,path(),modelFileExtension(),false);
-    if (wp.empty()) { wp = completePathToFile(wp,path(),componentFileExtension(),false); }
-  }
-  else {
-    wp = completePathToFile(wp,path(),"idf",true);
-  }
+  path wp = completeLoadPath(p,iddFileType);
 
   // try to open file and parse
   boost::filesystem::ifstream inFile(wp);
@@ -402,7 +423,7 @@ OptionalIdfFile IdfFile::load(const path& p,
 
 OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar* progressBar) {
   // complete path
-  path wp = completePathToFile(p,path(),"idf",false);
+  path wp = completeLoadPath(p,boost::none);
 
   // try to open file and parse
   boost::filesystem::ifstream inFile(wp);
@@ -460,33 +481,8 @@ std::ostream& IdfFile::print(std::ostream& os) const {
 
 bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 
-  // default extension
-  std::string expectedExtension;
-  bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
-  if (iddType) {
-    if (*iddType == IddFileType::EnergyPlus) { 
-      expectedExtension = "idf"; 
-      enforceExtension = true;
-    }
-    else if (*iddType == IddFileType::OpenStudio) {
-      std::string ext = getFileExtension(p);
-      if (ext == componentFileExtension()) {
-        expectedExtension = componentFileExtension();
-        // no need to enforce b/c already checked
-      }
-      else {
-        expectedExtension = modelFileExtension(); 
-        enforceExtension = true;
-      }
-    }
-  }
-  
   // set extension if appropriate
-  path wp(p);
-  if (enforceExtension) {
-    wp = setFileExtension(p,expectedExtension,false,true);
-  }
+  path wp = savePath(p,m_iddFileAndFactoryWrapper.iddFileType());
 
   // do not overwrite if not allowed
   if (!overwrite) {
@@ -523,6 +519,21 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 // SERIALIZATION
 
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
+  return parse(is,
+               m_iddFileAndFactoryWrapper,
+               [this](const std::string& header) { setHeader(header); },
+               [this](const IdfObject& object) { addObject(object); },
+               progressBar,
+               versionOnly);
+}
+
+bool IdfFile::parse(std::istream& is,
+                    const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                    const std::function<void (const std::string&)>& setHeader,
+                    const std::function<void (const IdfObject&)>& addObject,
+                    ProgressBar* progressBar,
+                    bool versionOnly)
+{
 
   int lineNum = 0;        // Idf line number
   int objectNum = 0;      // number of objects, first is #1
@@ -531,6 +542,28 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
   std::string comment;    // keep running comment
   bool firstBlock = true; // to capture first comment block as the header
 
+  // object text is split out here, but the objects are constructed in batches, possibly in
+  // parallel, and then handed to addObject in file order
+  std::vector<PendingIdfObject> pending;
+  if (!versionOnly) {
+    pending.reserve(idfParseBatchSize);
+  }
+  auto flushPending = [&pending,&addObject]() {
+    constructPendingIdfObjects(pending);
+    for (const PendingIdfObject& p : pending) {
+      if (p.commentOnly) {
+        OS_ASSERT(p.object);
+      }
+      else if (!p.object) {
+        LOG(Error,"Unable to construct IdfObject from text: " << std::endl << p.text
+            << std::endl << "Throwing this object out and parsing the remainder of the file.");
+        continue;
+      }
+      addObject(*p.object);
+    }
+    pending.clear();
+  };
+
   if (progressBar){
     is.seekg(0, std::ios_base::end);
     int streamsize = static_cast<int>(is.tellg());
@@ -587,19 +620,19 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
           if (!versionOnly) {
 
             // make a comment only object to hold the comment
-            OptionalIddObject commentOnlyIddObject = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
+            OptionalIddObject commentOnlyIddObject = iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
             if (!commentOnlyIddObject) {
               LOG(Error,"IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
               continue;
             }
 
-            OptionalIdfObject commentOnlyObject;
-            commentOnlyObject = IdfObject::load(commentOnlyIddObject->name() + ";" + comment,
-                                                *commentOnlyIddObject);
-            OS_ASSERT(commentOnlyObject);
-            
             // put it in the object list
-            addObject(*commentOnlyObject);
+            pending.push_back(PendingIdfObject(commentOnlyIddObject->name() + ";" + comment,
+                                               *commentOnlyIddObject,
+                                               true));
+            if (pending.size() >= idfParseBatchSize) {
+              flushPending();
+            }
           }
         }
       }
@@ -635,7 +668,7 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
 
       // get the corresponding idd object entry
 
-      OptionalIddObject iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
+      OptionalIddObject iddObject = iddFileAndFactoryWrapper.getObject(objectType);
       if (!iddObject){
         if (!versionOnly) {
           LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
@@ -670,15 +703,10 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
 
       // construct the object
       if (!versionOnly || isVersion) {
-        OptionalIdfObject object = IdfObject::load(text,*iddObject);
-        if (!object) {
-          LOG(Error,"Unable to construct IdfObject from text: " << std::endl << text 
-              << std::endl << "Throwing this object out and parsing the remainder of the file.");
-          continue;
+        pending.push_back(PendingIdfObject(text,*iddObject,false));
+        if (pending.size() >= idfParseBatchSize) {
+          flushPending();
         }
-
-        // put it in the object list
-        addObject(*object);
       }
 
       if (versionOnly && isVersion) {
@@ -688,9 +716,82 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
     }
   }
 
+  flushPending();
+
   return true;
 }
 
+bool IdfFile::isVersionObject(const IdfObject& object) {
+  if (object.iddObject().isVersionObject()) {
+    return true;
+  }
+  return ((object.iddObject().type() == IddObjectType::Catchall) &&
+          (object.numFields() > 0u) &&
+          (boost::regex_match(object.getString(0).get(),iddRegex::versionObjectName())));
+}
+
+IddFileType IdfFile::loadIddFileType(const path& p) {
+  IddFileType iddType(IddFileType::EnergyPlus); // default
+
+  // switch if file extension equal to modelFileExtension() or componentFileExtension()
+  std::string pext = toString(boost::filesystem::extension(p));
+  if (!pext.empty()) {
+    // remove '.'
+    pext = std::string(++pext.begin(),pext.end());
+  }
+  if ((pext == modelFileExtension()) || (pext == componentFileExtension())) { 
+    iddType = IddFileType(IddFileType::OpenStudio); 
+  }
+
+  return iddType;
+}
+
+path IdfFile::completeLoadPath(const path& p, const boost::optional<IddFileType>& iddFileType) {
+  path wp(p);
+
+  if (!iddFileType) {
+    wp = completePathToFile(wp,path(),"idf",false);
+  }
+  else if (*iddFileType == IddFileType::OpenStudio) {
+    // can be Model or Component
+    wp = completePathToFile(wp,path(),modelFileExtension(),false);
+    if (wp.empty()) { wp = completePathToFile(wp,path(),componentFileExtension(),false); }
+  }
+  else {
+    wp = completePathToFile(wp,path(),"idf",true);
+  }
+
+  return wp;
+}
+
+path IdfFile::savePath(const path& p, const boost::optional<IddFileType>& iddFileType) {
+  // default extension
+  std::string expectedExtension;
+  bool enforceExtension = false;
+  if (iddFileType) {
+    if (*iddFileType == IddFileType::EnergyPlus) { 
+      expectedExtension = "idf"; 
+      enforceExtension = true;
+    }
+    else if (*iddFileType == IddFileType::OpenStudio) {
+      std::string ext = getFileExtension(p);
+      if (ext == componentFileExtension()) {
+        expectedExtension = componentFileExtension();
+        // no need to enforce b/c already checked
+      }
+      else {
+        expectedExtension = modelFileExtension(); 
+        enforceExtension = true;
+      }
+    }
+  }
+
+  if (enforceExtension) {
+    return setFileExtension(p,expectedExtension,false,true);
+  }
+  return p;
+}
+
 IddFileAndFactoryWrapper IdfFile::iddFileAndFactoryWrapper() const {
   return m_iddFileAndFactoryWrapper;
 }
@@ -30,6 +30,7 @@
 #include <string>
 #include <ostream>
 #include <vector>
+#include <functional>
 
 namespace openstudio{
 
@@ -212,6 +213,7 @@ class UTILITIES_API IdfFile {
   //@}
 
  protected:
+  friend class Workspace;
   friend class detail::Workspace_Impl;
 
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
@@ -237,6 +239,28 @@ class UTILITIES_API IdfFile {
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false);
 
+  /** Parses Idf text from is using iddFileAndFactoryWrapper. The header comment and each object
+   *  are handed to setHeader and addObject as soon as they are read, so callers such as
+   *  Workspace::load do not need to hold a complete IdfFile. */
+  static bool parse(std::istream& is,
+                    const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                    const std::function<void (const std::string&)>& setHeader,
+                    const std::function<void (const IdfObject&)>& addObject,
+                    ProgressBar* progressBar=nullptr,
+                    bool versionOnly=false);
+
+  /// returns true if object is a version object, including Catchall objects named like one
+  static bool isVersionObject(const IdfObject& object);
+
+  /// IddFileType implied by the extension of p, as documented for load(p)
+  static IddFileType loadIddFileType(const path& p);
+
+  /// completes p for loading, as documented for load(p,iddFileType) and load(p,iddFile)
+  static path completeLoadPath(const path& p, const boost::optional<IddFileType>& iddFileType);
+
+  /// applies the default extension rules documented for save to p
+  static path savePath(const path& p, const boost::optional<IddFileType>& iddFileType);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
@@ -54,6 +54,7 @@
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <atomic>
 #include <limits>
 
 using std::cout;
@@ -63,14 +64,28 @@ namespace openstudio {
 
 namespace detail { 
 
+  namespace {
+
+    // see IdfObject_Impl::numInstances. objects are constructed on worker threads by IdfFile::parse
+    std::atomic<unsigned> idfObjectImplInstances(0);
+    std::atomic<unsigned> idfObjectImplPeakInstances(0);
+
+  }
+
   // CONSTRUCTORS
 
+  IdfObject_Impl::IdfObject_Impl()
+  {
+    countInstance();
+  }
+
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()), 
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()), 
+      m_fields(other.m_fields), 
       m_fieldComments(other.fieldComments())
   {
+    countInstance();
     if (keepHandle){
       OS_ASSERT(!other.handle().isNull());
       m_handle = other.handle();
@@ -86,6 +101,7 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(IddObjectType type, bool fastName) 
     : m_handle(openstudio::createUUID())
   {
+    countInstance();
     OptionalIddObject candidate = IddFactory::instance().getObject(type);
     OS_ASSERT(candidate);
     m_iddObject = *candidate;
@@ -109,6 +125,7 @@ namespace detail {
     : m_handle(openstudio::createUUID()),
       m_iddObject(iddObject)
   {
+    countInstance();
     if (this->m_iddObject.hasHandleField()) {
       bool ok = setString(0,toString(m_handle));
       OS_ASSERT(ok);
@@ -128,6 +145,7 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const IddObject& iddObject, bool fastName, bool minimal)
     : m_iddObject(iddObject)
   {
+    countInstance();
     OS_ASSERT(!fastName);
     OS_ASSERT(minimal);
   }
@@ -140,12 +158,54 @@ namespace detail {
     : m_handle(handle),    
       m_comment(comment),
       m_iddObject(iddObject),
-      m_fields(fields),
       m_fieldComments(fieldComments) 
   {
+    countInstance();
+    m_fields.reserve(fields.size());
+    for (const std::string& field : fields) {
+      m_fields.push_back(fieldValue(field));
+    }
     resizeToMinFields();
   }
 
+  IdfObject_Impl::IdfObject_Impl(const Handle& handle,
+                                 const std::string& comment,
+                                 const IddObject& iddObject,
+                                 const std::vector<IdfFieldValue>& fields,
+                                 const StringVector& fieldComments)
+    : m_handle(handle),
+      m_comment(comment),
+      m_iddObject(iddObject),
+      m_fields(fields),
+      m_fieldComments(fieldComments)
+  {
+    countInstance();
+    resizeToMinFields();
+  }
+
+  IdfObject_Impl::~IdfObject_Impl()
+  {
+    --idfObjectImplInstances;
+  }
+
+  unsigned IdfObject_Impl::numInstances() {
+    return idfObjectImplInstances;
+  }
+
+  unsigned IdfObject_Impl::peakNumInstances() {
+    return idfObjectImplPeakInstances;
+  }
+
+  void IdfObject_Impl::resetPeakNumInstances() {
+    idfObjectImplPeakInstances = idfObjectImplInstances.load();
+  }
+
+  void IdfObject_Impl::countInstance() {
+    unsigned n = ++idfObjectImplInstances;
+    unsigned peak = idfObjectImplPeakInstances.load();
+    while ((n > peak) && !idfObjectImplPeakInstances.compare_exchange_weak(peak,n)) {}
+  }
+
   // GETTERS
 
   Handle IdfObject_Impl::handle() const {
@@ -200,10 +260,10 @@ namespace detail {
         if (OptionalString stringDefault = m_iddObject.nonextensibleFields()[index].properties().stringDefault) {
           return stringDefault;
         }
-        return m_fields[index];
+        return m_fields[index].str();
       }
       else if (validIndex) {
-        return m_fields[index];
+        return m_fields[index].str();
       }
     }
     return boost::none;
@@ -235,7 +295,7 @@ namespace detail {
   {
     OptionalString result;
     if (index < m_fields.size()) {
-      result = m_fields[index];
+      result = m_fields[index].str();
     }
     if (returnDefault && ((result && result->empty()) || (!result))) {
       OptionalIddField iddField = m_iddObject.getField(index);
@@ -387,7 +447,8 @@ namespace detail {
       
       m_fieldComments[index] = makeComment(cmnt);
 
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], m_fields[index]));
+      std::string value = m_fields[index].str();
+      m_diffs.push_back(IdfObjectDiff(index, value, value));
       
       return true;
     }
@@ -412,17 +473,17 @@ namespace detail {
       OS_ASSERT(i < 2u);
       if (n == 0 && i == 1) {
         OS_ASSERT(!m_handle.isNull());
-        m_fields.push_back(toString(m_handle));
-        m_diffs.push_back(IdfObjectDiff(0u,boost::none,m_fields.back()));
+        m_fields.push_back(fieldValue(toString(m_handle)));
+        m_diffs.push_back(IdfObjectDiff(0u,boost::none,m_fields.back().str()));
       }
       n = numFields();
       if (i < n) {
-        std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        std::string oldName = m_fields[i].str();
+        m_fields[i] = fieldValue(newName);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       } 
       else { 
-        m_fields.push_back(newName);
+        m_fields.push_back(fieldValue(newName));
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
       }
       return newName; // success!
@@ -481,7 +542,7 @@ namespace detail {
         }
       }
       else {
-        oldValue = m_fields[index];
+        oldValue = m_fields[index].str();
       }
 
       if (!result) {
@@ -499,7 +560,7 @@ namespace detail {
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields[index] = fieldValue(value);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -612,7 +673,7 @@ namespace detail {
     if (m_iddObject.isNonextensibleField(index) || 
         (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) 
     {
-      m_fields.push_back(value);
+      m_fields.push_back(fieldValue(value));
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
       return true;
     }
@@ -1442,7 +1503,7 @@ namespace detail {
           LOG(Warn, "IddObject type '" << objectType << "' not found in IddFactory. "
               << "Reverting to default Catchall object."); 
           OS_ASSERT(m_iddObject.name() == "Catchall");
-          m_fields.push_back(objectType);
+          m_fields.push_back(fieldValue(objectType));
           objectType = "Catchall";
         }
       }
@@ -1453,7 +1514,7 @@ namespace detail {
                 << m_iddObject.name() << "'. Reverting to default Catchall IddObject.");
           }
           m_iddObject = IddObject();
-          m_fields.push_back(objectType);
+          m_fields.push_back(fieldValue(objectType));
           objectType = "Catchall";
         }
       }
@@ -1538,7 +1599,7 @@ namespace detail {
       if (iddField) {
 
         // add this to our fields
-        m_fields.push_back(fieldText);
+        m_fields.push_back(fieldValue(fieldText));
 
         if (!commentOrOtherText.empty()) {
           // drop default comments
@@ -1743,20 +1804,20 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
       OptionalInt value = getInt(index);
       if (!value) {
         // ok if autosize or autocalculate
-        if (iddField.properties().autosizable && istringEqual(m_fields[index],"autosize")) {
+        if (iddField.properties().autosizable && istringEqual(m_fields[index].str(),"autosize")) {
         }
         else if (iddField.properties().autocalculatable && 
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(m_fields[index].str(),"autocalculate"))
         {
         }
         else if (iddField.properties().autosizable && 
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(m_fields[index].str(),"autocalculate"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type " 
               << m_iddObject.name() << " has 'autocalculate' as its value even though it is autosizable.");
         }
         else if (iddField.properties().autocalculatable && 
-                 istringEqual(m_fields[index],"autosize"))
+                 istringEqual(m_fields[index].str(),"autosize"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type " 
               << m_iddObject.name() << " has 'autosize' as its value even though it is autocalculable.");
@@ -1771,20 +1832,20 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
       OptionalDouble value = getDouble(index);
       if (!value) {
         // ok if autosize or autocalculate
-        if (iddField.properties().autosizable && istringEqual(m_fields[index],"autosize")) {
+        if (iddField.properties().autosizable && istringEqual(m_fields[index].str(),"autosize")) {
         }
         else if (iddField.properties().autocalculatable && 
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(m_fields[index].str(),"autocalculate"))
         {
         }
         else if (iddField.properties().autosizable && 
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(m_fields[index].str(),"autocalculate"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type " 
               << m_iddObject.name() << " has 'autocalculate' as its value even though it is autosizable.");
         }
         else if (iddField.properties().autocalculatable && 
-                 istringEqual(m_fields[index],"autosize"))
+                 istringEqual(m_fields[index].str(),"autosize"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type " 
               << m_iddObject.name() << " has 'autosize' as its value even though it is autocalculable.");
@@ -1798,7 +1859,7 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
     if ((fieldType == IddFieldType::ChoiceType) && (!m_fields[index].empty())) {
       // value should iequal one of the keys
       IddKeyVector keys = iddField.keys();
-      NameFinder<IddKey> finder(m_fields[index]);
+      NameFinder<IddKey> finder(m_fields[index].str());
       IddKeyVector::const_iterator loc = std::find_if(keys.begin(),keys.end(),finder);
       if (loc == keys.end()) {
         return false;
@@ -1950,7 +2011,12 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
 
   std::vector<std::string> IdfObject_Impl::fields() const
   {
-    return m_fields;
+    std::vector<std::string> result;
+    result.reserve(m_fields.size());
+    for (const IdfFieldValue& field : m_fields) {
+      result.push_back(field.str());
+    }
+    return result;
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const
@@ -1958,6 +2024,21 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
     return m_fieldComments;
   }
 
+  IdfFieldValue IdfObject_Impl::fieldValue(const std::string& value) const
+  {
+    return IdfFieldValue(value, m_stringPool.get());
+  }
+
+  void IdfObject_Impl::setStringPool(const std::shared_ptr<IdfStringPool>& stringPool)
+  {
+    m_stringPool = stringPool;
+    if (m_stringPool) {
+      for (IdfFieldValue& field : m_fields) {
+        field.intern(*m_stringPool);
+      }
+    }
+  }
+
 } // detail
 
 // CONSTRUCTORS
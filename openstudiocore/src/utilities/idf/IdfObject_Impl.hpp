@@ -22,6 +22,7 @@
 
 #include <utilities/UtilitiesAPI.hpp>
 #include <utilities/idf/Handle.hpp>
+#include <utilities/idf/IdfFieldValue.hpp>
 #include <utilities/idf/IdfObjectDiff.hpp>
 #include <utilities/idd/IddObject.hpp>
 
@@ -76,7 +77,28 @@ namespace detail {
                    const StringVector& fields,
                    const StringVector& fieldComments);
 
-    virtual ~IdfObject_Impl() {}
+    /** Constructor from underlying data, sharing field storage. Used by WorkspaceObject_Impl. */
+    IdfObject_Impl(const Handle& handle,
+                   const std::string& comment,
+                   const IddObject& iddObject,
+                   const std::vector<IdfFieldValue>& fields,
+                   const StringVector& fieldComments);
+
+    virtual ~IdfObject_Impl();
+
+    //@}
+    /** @name Instance Counts */
+    //@{
+
+    /** Returns the number of IdfObject_Impl, including derived objects, currently constructed. */
+    static unsigned numInstances();
+
+    /** Returns the largest numInstances() since the last call to resetPeakNumInstances. Lets tests
+     *  check that an operation does not copy whole collections of objects. */
+    static unsigned peakNumInstances();
+
+    /** Sets peakNumInstances() to numInstances(). */
+    static void resetPeakNumInstances();
 
     //@}
     /** @name Getters */
@@ -389,13 +411,16 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
+    // idf fields, see IdfFieldValue
+    std::vector<IdfFieldValue> m_fields;
     std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
 
+    // pool for long field text, null unless in a Workspace
+    std::shared_ptr<IdfStringPool> m_stringPool;
+
     // GETTER HELPERS
 
     std::vector<std::string> fields() const;
@@ -416,13 +441,24 @@ namespace detail {
     virtual bool fieldDataIsCorrectType(unsigned index) const;
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
+
+    // SETTER HELPERS
+
+    /** Returns the storage for value, using m_stringPool. */
+    IdfFieldValue fieldValue(const std::string& value) const;
+
+    /** Shares long field text through stringPool from now on, including existing fields. */
+    void setStringPool(const std::shared_ptr<IdfStringPool>& stringPool);
     
    private:
 
-    IdfObject_Impl(){}
+    IdfObject_Impl();
 
     // CONSTRUCTION HELPERS
 
+    // updates numInstances and peakNumInstances, called by every constructor
+    static void countInstance();
+
     /** Minimal constructor from iddObject for use by IdfObject_Impl::load. */
     IdfObject_Impl(const IddObject& iddObject, bool fastName, bool minimal);
 
@@ -0,0 +1,185 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+#include "../IdfFieldValue.hpp"
+#include "../IdfObject.hpp"
+#include "../Workspace.hpp"
+#include "../Workspace_Impl.hpp"
+#include "../WorkspaceObject.hpp"
+#include <utilities/idd/IddEnums.hxx>
+
+#include "../../core/UUID.hpp"
+#include "../../time/Time.hpp"
+
+#include <resources.hxx>
+
+#include <sstream>
+
+using namespace openstudio;
+using openstudio::detail::IdfFieldValue;
+using openstudio::detail::IdfStringPool;
+
+TEST_F(IdfFixture, IdfFieldValue_Storage)
+{
+  IdfStringPool pool;
+
+  IdfFieldValue empty("",&pool);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(0u, empty.size());
+  EXPECT_EQ("", empty.str());
+
+  IdfFieldValue autosize("Autosize",&pool);
+  EXPECT_FALSE(autosize.empty());
+  EXPECT_FALSE(autosize.isHandle());
+  EXPECT_EQ("Autosize", autosize.str());
+  EXPECT_EQ(8u, autosize.size());
+
+  Handle h = createUUID();
+  IdfFieldValue handle(toString(h),&pool);
+  EXPECT_TRUE(handle.isHandle());
+  EXPECT_TRUE(h == handle.handle());
+  EXPECT_EQ(toString(h), handle.str());
+  EXPECT_EQ(toString(h).size(), handle.size());
+
+  // text that would not print back identically stays text
+  std::string upperHandle = "{30D89CAE-E2D3-45B3-82F5-B12D6B94A227}";
+  IdfFieldValue notHandle(upperHandle,&pool);
+  EXPECT_FALSE(notHandle.isHandle());
+  EXPECT_EQ(upperHandle, notHandle.str());
+
+  std::string shortText(IdfFieldValue::inlineCapacity(),'a');
+  std::string longText = "Air Loop HVAC 1 Supply Outlet Node";
+  ASSERT_TRUE(longText.size() > IdfFieldValue::inlineCapacity());
+  unsigned n = pool.size();
+  IdfFieldValue shortValue(shortText,&pool);
+  EXPECT_EQ(n, pool.size());
+  IdfFieldValue longValue(longText,&pool);
+  IdfFieldValue longValue2(longText,&pool);
+  EXPECT_EQ(n + 1, pool.size());
+  EXPECT_EQ(shortText, shortValue.str());
+  EXPECT_EQ(longText, longValue.str());
+  EXPECT_EQ(longText, longValue2.str());
+
+  // copies and printing
+  IdfFieldValue copy(longValue);
+  EXPECT_EQ(longText, copy.str());
+  copy = handle;
+  EXPECT_TRUE(copy.isHandle());
+  std::stringstream ss;
+  ss << copy << "," << longValue;
+  EXPECT_EQ(toString(h) + "," + longText, ss.str());
+
+  // without a pool, long text is not shared
+  IdfFieldValue unpooled(longText,nullptr);
+  EXPECT_EQ(longText, unpooled.str());
+  EXPECT_EQ(n + 1, pool.size());
+  unpooled.intern(pool);
+  EXPECT_EQ(n + 1, pool.size());
+  EXPECT_EQ(longText, unpooled.str());
+}
+
+TEST_F(IdfFixture, IdfFieldValue_FieldText)
+{
+  // getString and setString are unchanged by the storage
+  IdfObject object(IddObjectType::OS_Node);
+  ASSERT_TRUE(object.getString(0));
+  EXPECT_EQ(toString(object.handle()), object.getString(0).get());
+
+  std::string longName = "A node name that is too long to be stored inline";
+  EXPECT_TRUE(object.setName(longName));
+  EXPECT_EQ(longName, object.name().get());
+  EXPECT_TRUE(object.setString(1,""));
+  EXPECT_EQ("", object.getString(1).get());
+
+  std::stringstream ss;
+  ss << object;
+  OptionalIdfObject parsed = IdfObject::load(ss.str());
+  ASSERT_TRUE(parsed);
+  EXPECT_TRUE(parsed->handle() == object.handle());
+  EXPECT_EQ(object.getString(0).get(), parsed->getString(0).get());
+}
+
+TEST_F(IdfFixture, IdfFieldValue_WorkspacePool)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  std::shared_ptr<detail::IdfStringPool> pool = workspace.getImpl<detail::Workspace_Impl>()->stringPool();
+  ASSERT_TRUE(pool);
+
+  // node names and other long tokens repeat, so there are fewer pooled strings than long values
+  unsigned numLongValues = 0;
+  for (const WorkspaceObject& object : workspace.objects()) {
+    IdfObject idfObject = object.idfObject();
+    for (unsigned i = 0, n = idfObject.numFields(); i < n; ++i) {
+      std::string field = idfObject.getString(i).get();
+      if (field.size() > IdfFieldValue::inlineCapacity()) {
+        ++numLongValues;
+      }
+    }
+  }
+  EXPECT_TRUE(pool->size() > 0);
+  EXPECT_TRUE(pool->size() < numLongValues);
+
+  // clones get their own pool
+  Workspace clone = workspace.clone();
+  EXPECT_TRUE(clone.getImpl<detail::Workspace_Impl>()->stringPool() != pool);
+  EXPECT_EQ(workspace.numObjects(), clone.numObjects());
+}
+
+TEST_F(IdfFixture, IdfFieldValue_MemoryBenchmark)
+{
+  openstudio::path p = resourcesPath()/toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/tests/EnvelopeAndLoadTestModel_01.osm");
+  OptionalIdfFile idfFile = IdfFile::load(p,IddFileType::OpenStudio);
+  ASSERT_TRUE(idfFile);
+
+  openstudio::Time start = openstudio::Time::currentTime();
+  Workspace workspace(*idfFile,StrictnessLevel::None);
+  openstudio::Time loadTime = openstudio::Time::currentTime() - start;
+  std::shared_ptr<detail::IdfStringPool> pool = workspace.getImpl<detail::Workspace_Impl>()->stringPool();
+
+  // estimate field storage as std::strings (with 15 character small string optimization) and
+  // as IdfFieldValues plus the pool
+  std::size_t numFields = 0;
+  std::size_t numHandles = 0;
+  std::size_t stringBytes = 0;
+  for (const WorkspaceObject& object : workspace.objects()) {
+    IdfObject idfObject = object.idfObject();
+    for (unsigned i = 0, n = idfObject.numFields(); i < n; ++i) {
+      std::string field = idfObject.getString(i).get();
+      ++numFields;
+      stringBytes += sizeof(std::string);
+      if (field.size() > 15) {
+        stringBytes += field.size() + 1;
+      }
+      if (toUUID(field) != Handle()) {
+        ++numHandles;
+      }
+    }
+  }
+  std::size_t pooledStringBytes = sizeof(std::string) + 2 * sizeof(void*) + 1;
+  std::size_t fieldValueBytes = numFields * sizeof(IdfFieldValue) + pool->size() * pooledStringBytes + pool->numChars();
+
+  LOG(Info,"EnvelopeAndLoadTestModel_01.osm has " << workspace.numObjects() << " objects, " << numFields
+      << " fields, " << numHandles << " of which are handles, and " << pool->size() << " distinct long "
+      << "strings. Field storage is about " << fieldValueBytes << " bytes, compared to "
+      << stringBytes << " bytes as std::strings. Workspace constructed in " << loadTime << " s.");
+  EXPECT_TRUE(numHandles > 0);
+  EXPECT_TRUE(fieldValueBytes < stringBytes);
+}
@@ -30,6 +30,10 @@
 
 #include <boost/filesystem/fstream.hpp>
 
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -152,3 +156,66 @@ TEST_F(IdfFixture, IdfFile_ObjectComments) {
   ASSERT_TRUE(outFile?true:false);
   oFile->print(outFile);
 }
+
+namespace {
+
+  std::string loadAndPrint(const openstudio::path& p, int numThreads) {
+    int maxThreadCount = QThreadPool::globalInstance()->maxThreadCount();
+    QThreadPool::globalInstance()->setMaxThreadCount(numThreads);
+    OptionalIdfFile oFile = IdfFile::load(p);
+    QThreadPool::globalInstance()->setMaxThreadCount(maxThreadCount);
+    std::stringstream ss;
+    if (oFile) {
+      oFile->print(ss);
+    }
+    return ss.str();
+  }
+
+}
+
+TEST_F(IdfFixture, IdfFile_ParallelLoad) {
+  // objects constructed on several threads are the same, and in the same order, as those
+  // constructed one at a time. the osm also checks that handles are kept.
+  std::vector<openstudio::path> paths;
+  paths.push_back(resourcesPath()/toPath("energyplus/5ZoneAirCooled/in.idf"));
+  paths.push_back(resourcesPath()/toPath("utilities/Idf/CommentTest.idf"));
+  paths.push_back(resourcesPath()/toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/tests/EnvelopeAndLoadTestModel_01.osm"));
+  for (const openstudio::path& p : paths) {
+    std::string serial = loadAndPrint(p,1);
+    EXPECT_FALSE(serial.empty());
+    EXPECT_EQ(serial,loadAndPrint(p,4));
+  }
+}
+
+TEST_F(IdfFixture, IdfFile_ParallelLoad_ThreadCounts) {
+  // a large file splits into many batches; every pool size up to the ideal thread count
+  // gives the same objects as a serial load
+  openstudio::path p = resourcesPath()/toPath("energyplus/HospitalBaseline/in.idf");
+  int idealThreadCount = std::max(QThread::idealThreadCount(),1);
+
+  std::string serial = loadAndPrint(p,1);
+  EXPECT_FALSE(serial.empty());
+  for (int numThreads = 2; numThreads < 2*idealThreadCount; numThreads *= 2) {
+    EXPECT_EQ(serial,loadAndPrint(p,std::min(numThreads,idealThreadCount)));
+  }
+}
+
+TEST_F(IdfFixture, IdfFile_ParallelLoad_Scaling) {
+  // logs HospitalBaseline load times from 1 thread up to the ideal thread count, asserts nothing
+  // about them
+  openstudio::path p = resourcesPath()/toPath("energyplus/HospitalBaseline/in.idf");
+  int maxThreadCount = QThreadPool::globalInstance()->maxThreadCount();
+  int idealThreadCount = std::max(QThread::idealThreadCount(),1);
+
+  std::stringstream timings;
+  for (int numThreads = 1; numThreads <= idealThreadCount; ++numThreads) {
+    QThreadPool::globalInstance()->setMaxThreadCount(numThreads);
+    openstudio::Time start = openstudio::Time::currentTime();
+    OptionalIdfFile oFile = IdfFile::load(p);
+    openstudio::Time loadTime = openstudio::Time::currentTime() - start;
+    timings << " " << numThreads << " thread(s): " << loadTime << " s;";
+  }
+  QThreadPool::globalInstance()->setMaxThreadCount(maxThreadCount);
+
+  LOG(Info,"Loaded HospitalBaseline with" << timings.str());
+}
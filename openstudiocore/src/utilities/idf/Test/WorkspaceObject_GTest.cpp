@@ -480,3 +480,58 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources)
   sourcesVector = node->getSources(IddObjectType::OS_SetpointManager_MixedAir);
   EXPECT_EQ(1, sourcesVector.size());
 }
+
+TEST_F(IdfFixture, WorkspaceObject_Sources_AfterPointerChanges)
+{
+  Workspace ws;
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  OptionalWorkspaceObject spm2 = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  ASSERT_TRUE(node && node2 && spm && spm2);
+
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+  EXPECT_TRUE(spm2->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+  EXPECT_EQ(2u, node->sources().size());
+  EXPECT_EQ(2u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_Node).empty());
+  OptionalWorkspaceObject target = spm->getTarget(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName);
+  ASSERT_TRUE(target);
+  EXPECT_TRUE(*target == *node);
+
+  // repointing moves the source to the new target
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node2->handle()));
+  ASSERT_EQ(1u, node->sources().size());
+  EXPECT_TRUE(node->sources()[0] == *spm2);
+  ASSERT_EQ(1u, node2->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_TRUE(node2->getSources(IddObjectType::OS_SetpointManager_MixedAir)[0] == *spm);
+  target = spm->getTarget(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName);
+  ASSERT_TRUE(target);
+  EXPECT_TRUE(*target == *node2);
+
+  // clones resolve their own objects, with or without new handles
+  Workspace clone = ws.clone();
+  Workspace cloneKeep = ws.clone(true);
+  OptionalWorkspaceObject keptNode = cloneKeep.getObject(node->handle());
+  ASSERT_TRUE(keptNode);
+  WorkspaceObjectVector keptSources = keptNode->getSources(IddObjectType::OS_SetpointManager_MixedAir);
+  ASSERT_EQ(1u, keptSources.size());
+  EXPECT_TRUE(keptSources[0].handle() == spm2->handle());
+  EXPECT_FALSE(keptSources[0] == *spm2);
+  unsigned nSources = 0;
+  for (const WorkspaceObject& cloneNode : clone.getObjectsByType(IddObjectType::OS_Node)){
+    for (const WorkspaceObject& source : cloneNode.sources()){
+      EXPECT_TRUE(clone.getObject(source.handle()));
+      EXPECT_FALSE(ws.getObject(source.handle()));
+      ++nSources;
+    }
+  }
+  EXPECT_EQ(2u, nSources);
+
+  // removing a source clears it from the target
+  spm2->remove();
+  EXPECT_TRUE(node->sources().empty());
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_SetpointManager_MixedAir).empty());
+  EXPECT_EQ(1u, node2->sources().size());
+  EXPECT_EQ(1u, keptNode->sources().size());
+}
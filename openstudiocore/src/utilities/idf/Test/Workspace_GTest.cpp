@@ -25,6 +25,7 @@
 #include "../Workspace_Impl.hpp"
 #include "../WorkspaceObject.hpp"
 #include "../WorkspaceObjectOrder.hpp"
+#include "../IdfObject_Impl.hpp"
 #include "../URLSearchPath.hpp"
 #include "../ValidityReport.hpp"
 #include "../IdfExtensibleGroup.hpp"
@@ -45,6 +46,7 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
+#include <utilities/idd/OS_SetpointManager_MixedAir_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
@@ -64,7 +66,10 @@
 
 using namespace openstudio;
 
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <sstream>
 
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor)
 {
@@ -530,6 +535,46 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_Clone_KeepHandles) {
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  Workspace clone = workspace.clone(true);
+  EXPECT_EQ(workspace.numObjects(),clone.numObjects());
+
+  // every pointer is resolved to the clone's own object when the clone is created, so targets
+  // and sources are not looked up by handle on each use
+  unsigned numTargets = 0;
+  for (const WorkspaceObject& object : clone.objects()) {
+    EXPECT_TRUE(workspace.getObject(object.handle()));
+    EXPECT_EQ(0u,object.getImpl<detail::WorkspaceObject_Impl>()->numUnresolvedPointers());
+    for (const WorkspaceObject& target : object.targets()) {
+      OptionalWorkspaceObject cloneTarget = clone.getObject(target.handle());
+      ASSERT_TRUE(cloneTarget);
+      EXPECT_TRUE(target == *cloneTarget);
+      ++numTargets;
+    }
+  }
+  EXPECT_TRUE(numTargets > 0);
+
+  WorkspaceObjectVector zones = clone.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(zones.empty());
+  WorkspaceObjectVector surfaces = zones[0].getSources(IddObjectType::BuildingSurface_Detailed);
+  ASSERT_FALSE(surfaces.empty());
+  for (const WorkspaceObject& surface : surfaces) {
+    OptionalWorkspaceObject originalSurface = workspace.getObject(surface.handle());
+    ASSERT_TRUE(originalSurface);
+    EXPECT_FALSE(surface == *originalSurface);
+    OptionalWorkspaceObject zone = surface.getTarget(BuildingSurface_DetailedFields::ZoneName);
+    ASSERT_TRUE(zone);
+    EXPECT_TRUE(*zone == zones[0]);
+  }
+
+  // clones with new handles are resolved as well
+  Workspace newHandlesClone = workspace.clone();
+  for (const WorkspaceObject& object : newHandlesClone.objects()) {
+    EXPECT_EQ(0u,object.getImpl<detail::WorkspaceObject_Impl>()->numUnresolvedPointers());
+  }
+}
+
 TEST_F(IdfFixture,Workspace_Insert) {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -2094,3 +2139,342 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID)
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", true).size());
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
+
+void expectBinaryRoundtripEqual(const Workspace& original, const Workspace& loaded) {
+  EXPECT_TRUE(original.iddFileType() == loaded.iddFileType());
+  ASSERT_EQ(original.numObjects(), loaded.numObjects());
+  for (const WorkspaceObject& object : original.objects()) {
+    OptionalWorkspaceObject loadedObject = loaded.getObject(object.handle());
+    ASSERT_TRUE(loadedObject);
+    EXPECT_TRUE(object.iddObject().type() == loadedObject->iddObject().type());
+    EXPECT_EQ(object.comment(), loadedObject->comment());
+    ASSERT_EQ(object.numFields(), loadedObject->numFields());
+    for (unsigned i = 0, n = object.numFields(); i < n; ++i) {
+      EXPECT_EQ(object.getString(i), loadedObject->getString(i));
+      EXPECT_EQ(object.fieldComment(i), loadedObject->fieldComment(i));
+      OptionalWorkspaceObject target = object.getTarget(i);
+      OptionalWorkspaceObject loadedTarget = loadedObject->getTarget(i);
+      ASSERT_EQ(static_cast<bool>(target), static_cast<bool>(loadedTarget));
+      if (target) {
+        EXPECT_TRUE(target->handle() == loadedTarget->handle());
+      }
+    }
+  }
+}
+
+TEST_F(IdfFixture, Workspace_BinaryRoundtrip_EnergyPlus)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  ASSERT_TRUE(workspace.numObjects() > 0);
+
+  // "30." is not what setDouble would write, so it has to come back as text
+  WorkspaceObjectVector buildings = workspace.getObjectsByType(IddObjectType::Building);
+  ASSERT_EQ(1u, buildings.size());
+  EXPECT_EQ("30.", buildings[0].getString(BuildingFields::NorthAxis).get());
+  WorkspaceObjectVector zones = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(zones.empty());
+  EXPECT_TRUE(zones[0].setDouble(ZoneFields::XOrigin,-1.0/3.0));
+  EXPECT_TRUE(zones[0].setComment("! binary roundtrip"));
+  // text in handle format is stored as a handle, and written with the handle tag
+  std::string handleName = toString(createUUID());
+  ASSERT_TRUE(zones[0].setName(handleName));
+
+  std::stringstream ss(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+  ASSERT_TRUE(workspace.saveBinary(ss));
+  OptionalWorkspace loaded = Workspace::loadBinary(ss);
+  ASSERT_TRUE(loaded);
+  expectBinaryRoundtripEqual(workspace,*loaded);
+
+  OptionalWorkspaceObject loadedBuilding = loaded->getObject(buildings[0].handle());
+  ASSERT_TRUE(loadedBuilding);
+  EXPECT_EQ("30.", loadedBuilding->getString(BuildingFields::NorthAxis).get());
+  OptionalWorkspaceObject loadedZone = loaded->getObject(zones[0].handle());
+  ASSERT_TRUE(loadedZone);
+  EXPECT_EQ(zones[0].getDouble(ZoneFields::XOrigin).get(), loadedZone->getDouble(ZoneFields::XOrigin).get());
+  EXPECT_EQ(zones[0].getString(ZoneFields::XOrigin).get(), loadedZone->getString(ZoneFields::XOrigin).get());
+  EXPECT_EQ(handleName, loadedZone->name().get());
+}
+
+TEST_F(IdfFixture, Workspace_BinaryRoundtrip_OpenStudio)
+{
+  Workspace workspace;
+  OptionalWorkspaceObject node = workspace.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = workspace.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = workspace.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  ASSERT_TRUE(node && node2 && spm);
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName,node->handle()));
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName,node2->handle()));
+  EXPECT_TRUE(node2->setName("Shared Name"));
+  EXPECT_TRUE(spm->setName("Shared Name"));
+
+  openstudio::path p = outDir/toPath("binaryRoundtrip.osb");
+  ASSERT_TRUE(workspace.saveBinary(p,true));
+  EXPECT_FALSE(workspace.saveBinary(p,false));
+  OptionalWorkspace loaded = Workspace::loadBinary(p);
+  ASSERT_TRUE(loaded);
+  expectBinaryRoundtripEqual(workspace,*loaded);
+  EXPECT_TRUE(loaded->versionObject());
+
+  OptionalWorkspaceObject loadedNode = loaded->getObject(node->handle());
+  ASSERT_TRUE(loadedNode);
+  WorkspaceObjectVector sources = loadedNode->getSources(IddObjectType::OS_SetpointManager_MixedAir);
+  ASSERT_EQ(1u, sources.size());
+  EXPECT_TRUE(sources[0].handle() == spm->handle());
+}
+
+TEST_F(IdfFixture, Workspace_Binary_InvalidInput)
+{
+  // text is not binary
+  std::stringstream text;
+  text << Workspace().toIdfFile();
+  EXPECT_FALSE(Workspace::loadBinary(text));
+
+  // truncated
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  std::stringstream ss(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+  ASSERT_TRUE(workspace.saveBinary(ss));
+  std::string data = ss.str();
+  std::stringstream truncated(data.substr(0,data.size()/2),std::ios_base::in | std::ios_base::binary);
+  EXPECT_FALSE(Workspace::loadBinary(truncated));
+
+  // different format version
+  data[8] = 99;
+  std::stringstream futureVersion(data,std::ios_base::in | std::ios_base::binary);
+  EXPECT_FALSE(Workspace::loadBinary(futureVersion));
+
+  EXPECT_FALSE(Workspace::loadBinary(outDir/toPath("doesNotExist.osb")));
+}
+
+TEST_F(IdfFixture, Workspace_Binary_MatchesText)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  openstudio::path textPath = outDir/toPath("binaryMatchesText.idf");
+  openstudio::path binaryPath = outDir/toPath("binaryMatchesText.osb");
+  ASSERT_TRUE(workspace.save(textPath,true));
+  ASSERT_TRUE(workspace.saveBinary(binaryPath,true));
+
+  // repeated strings are stored once
+  EXPECT_LT(boost::filesystem::file_size(binaryPath), boost::filesystem::file_size(textPath));
+
+  OptionalWorkspace textLoaded = Workspace::load(textPath);
+  ASSERT_TRUE(textLoaded);
+  OptionalWorkspace binaryLoaded = Workspace::loadBinary(binaryPath);
+  ASSERT_TRUE(binaryLoaded);
+  EXPECT_EQ(textLoaded->numObjects(), binaryLoaded->numObjects());
+  expectBinaryRoundtripEqual(workspace,*binaryLoaded);
+}
+
+TEST_F(IdfFixture, Workspace_StreamingSaveAndLoad)
+{
+  // printing directly matches printing the equivalent IdfFile
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  std::stringstream streamed;
+  streamed << workspace;
+  std::stringstream viaIdfFile;
+  workspace.toIdfFile().print(viaIdfFile);
+  EXPECT_EQ(viaIdfFile.str(), streamed.str());
+
+  // loading directly matches loading an IdfFile first
+  openstudio::path p = outDir/toPath("streamingRoundtrip.idf");
+  ASSERT_TRUE(workspace.save(p,true));
+  EXPECT_FALSE(workspace.save(p,false));
+  OptionalWorkspace loaded = Workspace::load(p);
+  ASSERT_TRUE(loaded);
+  OptionalIdfFile idfFile = IdfFile::load(p);
+  ASSERT_TRUE(idfFile);
+  Workspace viaIdfFileLoaded(*idfFile);
+  EXPECT_EQ(viaIdfFileLoaded.numObjects(), loaded->numObjects());
+  EXPECT_EQ(workspace.numObjects(), loaded->numObjects());
+  EXPECT_TRUE(loaded->versionObject());
+  std::stringstream loadedText;
+  loadedText << *loaded;
+  std::stringstream viaIdfFileLoadedText;
+  viaIdfFileLoadedText << viaIdfFileLoaded;
+  EXPECT_EQ(viaIdfFileLoadedText.str(), loadedText.str());
+
+  // handles and pointers survive when the IDD has handle fields
+  Workspace osWorkspace;
+  OptionalWorkspaceObject node = osWorkspace.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = osWorkspace.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  ASSERT_TRUE(node && spm);
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName,node->handle()));
+  openstudio::path osPath = outDir/toPath("streamingRoundtrip.osm");
+  ASSERT_TRUE(osWorkspace.save(osPath,true));
+  loaded = Workspace::load(osPath);
+  ASSERT_TRUE(loaded);
+  expectBinaryRoundtripEqual(osWorkspace,*loaded);
+
+  // missing version object is added, as with IdfFile::load
+  openstudio::path noVersionPath = outDir/toPath("streamingNoVersion.idf");
+  {
+    boost::filesystem::ofstream outFile(noVersionPath);
+    ASSERT_TRUE(outFile);
+    outFile << "Zone," << std::endl << "  Zone 1;" << std::endl;
+  }
+  loaded = Workspace::load(noVersionPath);
+  ASSERT_TRUE(loaded);
+  EXPECT_TRUE(loaded->versionObject());
+  EXPECT_EQ(1u, loaded->getObjectsByType(IddObjectType::Zone).size());
+
+  EXPECT_FALSE(Workspace::load(outDir/toPath("doesNotExist.idf")));
+}
+
+TEST_F(IdfFixture, Workspace_Streaming_PeakObjects)
+{
+  // more objects than IdfFile::parse constructs in one batch
+  Workspace workspace(StrictnessLevel::Draft,IddFileType::EnergyPlus);
+  IdfObjectVector zones;
+  for (unsigned i = 0; i < 10000; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    EXPECT_TRUE(zone.setName("Zone " + std::to_string(i)));
+    zones.push_back(zone);
+  }
+  EXPECT_EQ(10000u, workspace.addObjects(zones).size());
+  zones.clear();
+  unsigned numObjects = workspace.numObjects();
+  openstudio::path p = outDir/toPath("streamingPeakObjects.idf");
+
+  // saving through an IdfFile copies every object, streaming copies one at a time
+  unsigned before = detail::IdfObject_Impl::numInstances();
+  detail::IdfObject_Impl::resetPeakNumInstances();
+  ASSERT_TRUE(workspace.toIdfFile().save(p,true));
+  unsigned idfFileSavePeak = detail::IdfObject_Impl::peakNumInstances() - before;
+
+  before = detail::IdfObject_Impl::numInstances();
+  detail::IdfObject_Impl::resetPeakNumInstances();
+  ASSERT_TRUE(workspace.save(p,true));
+  unsigned streamingSavePeak = detail::IdfObject_Impl::peakNumInstances() - before;
+
+  EXPECT_LE(numObjects, idfFileSavePeak);
+  EXPECT_GE(10u, streamingSavePeak);
+
+  // loading through an IdfFile holds every object twice, streaming at most one batch extra
+  before = detail::IdfObject_Impl::numInstances();
+  detail::IdfObject_Impl::resetPeakNumInstances();
+  {
+    OptionalIdfFile idfFile = IdfFile::load(p);
+    ASSERT_TRUE(idfFile);
+    Workspace viaIdfFile(*idfFile);
+    EXPECT_EQ(numObjects, viaIdfFile.numObjects());
+  }
+  unsigned idfFileLoadPeak = detail::IdfObject_Impl::peakNumInstances() - before;
+
+  before = detail::IdfObject_Impl::numInstances();
+  detail::IdfObject_Impl::resetPeakNumInstances();
+  {
+    OptionalWorkspace loaded = Workspace::load(p);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(numObjects, loaded->numObjects());
+  }
+  unsigned streamingLoadPeak = detail::IdfObject_Impl::peakNumInstances() - before;
+
+  EXPECT_LE(2 * numObjects, idfFileLoadPeak);
+  EXPECT_LT(streamingLoadPeak, idfFileLoadPeak);
+
+  LOG(Info,"Peak IdfObject_Impl instances for " << numObjects << " objects. Save through an IdfFile: "
+      << idfFileSavePeak << ", streamed: " << streamingSavePeak << ". Load through an IdfFile: "
+      << idfFileLoadPeak << ", streamed: " << streamingLoadPeak << ".");
+}
+
+TEST_F(IdfFixture, Workspace_BulkFieldAccess)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  IddObjectType zoneType(IddObjectType::Zone);
+
+  // getters line up with getHandlesByType and agree with the per-object getters
+  HandleVector handles = workspace.getHandlesByType(zoneType);
+  ASSERT_TRUE(handles.size() > 1u);
+  StringVector names = workspace.getStringColumn(zoneType,ZoneFields::Name);
+  DoubleVector xOrigins = workspace.getDoubleColumn(zoneType,ZoneFields::XOrigin);
+  DoubleVector multipliers = workspace.getDoubleColumn(zoneType,ZoneFields::Multiplier,true);
+  ASSERT_EQ(handles.size(), names.size());
+  ASSERT_EQ(handles.size(), xOrigins.size());
+  ASSERT_EQ(handles.size(), multipliers.size());
+  for (unsigned i = 0, n = handles.size(); i < n; ++i) {
+    OptionalWorkspaceObject zone = workspace.getObject(handles[i]);
+    ASSERT_TRUE(zone);
+    EXPECT_EQ(zone->getString(ZoneFields::Name).get(), names[i]);
+    OptionalDouble xOrigin = zone->getDouble(ZoneFields::XOrigin);
+    if (xOrigin) {
+      EXPECT_DOUBLE_EQ(*xOrigin, xOrigins[i]);
+    }
+    else {
+      EXPECT_TRUE(std::isnan(xOrigins[i]));
+    }
+    EXPECT_DOUBLE_EQ(zone->getDouble(ZoneFields::Multiplier,true).get(), multipliers[i]);
+  }
+  EXPECT_TRUE(workspace.getHandlesByType(IddObjectType::OS_Node).empty());
+  EXPECT_TRUE(workspace.getDoubleColumn(IddObjectType::OS_Node,0).empty());
+
+  // NaN leaves a field alone
+  DoubleVector newXOrigins(handles.size(),12.5);
+  newXOrigins[0] = std::numeric_limits<double>::quiet_NaN();
+  std::string firstXOrigin = workspace.getObject(handles[0])->getString(ZoneFields::XOrigin).get();
+  EXPECT_TRUE(workspace.setDoubleColumn(zoneType,ZoneFields::XOrigin,newXOrigins));
+  EXPECT_EQ(firstXOrigin, workspace.getObject(handles[0])->getString(ZoneFields::XOrigin).get());
+  EXPECT_DOUBLE_EQ(12.5, workspace.getObject(handles[1])->getDouble(ZoneFields::XOrigin).get());
+
+  // wrong number of values sets nothing
+  EXPECT_FALSE(workspace.setDoubleColumn(zoneType,ZoneFields::XOrigin,DoubleVector(handles.size() + 1,0.0)));
+  EXPECT_DOUBLE_EQ(12.5, workspace.getObject(handles[1])->getDouble(ZoneFields::XOrigin).get());
+
+  // rejected values are skipped, the rest are set
+  StringVector newMultipliers(handles.size(),"2");
+  newMultipliers[0] = "not a number";
+  EXPECT_FALSE(workspace.setStringColumn(zoneType,ZoneFields::Multiplier,newMultipliers));
+  EXPECT_DOUBLE_EQ(2.0, workspace.getObject(handles[1])->getDouble(ZoneFields::Multiplier).get());
+
+  names[1] = "Renamed Zone";
+  EXPECT_TRUE(workspace.setStringColumn(zoneType,ZoneFields::Name,names));
+  EXPECT_EQ("Renamed Zone", workspace.getObject(handles[1])->name().get());
+
+  // pointers
+  IddObjectType lightsType(IddObjectType::Lights);
+  HandleVector lights = workspace.getHandlesByType(lightsType);
+  HandleVector lightsZones = workspace.getPointerColumn(lightsType,LightsFields::ZoneorZoneListName);
+  ASSERT_FALSE(lights.empty());
+  ASSERT_EQ(lights.size(), lightsZones.size());
+  for (unsigned i = 0, n = lights.size(); i < n; ++i) {
+    OptionalWorkspaceObject zone = workspace.getObject(lights[i])->getTarget(LightsFields::ZoneorZoneListName);
+    ASSERT_TRUE(zone);
+    EXPECT_TRUE(zone->handle() == lightsZones[i]);
+  }
+  EXPECT_TRUE(workspace.setPointerColumn(lightsType,LightsFields::ZoneorZoneListName,HandleVector(lights.size(),handles[1])));
+  for (const Handle& h : workspace.getPointerColumn(lightsType,LightsFields::ZoneorZoneListName)) {
+    EXPECT_TRUE(h == handles[1]);
+  }
+  EXPECT_EQ(lights.size(), workspace.getObject(handles[1])->getSources(lightsType).size());
+}
+
+TEST_F(IdfFixture, Workspace_BulkFieldAccess_Performance)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::Draft);
+  IddObjectType surfaceType(IddObjectType::BuildingSurface_Detailed);
+  unsigned n = 200;
+
+  openstudio::Time start = openstudio::Time::currentTime();
+  double perObjectSum = 0.0;
+  for (unsigned i = 0; i < n; ++i) {
+    for (const WorkspaceObject& surface : workspace.getObjectsByType(surfaceType)) {
+      if (OptionalDouble value = surface.getDouble(BuildingSurface_DetailedFields::ViewFactortoGround)) {
+        perObjectSum += *value;
+      }
+    }
+  }
+  openstudio::Time perObjectTime = openstudio::Time::currentTime() - start;
+
+  start = openstudio::Time::currentTime();
+  double columnSum = 0.0;
+  for (unsigned i = 0; i < n; ++i) {
+    for (double value : workspace.getDoubleColumn(surfaceType,BuildingSurface_DetailedFields::ViewFactortoGround)) {
+      if (!std::isnan(value)) {
+        columnSum += value;
+      }
+    }
+  }
+  openstudio::Time columnTime = openstudio::Time::currentTime() - start;
+
+  EXPECT_DOUBLE_EQ(perObjectSum, columnSum);
+  LOG(Info,"Read the surface view factor to ground " << n << " times, per object in " << perObjectTime
+      << " s, as a column in " << columnTime << " s.");
+}
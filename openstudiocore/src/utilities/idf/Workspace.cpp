@@ -28,6 +28,8 @@
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
+#include "../idd/Comments.hpp"
+
 #include "../plot/ProgressBar.hpp"
 
 #include "../core/Assert.hpp"
@@ -35,12 +37,24 @@
 #include "../core/URLHelpers.hpp"
 #include "../core/Compare.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/PathHelpers.hpp"
+#include "../core/String.hpp"
 
 #include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <QByteArray>
 
+#include <algorithm>
 #include <sstream>
+#include <cerrno>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <deque>
 #include <map>
@@ -51,6 +65,205 @@ using openstudio::istringEqual; // used for all name comparisons
 
 namespace openstudio {
 
+namespace {
+
+  // Binary Workspace format, see Workspace::saveBinary. All integers are little-endian.
+  //
+  //   preamble:  magic, format version, IddFileType name, IDD version
+  //   strings:   count, then each string
+  //   header:    string index
+  //   types:     count, then the string index of each IddObjectType name
+  //   objects:   count, then for each object its type index, handle, comment string index,
+  //              field count, tagged fields, field comment count, and field comment string indices;
+  //              the handle field of objects that have one is not repeated in the tagged fields
+
+  const char binaryWorkspaceMagic[8] = { 'O', 'S', 'W', 'B', 'I', 'N', '\r', '\n' };
+
+  const unsigned binaryWorkspaceFormatVersion = 1;
+
+  enum BinaryFieldTag {
+    BinaryEmptyField = 0,
+    BinaryStringField = 1,
+    BinaryHandleField = 2,
+    BinaryRealField = 3,
+    BinaryIntegerField = 4
+  };
+
+  void writeBinaryUnsigned(std::ostream& os, std::uint64_t value, unsigned numBytes) {
+    char bytes[8];
+    for (unsigned i = 0; i < numBytes; ++i) {
+      bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    os.write(bytes, numBytes);
+  }
+
+  void writeBinaryUInt32(std::ostream& os, unsigned value) {
+    writeBinaryUnsigned(os, value, 4);
+  }
+
+  void writeBinaryString(std::ostream& os, const std::string& value) {
+    writeBinaryUInt32(os, value.size());
+    os.write(value.data(), value.size());
+  }
+
+  void writeBinaryHandle(std::ostream& os, const Handle& handle) {
+    QByteArray bytes = handle.toRfc4122();
+    OS_ASSERT(bytes.size() == 16);
+    os.write(bytes.constData(), bytes.size());
+  }
+
+  void writeBinaryDouble(std::ostream& os, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeBinaryUnsigned(os, bits, 8);
+  }
+
+  /** Interns strings for the string table. Each distinct string is written once. */
+  class BinaryStringTable {
+   public:
+    unsigned index(const std::string& value) {
+      std::pair<std::map<std::string,unsigned>::iterator,bool> insertResult =
+          m_indices.insert(std::make_pair(value, static_cast<unsigned>(m_strings.size())));
+      if (insertResult.second) {
+        m_strings.push_back(&(insertResult.first->first));
+      }
+      return insertResult.first->second;
+    }
+
+    void write(std::ostream& os) const {
+      writeBinaryUInt32(os, m_strings.size());
+      for (const std::string* value : m_strings) {
+        writeBinaryString(os, *value);
+      }
+    }
+
+   private:
+    std::map<std::string,unsigned> m_indices;
+    std::vector<const std::string*> m_strings; // keys of m_indices, in index order
+  };
+
+  /** Returns true if value is the text written by setDouble, in which case it is stored as a
+   *  double without changing the field's text. */
+  bool isExactReal(const std::string& value, double& result) {
+    char* end = nullptr;
+    result = std::strtod(value.c_str(), &end);
+    return (end == value.c_str() + value.size()) && (openstudio::toString(result) == value);
+  }
+
+  bool isExactInteger(const std::string& value, long long& result) {
+    char* end = nullptr;
+    errno = 0;
+    result = std::strtoll(value.c_str(), &end, 10);
+    return (errno == 0) && (end == value.c_str() + value.size()) &&
+           (boost::lexical_cast<std::string>(result) == value);
+  }
+
+  /** Reads the binary Workspace format. Once a read fails, ok() is false and all later reads
+   *  return empty values. Counts and lengths are checked against the bytes remaining in seekable
+   *  streams, so a corrupt file cannot request huge allocations. */
+  class BinaryReader {
+   public:
+    explicit BinaryReader(std::istream& is)
+      : m_is(is), m_ok(true), m_remaining(-1)
+    {
+      std::istream::pos_type start = m_is.tellg();
+      if (start != std::istream::pos_type(-1)) {
+        m_is.seekg(0, std::ios::end);
+        m_remaining = m_is.tellg() - start;
+        m_is.seekg(start);
+      }
+      m_ok = m_is.good();
+    }
+
+    bool ok() const { return m_ok; }
+
+    bool readBytes(char* bytes, unsigned numBytes) {
+      if (!checkCount(numBytes, 1)) { return false; }
+      m_is.read(bytes, numBytes);
+      if (m_is.gcount() != static_cast<std::streamsize>(numBytes)) {
+        m_ok = false;
+        return false;
+      }
+      if (m_remaining >= 0) { m_remaining -= numBytes; }
+      return true;
+    }
+
+    /** Returns false if count items of at least minBytes each cannot fit in the rest of the
+     *  stream. */
+    bool checkCount(unsigned count, unsigned minBytes) {
+      if (m_ok && (m_remaining >= 0) &&
+          (static_cast<std::uint64_t>(count) * minBytes > static_cast<std::uint64_t>(m_remaining)))
+      {
+        m_ok = false;
+      }
+      return m_ok;
+    }
+
+    std::uint64_t readUnsigned(unsigned numBytes) {
+      unsigned char bytes[8];
+      if (!readBytes(reinterpret_cast<char*>(bytes), numBytes)) { return 0; }
+      std::uint64_t result = 0;
+      for (unsigned i = 0; i < numBytes; ++i) {
+        result |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+      }
+      return result;
+    }
+
+    unsigned readUInt32() {
+      return static_cast<unsigned>(readUnsigned(4));
+    }
+
+    unsigned char readTag() {
+      return static_cast<unsigned char>(readUnsigned(1));
+    }
+
+    std::string readString() {
+      std::string result;
+      unsigned n = readUInt32();
+      if (n > 0 && checkCount(n, 1)) {
+        result.resize(n);
+        readBytes(&result[0], n);
+      }
+      return result;
+    }
+
+    Handle readHandle() {
+      char bytes[16];
+      if (!readBytes(bytes, 16)) { return Handle(); }
+      return QUuid::fromRfc4122(QByteArray(bytes, 16));
+    }
+
+    double readDouble() {
+      std::uint64_t bits = readUnsigned(8);
+      double result;
+      std::memcpy(&result, &bits, sizeof(result));
+      return result;
+    }
+
+    /** Reads an index into a table of size n. */
+    unsigned readIndex(std::size_t n) {
+      unsigned result = readUInt32();
+      if (result >= n) {
+        m_ok = false;
+        return 0;
+      }
+      return result;
+    }
+
+    /** Reads an index into strings, and returns that string. */
+    std::string readStringIndex(const std::vector<std::string>& strings) {
+      unsigned i = readIndex(strings.size());
+      return m_ok ? strings[i] : std::string();
+    }
+
+   private:
+    std::istream& m_is;
+    bool m_ok;
+    std::streamoff m_remaining;
+  };
+
+} // anonymous namespace
+
 namespace detail {
 
   // CONSTRUCTORS
@@ -59,6 +272,7 @@ namespace detail {
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_stringPool(new IdfStringPool()),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -69,6 +283,17 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_stringPool(new IdfStringPool()),
+      m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+  {}
+
+  Workspace_Impl::Workspace_Impl(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                                 StrictnessLevel level) :
+      m_strictnessLevel(level),
+      m_iddFileAndFactoryWrapper(iddFileAndFactoryWrapper),
+      m_fastNaming(false),
+      m_stringPool(new IdfStringPool()),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -78,6 +303,7 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_stringPool(new IdfStringPool()),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -100,6 +326,7 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_stringPool(new IdfStringPool()),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -454,6 +681,11 @@ namespace detail {
     return m_fastNaming;
   }
 
+  std::shared_ptr<IdfStringPool> Workspace_Impl::stringPool() const
+  {
+    return m_stringPool;
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
@@ -584,12 +816,7 @@ namespace detail {
   {
     int i = 0;
     int N = objectImplPtrs.size();
-    if (oldNewHandleMap.empty()) {
-      emit progressRange(0, 2*N);
-    }
-    else {
-      emit progressRange(0, 3*N);
-    }
+    emit progressRange(0, 3*N);
     emit progressValue(0);
     emit progressCaption("Cloning Objects");
 
@@ -603,12 +830,15 @@ namespace detail {
       emit progressValue(++i);
     }
 
-    // step 2: apply handle map to pointers
-    if (!oldNewHandleMap.empty()) {
-      for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+    // step 2: apply handle map to pointers, and resolve them to the objects added in step 1
+    for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+      if (oldNewHandleMap.empty()) {
+        ptr->resolvePointers();
+      }
+      else {
         ptr->initializeOnClone(oldNewHandleMap);
-        emit progressValue(++i);
       }
+      emit progressValue(++i);
     }
 
     // step 3: apply handle map to orderer
@@ -1609,6 +1839,119 @@ namespace detail {
     m_fastNaming = fastNaming;
   }
 
+  // BULK FIELD ACCESS
+
+  std::vector<Handle> Workspace_Impl::getHandlesByType(IddObjectType objectType) const {
+    HandleVector result;
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc != m_iddObjectTypeMap.end()) {
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& entry : loc->second) {
+        result.push_back(entry.first);
+      }
+    }
+    return result;
+  }
+
+  std::vector<std::string> Workspace_Impl::getStringColumn(IddObjectType objectType,
+                                                           unsigned index,
+                                                           bool returnDefault) const
+  {
+    StringVector result;
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc != m_iddObjectTypeMap.end()) {
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& entry : loc->second) {
+        OptionalString value = entry.second->getString(index,returnDefault);
+        result.push_back(value ? *value : std::string());
+      }
+    }
+    return result;
+  }
+
+  std::vector<double> Workspace_Impl::getDoubleColumn(IddObjectType objectType,
+                                                      unsigned index,
+                                                      bool returnDefault) const
+  {
+    DoubleVector result;
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc != m_iddObjectTypeMap.end()) {
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& entry : loc->second) {
+        OptionalDouble value = entry.second->getDouble(index,returnDefault);
+        result.push_back(value ? *value : std::numeric_limits<double>::quiet_NaN());
+      }
+    }
+    return result;
+  }
+
+  std::vector<Handle> Workspace_Impl::getPointerColumn(IddObjectType objectType, unsigned index) const {
+    HandleVector result;
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc != m_iddObjectTypeMap.end()) {
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& entry : loc->second) {
+        OptionalWorkspaceObject target = entry.second->getTarget(index);
+        result.push_back(target ? target->handle() : Handle());
+      }
+    }
+    return result;
+  }
+
+  bool Workspace_Impl::setStringColumn(IddObjectType objectType,
+                                       unsigned index,
+                                       const std::vector<std::string>& values)
+  {
+    std::vector<WorkspaceObject_ImplPtr> objectImplPtrs = objectImplPtrsByType(objectType);
+    if (values.size() != objectImplPtrs.size()) {
+      LOG(Error,"Unable to set field " << index << " of " << objectImplPtrs.size() << " "
+          << objectType.valueDescription() << " objects from " << values.size() << " values.");
+      return false;
+    }
+    bool result = true;
+    for (unsigned i = 0, n = objectImplPtrs.size(); i < n; ++i) {
+      result = objectImplPtrs[i]->setString(index,values[i]) && result;
+    }
+    return result;
+  }
+
+  bool Workspace_Impl::setDoubleColumn(IddObjectType objectType,
+                                       unsigned index,
+                                       const std::vector<double>& values)
+  {
+    std::vector<WorkspaceObject_ImplPtr> objectImplPtrs = objectImplPtrsByType(objectType);
+    if (values.size() != objectImplPtrs.size()) {
+      LOG(Error,"Unable to set field " << index << " of " << objectImplPtrs.size() << " "
+          << objectType.valueDescription() << " objects from " << values.size() << " values.");
+      return false;
+    }
+    bool result = true;
+    for (unsigned i = 0, n = objectImplPtrs.size(); i < n; ++i) {
+      if (std::isnan(values[i])) {
+        continue;
+      }
+      result = objectImplPtrs[i]->setDouble(index,values[i]) && result;
+    }
+    return result;
+  }
+
+  bool Workspace_Impl::setPointerColumn(IddObjectType objectType,
+                                        unsigned index,
+                                        const std::vector<Handle>& values)
+  {
+    std::vector<WorkspaceObject_ImplPtr> objectImplPtrs = objectImplPtrsByType(objectType);
+    if (values.size() != objectImplPtrs.size()) {
+      LOG(Error,"Unable to set field " << index << " of " << objectImplPtrs.size() << " "
+          << objectType.valueDescription() << " objects from " << values.size() << " values.");
+      return false;
+    }
+    bool result = true;
+    for (unsigned i = 0, n = objectImplPtrs.size(); i < n; ++i) {
+      result = objectImplPtrs[i]->setPointer(index,values[i]) && result;
+    }
+    return result;
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -1870,7 +2213,38 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p,overwrite);
+    // same path handling as IdfFile::save, but objects are streamed out rather than copied into
+    // an IdfFile first
+    path wp = IdfFile::savePath(p,iddFileType());
+
+    // do not overwrite if not allowed
+    if (!overwrite) {
+      path temp = completePathToFile(wp,path());
+      if (!temp.empty()) {
+        LOG(Info,"Save method failed because instructed not to overwrite path '"
+          << toString(wp) << "'.");
+        return false;
+      }
+    }
+
+    if (makeParentFolder(wp)) {
+      boost::filesystem::ofstream outFile(wp);
+      if (outFile) {
+        try {
+          print(outFile);
+          outFile.close();
+          return true;
+        }
+        catch (...) {
+          LOG(Error,"Unable to write file to path '" << toString(wp) << "'.");
+          return false;
+        }
+      }
+    }
+
+    LOG(Error,"Unable to write file to path '" << toString(wp) << "', because parent directory "
+        << "could not be created.");
+    return false;
   }
 
   IdfFile Workspace_Impl::toIdfFile() {
@@ -1900,6 +2274,383 @@ namespace detail {
     return result;
   }
 
+  std::ostream& Workspace_Impl::print(std::ostream& os) {
+    // same layout as IdfFile::print for the IdfFile returned by toIdfFile. each object is copied
+    // into a temporary IdfObject, with pointers serialized as handles or names, only while it is
+    // being printed.
+    std::string header = makeComment(m_header); // as in IdfFile::setHeader
+    if (!header.empty()) {
+      os << header << std::endl;
+    }
+    os << std::endl;
+
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      vo->idfObject().print(os);
+    }
+
+    WorkspaceObjectVector objs = objects(true); // sorted objects
+    for (const WorkspaceObject& obj : objs) {
+      obj.idfObject().print(os);
+    }
+
+    return os;
+  }
+
+  bool Workspace_Impl::loadIdfObjects(std::istream& is, ProgressBar* progressBar) {
+    // create WorkspaceObject_Impls as objects are parsed, so that the text and IdfObject for each
+    // one can be released right away. version objects are kept aside to go first, as in
+    // Workspace(const IdfFile&).
+    WorkspaceObject_ImplPtrVector objectImplPtrs;
+    WorkspaceObject_ImplPtrVector versionObjectImplPtrs;
+    bool ok = IdfFile::parse(
+        is,
+        m_iddFileAndFactoryWrapper,
+        [this](const std::string& header) { m_header = makeComment(header); },
+        [this,&objectImplPtrs,&versionObjectImplPtrs](const IdfObject& object) {
+          if (IdfFile::isVersionObject(object)) {
+            versionObjectImplPtrs.push_back(createObject(object,true));
+          }
+          else {
+            objectImplPtrs.push_back(createObject(object,true));
+          }
+        },
+        progressBar);
+    if (!ok) {
+      return false;
+    }
+
+    // like IdfFile::load, ambiguous version objects are dropped, and a missing one is added
+    if (versionObjectImplPtrs.size() == 1u) {
+      objectImplPtrs.insert(objectImplPtrs.begin(),versionObjectImplPtrs[0]);
+    }
+    else if (versionObjectImplPtrs.empty() && m_iddFileAndFactoryWrapper.versionObject()) {
+      objectImplPtrs.insert(objectImplPtrs.begin(),createObject(versionObjectToAdd(),true));
+    }
+    versionObjectImplPtrs.clear();
+
+    // one pass to resolve all pointers
+    addObjects(objectImplPtrs);
+    return true;
+  }
+
+  bool Workspace_Impl::saveBinary(std::ostream& os) const {
+    IddFileType iddFileType = this->iddFileType();
+    if (iddFileType == IddFileType::UserCustom) {
+      LOG(Error,"Unable to save Workspace in the binary format, because it uses a custom IddFile, "
+          << "whose object types cannot be recorded.");
+      return false;
+    }
+
+    // version object first, like toIdfFile, then the sorted objects
+    WorkspaceObjectVector objs;
+    OptionalWorkspaceObject vo = versionObject();
+    if (vo) {
+      objs.push_back(*vo);
+    }
+    for (const WorkspaceObject& obj : objects(true)) {
+      if (!vo || (obj.handle() != vo->handle())) {
+        objs.push_back(obj);
+      }
+    }
+
+    BinaryStringTable strings;
+    std::map<IddObjectType,unsigned> typeIndices;
+    std::vector<unsigned> typeNames;
+
+    // writes obj to out, interning its strings and type
+    auto writeObject = [&](std::ostream& out, const WorkspaceObject& obj) {
+      std::shared_ptr<WorkspaceObject_Impl> objImpl = obj.getImpl<WorkspaceObject_Impl>();
+      const IddObject& iddObject = objImpl->m_iddObject;
+      const std::vector<IdfFieldValue>& fields = objImpl->m_fields;
+
+      std::pair<std::map<IddObjectType,unsigned>::iterator,bool> typeInsertResult =
+          typeIndices.insert(std::make_pair(iddObject.type(), static_cast<unsigned>(typeNames.size())));
+      if (typeInsertResult.second) {
+        typeNames.push_back(strings.index(iddObject.type().valueName()));
+      }
+
+      writeBinaryUInt32(out, typeInsertResult.first->second);
+      writeBinaryHandle(out, objImpl->m_handle);
+      writeBinaryUInt32(out, strings.index(objImpl->m_comment));
+      writeBinaryUInt32(out, fields.size());
+
+      // the handle field is the handle written above
+      unsigned firstField = (iddObject.hasHandleField() && !fields.empty()) ? 1u : 0u;
+      for (unsigned i = firstField, n = fields.size(); i < n; ++i) {
+        // pointers are written as handles, or as names if the IDD has no handle fields
+        if (objImpl->m_sourceData) {
+          ForwardPointerSet::const_iterator fpIt = objImpl->m_sourceData->pointers.find(ForwardPointer(i,Handle()));
+          if ((fpIt != objImpl->m_sourceData->pointers.end()) && !fpIt->targetHandle.isNull()) {
+            if (iddObject.hasHandleField()) {
+              out.put(static_cast<char>(BinaryHandleField));
+              writeBinaryHandle(out, fpIt->targetHandle);
+            }
+            else {
+              OptionalString targetName = name(fpIt->targetHandle);
+              OS_ASSERT(targetName);
+              out.put(static_cast<char>(BinaryStringField));
+              writeBinaryUInt32(out, strings.index(*targetName));
+            }
+            continue;
+          }
+        }
+
+        const IdfFieldValue& fieldValue = fields[i];
+        if (fieldValue.empty()) {
+          out.put(static_cast<char>(BinaryEmptyField));
+          continue;
+        }
+        if (fieldValue.isHandle()) {
+          out.put(static_cast<char>(BinaryHandleField));
+          writeBinaryHandle(out, fieldValue.handle());
+          continue;
+        }
+
+        std::string value = fieldValue.str();
+
+        OptionalIddField iddField = iddObject.getField(i);
+        if (iddField) {
+          IddFieldType fieldType = iddField->properties().type;
+          double realValue(0.0);
+          long long integerValue(0);
+          if ((fieldType == IddFieldType::RealType) && isExactReal(value, realValue)) {
+            out.put(static_cast<char>(BinaryRealField));
+            writeBinaryDouble(out, realValue);
+            continue;
+          }
+          if ((fieldType == IddFieldType::IntegerType) && isExactInteger(value, integerValue)) {
+            out.put(static_cast<char>(BinaryIntegerField));
+            writeBinaryUnsigned(out, static_cast<std::uint64_t>(integerValue), 8);
+            continue;
+          }
+        }
+
+        out.put(static_cast<char>(BinaryStringField));
+        writeBinaryUInt32(out, strings.index(value));
+      }
+
+      const StringVector& fieldComments = objImpl->m_fieldComments;
+      writeBinaryUInt32(out, fieldComments.size());
+      for (const std::string& fieldComment : fieldComments) {
+        writeBinaryUInt32(out, strings.index(fieldComment));
+      }
+    };
+
+    // the string table precedes the objects, so a first pass fills it without writing anything;
+    // a stream without a buffer discards every write
+    std::ostream discard(nullptr);
+    unsigned headerIndex = strings.index(m_header);
+    for (const WorkspaceObject& obj : objs) {
+      writeObject(discard, obj);
+    }
+
+    // preamble
+    os.write(binaryWorkspaceMagic, sizeof(binaryWorkspaceMagic));
+    writeBinaryUInt32(os, binaryWorkspaceFormatVersion);
+    writeBinaryString(os, iddFileType.valueName());
+    writeBinaryString(os, version().str());
+
+    strings.write(os);
+    writeBinaryUInt32(os, headerIndex);
+    writeBinaryUInt32(os, typeNames.size());
+    for (unsigned typeName : typeNames) {
+      writeBinaryUInt32(os, typeName);
+    }
+
+    // second pass finds every string and type already interned
+    writeBinaryUInt32(os, objs.size());
+    for (const WorkspaceObject& obj : objs) {
+      writeObject(os, obj);
+    }
+
+    if (!os) {
+      LOG(Error,"Unable to write Workspace in the binary format.");
+      return false;
+    }
+    return true;
+  }
+
+  bool Workspace_Impl::saveBinary(const openstudio::path& p, bool overwrite) const {
+    // do not overwrite if not allowed
+    if (!overwrite) {
+      path temp = completePathToFile(p,path());
+      if (!temp.empty()) {
+        LOG(Info,"Save method failed because instructed not to overwrite path '"
+          << toString(p) << "'.");
+        return false;
+      }
+    }
+
+    if (makeParentFolder(p)) {
+      boost::filesystem::ofstream outFile(p, std::ios_base::out | std::ios_base::binary);
+      if (outFile) {
+        bool result = saveBinary(outFile);
+        outFile.close();
+        return result;
+      }
+    }
+
+    LOG(Error,"Unable to write file to path '" << toString(p) << "', because parent directory "
+        << "could not be created.");
+    return false;
+  }
+
+  bool Workspace_Impl::loadBinaryPreamble(std::istream& is, IddFileType& iddFileType, std::string& iddVersion) {
+    BinaryReader reader(is);
+    char magic[sizeof(binaryWorkspaceMagic)];
+    if (!reader.readBytes(magic, sizeof(magic)) ||
+        !std::equal(magic, magic + sizeof(magic), binaryWorkspaceMagic))
+    {
+      LOG(Error,"Input is not a binary Workspace.");
+      return false;
+    }
+    unsigned formatVersion = reader.readUInt32();
+    if (formatVersion != binaryWorkspaceFormatVersion) {
+      LOG(Error,"Unable to load binary Workspace format version " << formatVersion
+          << ", only version " << binaryWorkspaceFormatVersion << " is supported.");
+      return false;
+    }
+    std::string iddFileTypeName = reader.readString();
+    iddVersion = reader.readString();
+    if (!reader.ok()) {
+      LOG(Error,"Binary Workspace is truncated or corrupt.");
+      return false;
+    }
+
+    OptionalIddFileType oIddFileType;
+    try {
+      oIddFileType = IddFileType(iddFileTypeName);
+    }
+    catch (...) {}
+    if (!oIddFileType || (*oIddFileType == IddFileType::UserCustom)) {
+      LOG(Error,"Binary Workspace has unsupported IddFileType '" << iddFileTypeName << "'.");
+      return false;
+    }
+    iddFileType = *oIddFileType;
+    return true;
+  }
+
+  bool Workspace_Impl::loadBinaryObjects(std::istream& is, const std::string& iddVersion) {
+    if (version().str() != iddVersion) {
+      LOG(Error,"Binary Workspace was saved with version " << iddVersion << " of the "
+          << iddFileType().valueName() << " IddFile, but version " << version().str()
+          << " is in use. Binary Workspaces are not version translated.");
+      return false;
+    }
+
+    BinaryReader reader(is);
+
+    // each string is at least its 4 byte length
+    unsigned numStrings = reader.readUInt32();
+    StringVector strings;
+    if (reader.checkCount(numStrings, 4)) {
+      strings.reserve(numStrings);
+      for (unsigned i = 0; (i < numStrings) && reader.ok(); ++i) {
+        strings.push_back(reader.readString());
+      }
+    }
+
+    m_header = reader.readStringIndex(strings);
+
+    unsigned numTypes = reader.readUInt32();
+    std::vector<IddObject> iddObjects;
+    if (reader.checkCount(numTypes, 4)) {
+      iddObjects.reserve(numTypes);
+      for (unsigned i = 0; (i < numTypes) && reader.ok(); ++i) {
+        std::string typeName = reader.readStringIndex(strings);
+        OptionalIddObject iddObject;
+        try {
+          iddObject = getIddObject(IddObjectType(typeName));
+        }
+        catch (...) {}
+        if (!iddObject) {
+          LOG(Error,"Binary Workspace contains objects of type '" << typeName
+              << "', which is not in the " << iddFileType().valueName() << " IddFile.");
+          return false;
+        }
+        iddObjects.push_back(*iddObject);
+      }
+    }
+
+    // each object is at least its type, handle, comment, and two counts
+    unsigned numObjects = reader.readUInt32();
+    WorkspaceObject_ImplPtrVector objectImplPtrs;
+    if (reader.checkCount(numObjects, 32)) {
+      objectImplPtrs.reserve(numObjects);
+      for (unsigned i = 0; (i < numObjects) && reader.ok(); ++i) {
+        unsigned typeIndex = reader.readIndex(iddObjects.size());
+        Handle handle = reader.readHandle();
+        std::string comment = reader.readStringIndex(strings);
+
+        // each field is at least its tag, except the handle field which is not repeated
+        unsigned numFields = reader.readUInt32();
+        StringVector fields;
+        unsigned firstField = (reader.ok() && iddObjects[typeIndex].hasHandleField() && (numFields > 0)) ? 1u : 0u;
+        if (reader.checkCount(numFields - firstField, 1)) {
+          fields.reserve(numFields);
+          if (firstField == 1) {
+            fields.push_back(toString(handle));
+          }
+          for (unsigned j = firstField; (j < numFields) && reader.ok(); ++j) {
+            switch (reader.readTag()) {
+              case BinaryEmptyField :
+                fields.push_back(std::string());
+                break;
+              case BinaryStringField :
+                fields.push_back(reader.readStringIndex(strings));
+                break;
+              case BinaryHandleField :
+                fields.push_back(toString(reader.readHandle()));
+                break;
+              case BinaryRealField :
+                fields.push_back(openstudio::toString(reader.readDouble()));
+                break;
+              case BinaryIntegerField :
+                fields.push_back(boost::lexical_cast<std::string>(static_cast<long long>(reader.readUnsigned(8))));
+                break;
+              default :
+                LOG(Error,"Binary Workspace contains an unknown field tag.");
+                return false;
+            }
+          }
+        }
+
+        unsigned numFieldComments = reader.readUInt32();
+        StringVector fieldComments;
+        if (reader.checkCount(numFieldComments, 4)) {
+          fieldComments.reserve(numFieldComments);
+          for (unsigned j = 0; (j < numFieldComments) && reader.ok(); ++j) {
+            fieldComments.push_back(reader.readStringIndex(strings));
+          }
+        }
+
+        if (!reader.ok()) {
+          break;
+        }
+        if (handle.isNull()) {
+          LOG(Error,"Binary Workspace contains an object with a null handle.");
+          return false;
+        }
+
+        // createObject is virtual, so derived Workspaces construct their own object types
+        IdfObject idfObject(IdfObject_ImplPtr(new IdfObject_Impl(handle,
+                                                                 comment,
+                                                                 iddObjects[typeIndex],
+                                                                 fields,
+                                                                 fieldComments)));
+        objectImplPtrs.push_back(createObject(idfObject,true));
+      }
+    }
+
+    if (!reader.ok()) {
+      LOG(Error,"Binary Workspace is truncated or corrupt.");
+      return false;
+    }
+
+    addObjects(objectImplPtrs);
+    return true;
+  }
+
   // PRIVATE
 
   // GETTER HELPERS
@@ -2043,6 +2794,19 @@ namespace detail {
     m_iddObjectTypeMap[objectImplPtr->iddObject().type()].insert(std::make_pair(objectImplPtr->handle(),objectImplPtr));
   }
 
+  std::vector<WorkspaceObject_ImplPtr> Workspace_Impl::objectImplPtrsByType(IddObjectType objectType) const {
+    // copied, since setters may emit signals whose handlers change the type map
+    std::vector<WorkspaceObject_ImplPtr> result;
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc != m_iddObjectTypeMap.end()) {
+      result.reserve(loc->second.size());
+      for (const WorkspaceObjectMap::value_type& entry : loc->second) {
+        result.push_back(entry.second);
+      }
+    }
+    return result;
+  }
+
   void Workspace_Impl::insertIntoIdfReferencesMap(
       const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
   {
@@ -2899,6 +3663,51 @@ void Workspace::setFastNaming(bool fastNaming)
   m_impl->setFastNaming(fastNaming);
 }
 
+// BULK FIELD ACCESS
+
+std::vector<Handle> Workspace::getHandlesByType(IddObjectType objectType) const {
+  return m_impl->getHandlesByType(objectType);
+}
+
+std::vector<std::string> Workspace::getStringColumn(IddObjectType objectType,
+                                                    unsigned index,
+                                                    bool returnDefault) const
+{
+  return m_impl->getStringColumn(objectType,index,returnDefault);
+}
+
+std::vector<double> Workspace::getDoubleColumn(IddObjectType objectType,
+                                               unsigned index,
+                                               bool returnDefault) const
+{
+  return m_impl->getDoubleColumn(objectType,index,returnDefault);
+}
+
+std::vector<Handle> Workspace::getPointerColumn(IddObjectType objectType, unsigned index) const {
+  return m_impl->getPointerColumn(objectType,index);
+}
+
+bool Workspace::setStringColumn(IddObjectType objectType,
+                                unsigned index,
+                                const std::vector<std::string>& values)
+{
+  return m_impl->setStringColumn(objectType,index,values);
+}
+
+bool Workspace::setDoubleColumn(IddObjectType objectType,
+                                unsigned index,
+                                const std::vector<double>& values)
+{
+  return m_impl->setDoubleColumn(objectType,index,values);
+}
+
+bool Workspace::setPointerColumn(IddObjectType objectType,
+                                 unsigned index,
+                                 const std::vector<Handle>& values)
+{
+  return m_impl->setPointerColumn(objectType,index,values);
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
@@ -2999,37 +3808,58 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
 }
 
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
-  OptionalIdfFile oIdfFile = IdfFile::load(p);
-  if (oIdfFile) {
-    return Workspace(*oIdfFile);
-  }
-  return boost::none;
+  return load(p,IdfFile::loadIddFileType(p));
 }
 
 boost::optional<Workspace> Workspace::load(const openstudio::path& p,
                                            const IddFileType& iddFileType)
 {
-  OptionalIdfFile oIdfFile = IdfFile::load(p,iddFileType);
-  if (oIdfFile) {
-    return Workspace(*oIdfFile);
-  }
-  return boost::none;
+  return loadIdf(IdfFile::completeLoadPath(p,iddFileType),IddFileAndFactoryWrapper(iddFileType));
 }
 
 boost::optional<Workspace> Workspace::load(const openstudio::path& p,
                                            const IddFile& iddFile)
 {
-  OptionalIdfFile oIdfFile = IdfFile::load(p,iddFile);
-  if (oIdfFile) {
-    return Workspace(*oIdfFile);
-  }
-  return boost::none;
+  return loadIdf(IdfFile::completeLoadPath(p,boost::none),IddFileAndFactoryWrapper(iddFile));
 }
 
 IdfFile Workspace::toIdfFile() const {
   return m_impl->toIdfFile();
 }
 
+bool Workspace::saveBinary(const openstudio::path& p, bool overwrite) const {
+  return m_impl->saveBinary(p,overwrite);
+}
+
+bool Workspace::saveBinary(std::ostream& os) const {
+  return m_impl->saveBinary(os);
+}
+
+boost::optional<Workspace> Workspace::loadBinary(const openstudio::path& p) {
+  boost::filesystem::ifstream inFile(p, std::ios_base::in | std::ios_base::binary);
+  if (!inFile) {
+    LOG(Error,"Unable to open file at path '" << toString(p) << "'.");
+    return boost::none;
+  }
+  return loadBinary(inFile);
+}
+
+boost::optional<Workspace> Workspace::loadBinary(std::istream& is) {
+  IddFileType iddFileType(IddFileType::OpenStudio);
+  std::string iddVersion;
+  if (!detail::Workspace_Impl::loadBinaryPreamble(is,iddFileType,iddVersion)) {
+    return boost::none;
+  }
+
+  std::shared_ptr<detail::Workspace_Impl> impl(new detail::Workspace_Impl(StrictnessLevel(StrictnessLevel::Draft),iddFileType));
+  if (!impl->loadBinaryObjects(is,iddVersion)) {
+    return boost::none;
+  }
+  Workspace result(impl);
+  impl->resolvePotentialNameConflicts(result);
+  return result;
+}
+
 std::vector<std::pair<QUrl, openstudio::path> > Workspace::locateUrls(
     const std::vector<URLSearchPath> &t_paths, bool t_create_relative_paths,
     const openstudio::path &t_infile)
@@ -3043,6 +3873,27 @@ Workspace::Workspace(std::shared_ptr<detail::Workspace_Impl> impl)
   : m_impl(impl)
 {}
 
+boost::optional<Workspace> Workspace::loadIdf(const openstudio::path& p,
+                                              const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper)
+{
+  boost::filesystem::ifstream inFile(p);
+  if (!inFile) {
+    return boost::none;
+  }
+
+  std::shared_ptr<detail::Workspace_Impl> impl(new detail::Workspace_Impl(iddFileAndFactoryWrapper,StrictnessLevel(StrictnessLevel::None)));
+  try {
+    if (!impl->loadIdfObjects(inFile)) {
+      return boost::none;
+    }
+  }
+  catch (...) { return boost::none; }
+
+  Workspace result(impl);
+  impl->resolvePotentialNameConflicts(result);
+  return result;
+}
+
 std::vector<WorkspaceObject> Workspace::allObjects() const {
   return m_impl->allObjects();
 }
@@ -3061,8 +3912,7 @@ void Workspace::addVersionObject() {
 
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace)
 {
-  os << workspace.toIdfFile();
-  return os;
+  return workspace.getImpl<detail::Workspace_Impl>()->print(os);
 }
 
 } // openstudio
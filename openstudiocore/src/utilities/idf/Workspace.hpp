@@ -28,6 +28,7 @@
 #include "../core/Path.hpp"
 
 #include <string>
+#include <istream>
 #include <ostream>
 #include <vector>
 #include <set>
@@ -40,6 +41,7 @@ struct IddFileType;
 class IddObject;
 struct IddObjectType;
 class IdfFile;
+class IddFileAndFactoryWrapper;
 class IdfObject;
 class WorkspaceObject;
 class WorkspaceObjectOrder;
@@ -332,6 +334,57 @@ class UTILITIES_API Workspace {
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  //@}
+  /** @name Bulk Field Access
+   *
+   *  Get or set one field of every object of a type in a single call, for scripts that would
+   *  otherwise cross the language boundary once per object. Values are returned and accepted as
+   *  packed columns whose rows are in the order of getHandlesByType. Setters go through the
+   *  same per-object setters as WorkspaceObject, so validity checks and change signals are
+   *  unaffected. */
+  //@{
+
+  /** Returns the handles of all objects of type objectType. This is the row order of the
+   *  other bulk field methods. */
+  std::vector<Handle> getHandlesByType(IddObjectType objectType) const;
+
+  /** Returns field index of each object of type objectType, as returned by
+   *  getString(index,returnDefault). Objects without a value give an empty string. */
+  std::vector<std::string> getStringColumn(IddObjectType objectType,
+                                           unsigned index,
+                                           bool returnDefault=false) const;
+
+  /** Returns field index of each object of type objectType, as returned by
+   *  getDouble(index,returnDefault). Objects without a numeric value (empty, missing,
+   *  autosized, etc.) give NaN. */
+  std::vector<double> getDoubleColumn(IddObjectType objectType,
+                                      unsigned index,
+                                      bool returnDefault=false) const;
+
+  /** Returns the handle of the target of pointer field index of each object of type objectType.
+   *  Objects without a target give a null handle. */
+  std::vector<Handle> getPointerColumn(IddObjectType objectType, unsigned index) const;
+
+  /** Sets field index of each object of type objectType with setString. values must have one
+   *  entry per row. Returns false if values is the wrong size (in which case nothing is set), or
+   *  if any value is rejected (in which case that object is left unchanged and the rest are
+   *  set). */
+  bool setStringColumn(IddObjectType objectType,
+                       unsigned index,
+                       const std::vector<std::string>& values);
+
+  /** Sets field index of each object of type objectType with setDouble, as in setStringColumn.
+   *  NaN entries leave the corresponding field unchanged. */
+  bool setDoubleColumn(IddObjectType objectType,
+                       unsigned index,
+                       const std::vector<double>& values);
+
+  /** Sets pointer field index of each object of type objectType with setPointer, as in
+   *  setStringColumn. */
+  bool setPointerColumn(IddObjectType objectType,
+                        unsigned index,
+                        const std::vector<Handle>& values);
+
   //@}
   /** @name Object Order */
   //@{
@@ -425,6 +478,26 @@ class UTILITIES_API Workspace {
    *  serialized as names. */
   IdfFile toIdfFile() const;
 
+  /** Save this Workspace to path p in the binary Workspace format. Unlike save, does not change
+   *  the extension of p. Will only overwrite an existing file if overwrite==true. The format
+   *  stores each distinct string once, IddObjectTypes as indices into a type table, handles as
+   *  16 raw bytes, and exactly representable integer and real fields as numbers. It is meant for
+   *  fast saving and reloading with the same version of OpenStudio; it is not version translated.
+   *  Workspaces using IddFileType::UserCustom cannot be saved in this format. */
+  bool saveBinary(const openstudio::path& p, bool overwrite=false) const;
+
+  /** Write this Workspace to os in the binary Workspace format. os should be opened in binary
+   *  mode. */
+  bool saveBinary(std::ostream& os) const;
+
+  /** Load a Workspace saved with saveBinary. Objects are read directly into the new Workspace,
+   *  without going through an IdfFile. Returns boost::none if p is not a binary Workspace, or
+   *  was written for a different IddFileType version. */
+  static boost::optional<Workspace> loadBinary(const openstudio::path& p);
+
+  /** Load a Workspace written with saveBinary from is, which should be opened in binary mode. */
+  static boost::optional<Workspace> loadBinary(std::istream& is);
+
   /// Find and update all relative (and remote) URLs to well defined locations based on the search paths supplied
   /// \param[in] t_paths Paths to search for relative urls
   /// \param[in] t_create_relative_paths If true, update paths to relative locations on the local filesystem, else, make internal urls
@@ -494,6 +567,10 @@ class UTILITIES_API Workspace {
 
  private:
 
+  /** Reads the IDF text at p directly into a new Workspace. Shared by the load overloads. */
+  static boost::optional<Workspace> loadIdf(const openstudio::path& p,
+                                            const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.Workspace");
 
@@ -51,6 +51,35 @@ namespace openstudio {
 
 namespace detail {
 
+  void TargetData::insert(const pointer_type& pointer) {
+    // automatically maintains uniqueness
+    std::pair<pointer_set::iterator,bool> insertResult = reversePointers.insert(pointer);
+    OS_ASSERT(insertResult.second);
+    reversePointersByType[pointer.sourceType].insert(pointer);
+  }
+
+  void TargetData::erase(const pointer_type& pointer) {
+    reversePointers.erase(pointer);
+    auto it = reversePointersByType.find(pointer.sourceType);
+    if (it != reversePointersByType.end()) {
+      it->second.erase(pointer);
+      if (it->second.empty()) {
+        reversePointersByType.erase(it);
+      }
+    }
+  }
+
+  void TargetData::clearResolvedSources() {
+    for (const ReversePointer& ptr : reversePointers) {
+      ptr.source = nullptr;
+    }
+    for (const auto& typeAndPointers : reversePointersByType) {
+      for (const ReversePointer& ptr : typeAndPointers.second) {
+        ptr.source = nullptr;
+      }
+    }
+  }
+
   // CONSTRUCTORS
 
   WorkspaceObject_Impl::WorkspaceObject_Impl(const IdfObject& idfObject,
@@ -64,6 +93,9 @@ namespace detail {
       // can nominally be source
       m_sourceData = SourceData();
     }
+    if (m_workspace) {
+      setStringPool(m_workspace->stringPool());
+    }
     if (idfObject.name() && idfObject.name(true).get().empty()) {
       // create name if their is a name field and no default value
       createName();
@@ -78,7 +110,20 @@ namespace detail {
     m_workspace(workspace),
     m_sourceData(other.m_sourceData),
     m_targetData(other.m_targetData)
-  {}
+  {
+    if (m_workspace) {
+      setStringPool(m_workspace->stringPool());
+    }
+    // resolved pointers refer to objects in other's workspace
+    if (m_sourceData) {
+      for (const ForwardPointer& fp : m_sourceData->pointers) {
+        fp.target = nullptr;
+      }
+    }
+    if (m_targetData) {
+      m_targetData->clearResolvedSources();
+    }
+  }
 
   WorkspaceObject_Impl::~WorkspaceObject_Impl() {}
 
@@ -151,11 +196,18 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex,iddObject().type(),this);
             th = fp.targetHandle;
           }
         }
-        mappedPointers.insert(ForwardPointer(fp.fieldIndex,th));
+        // resolve now if the target is already here, cloned targets may be added later
+        WorkspaceObject_Impl* targetImpl = nullptr;
+        if (!th.isNull()) {
+          if (OptionalWorkspaceObject target = workspace().getObject(th)) {
+            targetImpl = target->getImpl<WorkspaceObject_Impl>().get();
+          }
+        }
+        mappedPointers.insert(ForwardPointer(fp.fieldIndex,th,targetImpl));
         if (!th.isNull()) {
           m_workspace->forwardReferences(m_handle,fp.fieldIndex,th);
         }
@@ -163,14 +215,47 @@ namespace detail {
       m_sourceData->pointers = mappedPointers;
     }
     if (m_targetData) {
-      TargetData::pointer_set mappedPointers;
+      TargetData mappedData;
       for (const ReversePointer& rp : m_targetData->reversePointers) {
         Handle sh = openstudio::applyHandleMap(rp.sourceHandle,oldNewHandleMap);
         if (!sh.isNull()) {
-          mappedPointers.insert(ReversePointer(sh,rp.fieldIndex));
+          WorkspaceObject_Impl* sourceImpl = nullptr;
+          if (OptionalWorkspaceObject source = workspace().getObject(sh)) {
+            sourceImpl = source->getImpl<WorkspaceObject_Impl>().get();
+          }
+          mappedData.insert(ReversePointer(sh,rp.fieldIndex,rp.sourceType,sourceImpl));
         }
       }
-      m_targetData->reversePointers = mappedPointers;
+      m_targetData = mappedData;
+    }
+  }
+
+  void WorkspaceObject_Impl::resolvePointers() {
+    OS_ASSERT(m_workspace);
+    if (m_sourceData) {
+      for (const ForwardPointer& fp : m_sourceData->pointers) {
+        if (!fp.target && !fp.targetHandle.isNull()) {
+          if (OptionalWorkspaceObject target = m_workspace->getObject(fp.targetHandle)) {
+            fp.target = target->getImpl<WorkspaceObject_Impl>().get();
+          }
+        }
+      }
+    }
+    if (m_targetData) {
+      // the same source is cached in both sets
+      auto resolve = [this](const ReversePointerSet& pointers) {
+        for (const ReversePointer& rp : pointers) {
+          if (!rp.source) {
+            if (OptionalWorkspaceObject source = m_workspace->getObject(rp.sourceHandle)) {
+              rp.source = source->getImpl<WorkspaceObject_Impl>().get();
+            }
+          }
+        }
+      };
+      resolve(m_targetData->reversePointers);
+      for (const auto& typeAndPointers : m_targetData->reversePointersByType) {
+        resolve(typeAndPointers.second);
+      }
     }
   }
 
@@ -222,12 +307,13 @@ namespace detail {
     if (!initialized()) { return boost::none; }
 
     if (m_sourceData) {
-      // find index and return target if handle not null
-      auto fpIt = getConstIteratorAtFieldIndex<SourceData>(m_sourceData->pointers,index);
+      // find index and return target if handle not null, pointers are ordered by field index
+      auto fpIt = m_sourceData->pointers.find(ForwardPointer(index,Handle()));
       if (fpIt != m_sourceData->pointers.end()) {
-        Handle th = fpIt->targetHandle;
-        if (!th.isNull()) {
-          return this->workspace().getObject(th);
+        if (!fpIt->targetHandle.isNull()) {
+          if (WorkspaceObject_Impl* target = resolveTarget(*fpIt)) {
+            return WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(target->shared_from_this()));
+          }
         }
       }
     }
@@ -241,9 +327,9 @@ namespace detail {
     if (m_sourceData) {
       for (const ForwardPointer& ptr : m_sourceData->pointers) {
         if (!ptr.targetHandle.isNull()) {
-          OptionalWorkspaceObject owo = this->workspace().getObject(ptr.targetHandle);
-          OS_ASSERT(owo);
-          result.push_back(*owo);
+          WorkspaceObject_Impl* target = resolveTarget(ptr);
+          OS_ASSERT(target);
+          result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(target->shared_from_this())));
         }
       }
     }
@@ -266,14 +352,13 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
+      std::vector<WorkspaceObject_Impl*> sourceImpls;
+      sourceImpls.reserve(m_targetData->reversePointers.size());
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+        sourceImpls.push_back(resolveSource(ptr));
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
+      result = uniqueObjects(sourceImpls);
     }
     return result;
   }
@@ -282,14 +367,16 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) { result.push_back(*owo); }
+      auto it = m_targetData->reversePointersByType.find(type);
+      if (it != m_targetData->reversePointersByType.end()) {
+        std::vector<WorkspaceObject_Impl*> sourceImpls;
+        sourceImpls.reserve(it->second.size());
+        for (const ReversePointer& ptr : it->second) {
+          OS_ASSERT(!ptr.sourceHandle.isNull());
+          sourceImpls.push_back(resolveSource(ptr));
+        }
+        result = uniqueObjects(sourceImpls);
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -301,6 +388,26 @@ namespace detail {
     return result;
   }
 
+  unsigned WorkspaceObject_Impl::numUnresolvedPointers() const {
+    unsigned result = 0;
+    if (m_sourceData) {
+      for (const ForwardPointer& fp : m_sourceData->pointers) {
+        if (!fp.target && !fp.targetHandle.isNull()) { ++result; }
+      }
+    }
+    if (m_targetData) {
+      for (const ReversePointer& rp : m_targetData->reversePointers) {
+        if (!rp.source) { ++result; }
+      }
+      for (const auto& typeAndPointers : m_targetData->reversePointersByType) {
+        for (const ReversePointer& rp : typeAndPointers.second) {
+          if (!rp.source) { ++result; }
+        }
+      }
+    }
+    return result;
+  }
+
   // SETTERS
 
   boost::optional<std::string> WorkspaceObject_Impl::setName(const std::string& newName) {
@@ -1001,19 +1108,19 @@ namespace detail {
     OS_ASSERT(m_targetData);
     auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle,index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
-    m_targetData->reversePointers.erase(it);
+    // copy, erase needs the stored sourceType
+    ReversePointer ptr = *it;
+    m_targetData->erase(ptr);
   }
 
   // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
   // Post-condition: m_targetData indicates that object sourceHandle points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index, const IddObjectType& sourceType,
+                                               WorkspaceObject_Impl* source) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) { m_targetData = TargetData(); }
-    // automatically maintains uniqueness
-    std::pair<TargetData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index));
-    OS_ASSERT(insertResult.second);
+    m_targetData->insert(ReversePointer(sourceHandle,index,sourceType,source));
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1026,7 +1133,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(),h.end(),m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,ptr.fieldIndex,iddObject().type(),this);
             }
           }
         }
@@ -1049,6 +1156,42 @@ namespace detail {
 
   // PRIVATE
 
+  // GETTERS
+
+  WorkspaceObject_Impl* WorkspaceObject_Impl::resolveTarget(const ForwardPointer& pointer) const {
+    if (pointer.target) {
+      return pointer.target;
+    }
+    // not resolved when set, look it up but do not write from a const getter
+    OptionalWorkspaceObject target = m_workspace->getObject(pointer.targetHandle);
+    if (target) {
+      return target->getImpl<WorkspaceObject_Impl>().get();
+    }
+    return nullptr;
+  }
+
+  WorkspaceObject_Impl* WorkspaceObject_Impl::resolveSource(const ReversePointer& pointer) const {
+    if (pointer.source) {
+      return pointer.source;
+    }
+    // not resolved when set, look it up but do not write from a const getter
+    OptionalWorkspaceObject source = m_workspace->getObject(pointer.sourceHandle);
+    OS_ASSERT(source);
+    return source->getImpl<WorkspaceObject_Impl>().get();
+  }
+
+  std::vector<WorkspaceObject> WorkspaceObject_Impl::uniqueObjects(std::vector<WorkspaceObject_Impl*>& sourceImpls) {
+    // same order as sorting the WorkspaceObjects, which compare by impl
+    std::sort(sourceImpls.begin(), sourceImpls.end());
+    sourceImpls.erase(std::unique(sourceImpls.begin(), sourceImpls.end()), sourceImpls.end());
+    WorkspaceObjectVector result;
+    result.reserve(sourceImpls.size());
+    for (WorkspaceObject_Impl* sourceImpl : sourceImpls) {
+      result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(sourceImpl->shared_from_this())));
+    }
+    return result;
+  }
+
   // SETTERS
 
   // Pre-condition:  targetHandle is null or in m_workspace. index is an object-list field.
@@ -1073,15 +1216,21 @@ namespace detail {
     if (fpIt != m_sourceData->pointers.end()) {
       m_sourceData->pointers.erase(fpIt);
     }
+    // resolve both ends now, so that getters never have to write to the pointers
+    OptionalWorkspaceObject target;
+    WorkspaceObject_Impl* targetImpl = nullptr;
+    if (!targetHandle.isNull()) {
+      target = m_workspace->getObject(targetHandle);
+      OS_ASSERT(target);
+      targetImpl = target->getImpl<WorkspaceObject_Impl>().get();
+    }
     std::pair<SourceData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_sourceData->pointers.insert(ForwardPointer(index,targetHandle));
+    insertResult = m_sourceData->pointers.insert(ForwardPointer(index,targetHandle,targetImpl));
     OS_ASSERT(insertResult.second);
 
     // add reverse pointer
-    if (!targetHandle.isNull()) {
-      OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
-      OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,index);
+    if (target) {
+      targetImpl->setReversePointer(m_handle,index,iddObject().type(),this);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle,index,targetHandle);
     }
@@ -1132,7 +1281,7 @@ namespace detail {
     // last field must be nonextensible, and final size must satisfy minimum number of fields
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
+      m_diffs.push_back(IdfObjectDiff(index, m_fields[index].str(), boost::none));
       m_fields.pop_back();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
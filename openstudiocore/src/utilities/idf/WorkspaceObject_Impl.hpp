@@ -27,6 +27,8 @@
 
 #include <QObject>
 
+#include <map>
+
 namespace openstudio {
 
 // forward declarations
@@ -36,15 +38,21 @@ class Workspace;
 namespace detail {
 
   class Workspace_Impl; // forward declaration
+  class WorkspaceObject_Impl;
 
   struct UTILITIES_API ForwardPointer {
     unsigned fieldIndex;
     Handle   targetHandle;
+    /// Object targetHandle resolves to, set with the pointer when the target is already in the
+    /// Workspace. Only written by non-const members of the source object, so concurrent const
+    /// access does not race on it. Not part of the ordering.
+    mutable WorkspaceObject_Impl* target;
 
     /// \todo Default constructor needed to iterate over Source Map, but setting fieldIndex to 0
     /// seems sub-optimal.
-    ForwardPointer() : fieldIndex(0) {}
-    ForwardPointer(unsigned i,const Handle& h) : fieldIndex(i), targetHandle(h) {}
+    ForwardPointer() : fieldIndex(0), target(nullptr) {}
+    ForwardPointer(unsigned i,const Handle& h) : fieldIndex(i), targetHandle(h), target(nullptr) {}
+    ForwardPointer(unsigned i,const Handle& h,WorkspaceObject_Impl* t) : fieldIndex(i), targetHandle(h), target(t) {}
   };
   typedef std::set<ForwardPointer,FieldIndexLess<ForwardPointer> > ForwardPointerSet;
 
@@ -61,9 +69,16 @@ namespace detail {
   struct UTILITIES_API ReversePointer {
     Handle   sourceHandle;
     unsigned fieldIndex;
-
-    ReversePointer() : fieldIndex(0) {}
-    ReversePointer(const Handle& h, unsigned i) : sourceHandle(h), fieldIndex(i) {}
+    IddObjectType sourceType;
+    /// Object sourceHandle resolves to, set with the pointer when the source is already in the
+    /// Workspace. Only written by non-const members of the target object, so concurrent const
+    /// access does not race on it. Not part of the ordering.
+    mutable WorkspaceObject_Impl* source;
+
+    ReversePointer() : fieldIndex(0), source(nullptr) {}
+    ReversePointer(const Handle& h, unsigned i) : sourceHandle(h), fieldIndex(i), source(nullptr) {}
+    ReversePointer(const Handle& h, unsigned i, const IddObjectType& type, WorkspaceObject_Impl* s = nullptr)
+      : sourceHandle(h), fieldIndex(i), sourceType(type), source(s) {}
   };
   struct UTILITIES_API ReversePointerLess {
     bool operator()(const ReversePointer& left, const ReversePointer& right) const {
@@ -82,6 +97,14 @@ namespace detail {
     typedef ReversePointerSet pointer_set;
 
     pointer_set reversePointers;
+
+    /// reversePointers split by sourceType, for getSources(type)
+    std::map<IddObjectType,pointer_set> reversePointersByType;
+
+    void insert(const pointer_type& pointer);
+    void erase(const pointer_type& pointer);
+    /// Forgets resolved sources, e.g. after the data is copied to an object in another Workspace.
+    void clearResolvedSources();
   };
   typedef boost::optional<TargetData> OptionalTargetData;
 
@@ -125,6 +148,10 @@ namespace detail {
     /** Complete copy construction process by updating pointer handles. */
     virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
 
+    /** Complete copy construction process for clones that keep their handles, by resolving each
+     *  pointer to the object with that handle in this object's Workspace. */
+    void resolvePointers();
+
     virtual ~WorkspaceObject_Impl();
 
     /// remove the object from the workspace
@@ -165,6 +192,10 @@ namespace detail {
     /** Provided for Workspace_Impl to get easy access to targetData. */
     ReversePointerSet getReversePointers() const;
 
+    /** Returns the number of non-null pointers, to or from this object, that are not resolved to an
+     *  object yet and so cost a Workspace lookup each time they are followed. */
+    unsigned numUnresolvedPointers() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -303,7 +334,8 @@ namespace detail {
     void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
 
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    void setReversePointer(const Handle& sourceHandle, unsigned index, const IddObjectType& sourceType,
+                           WorkspaceObject_Impl* source);
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -332,6 +364,16 @@ namespace detail {
     OptionalSourceData  m_sourceData;
     OptionalTargetData  m_targetData;
 
+    // GETTER HELPERS
+
+    /** Returns the object at the other end of a pointer. Uses the object resolved when the pointer
+     *  was set, or looks it up without remembering it, so that these never write. */
+    WorkspaceObject_Impl* resolveTarget(const ForwardPointer& pointer) const;
+    WorkspaceObject_Impl* resolveSource(const ReversePointer& pointer) const;
+
+    /** Sorts, removes duplicates from, and wraps sourceImpls. */
+    static std::vector<WorkspaceObject> uniqueObjects(std::vector<WorkspaceObject_Impl*>& sourceImpls);
+
     // SETTER HELPERS
 
     /** Sets pointer at field index to targetHandle, and returns old target. */
@@ -35,6 +35,7 @@
 
 #include <string>
 #include <ostream>
+#include <istream>
 #include <vector>
 #include <set>
 #include <map>
@@ -45,6 +46,7 @@ namespace openstudio {
 class IdfFile;
 class VersionString;
 class URLSearchPath;
+class ProgressBar;
 
 // private namespace
 namespace detail {
@@ -71,6 +73,11 @@ namespace detail {
     Workspace_Impl(const IdfFile& idfFile,
                    StrictnessLevel level = StrictnessLevel::None);
 
+    /** Construct an empty Workspace that uses iddFileAndFactoryWrapper. Used by Workspace::load,
+     *  which then reads objects directly into it with loadIdfObjects. */
+    Workspace_Impl(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                   StrictnessLevel level);
+
     /** Copy constructor makes unconnected copy of all data. Assigning new handles to the new objects
      *  is optional. */
     Workspace_Impl(const Workspace_Impl& other,
@@ -202,6 +209,9 @@ namespace detail {
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns the pool through which this Workspace's objects share long field text. */
+    std::shared_ptr<IdfStringPool> stringPool() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -347,6 +357,34 @@ namespace detail {
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
 
+    //@}
+    /** @name Bulk Field Access */
+    //@{
+
+    std::vector<Handle> getHandlesByType(IddObjectType objectType) const;
+
+    std::vector<std::string> getStringColumn(IddObjectType objectType,
+                                             unsigned index,
+                                             bool returnDefault) const;
+
+    std::vector<double> getDoubleColumn(IddObjectType objectType,
+                                        unsigned index,
+                                        bool returnDefault) const;
+
+    std::vector<Handle> getPointerColumn(IddObjectType objectType, unsigned index) const;
+
+    bool setStringColumn(IddObjectType objectType,
+                         unsigned index,
+                         const std::vector<std::string>& values);
+
+    bool setDoubleColumn(IddObjectType objectType,
+                         unsigned index,
+                         const std::vector<double>& values);
+
+    bool setPointerColumn(IddObjectType objectType,
+                          unsigned index,
+                          const std::vector<Handle>& values);
+
     //@}
     /** @name Object Order */
     //@{
@@ -423,9 +461,34 @@ namespace detail {
     virtual bool save(const openstudio::path& p, bool overwrite=false);
 
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
-     *  use this method, then IdfFile.print(ostream). */
+     *  prefer print, which does not copy the whole collection. */
     IdfFile toIdfFile();
 
+    /** Writes the same IDF text as toIdfFile().print(os), naming objects if necessary, but
+     *  serializes one object at a time. */
+    std::ostream& print(std::ostream& os);
+
+    /** Parses IDF text from is, creating each object as soon as it is read, and then adds all of
+     *  the objects to this Workspace, resolving pointers in a single pass. Keeps one version object,
+     *  or adds one if none is found, following IdfFile::load. Used by Workspace::load. */
+    bool loadIdfObjects(std::istream& is, ProgressBar* progressBar=nullptr);
+
+    /** Writes the binary Workspace format to os. See Workspace::saveBinary. */
+    bool saveBinary(std::ostream& os) const;
+
+    bool saveBinary(const openstudio::path& p, bool overwrite) const;
+
+    /** Reads the preamble of the binary Workspace format from is, setting the IddFileType and
+     *  IddFile version it was saved with. Returns false if is is not a binary Workspace in a
+     *  supported format. */
+    static bool loadBinaryPreamble(std::istream& is, IddFileType& iddFileType, std::string& iddVersion);
+
+    /** Reads the string table, header, and objects of the binary Workspace format from is, and
+     *  adds the objects to this Workspace. The preamble has already been read with
+     *  loadBinaryPreamble, and this Workspace constructed with its IddFileType. Returns false if
+     *  iddVersion is not the version of this Workspace's IddFile. */
+    bool loadBinaryObjects(std::istream& is, const std::string& iddVersion);
+
     /// Locates and updates urls in the workspace
     std::vector<std::pair<QUrl, openstudio::path> > locateUrls(const std::vector<URLSearchPath> &t_paths, bool t_create_relative_paths,
      const openstudio::path &t_infile, const openstudio::path &t_locationForRemoteUrls = openstudio::path());
@@ -484,6 +547,7 @@ namespace detail {
     std::string m_header;                                // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
+    std::shared_ptr<IdfStringPool> m_stringPool;
 
     typedef std::map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
@@ -537,6 +601,9 @@ namespace detail {
 
     void insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    /// objects of type objectType, in the row order of the bulk field methods
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > objectImplPtrsByType(IddObjectType objectType) const;
+
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
     // note default parameter for toIgnore is empty vector
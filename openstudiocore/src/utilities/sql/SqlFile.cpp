@@ -1343,6 +1343,15 @@ boost::optional<std::vector<std::string> > SqlFile::execAndReturnVectorOfString(
   return result;
 }
 
+boost::optional<std::vector<std::vector<std::string> > > SqlFile::execAndReturnVectorOfRows(const std::string& statement) const
+{
+  boost::optional<std::vector<std::vector<std::string> > > result;
+  if (m_impl){
+    result = m_impl->execAndReturnVectorOfRows(statement);
+  }
+  return result;
+}
+
 // execute a statement and return the error code, used for create/drop tables
 int SqlFile::execute(const std::string& statement)
 {
@@ -822,6 +822,9 @@ class UTILITIES_API SqlFile {
   /// execute a statement and return the results (if any) in a vector of string
   boost::optional<std::vector<std::string> > execAndReturnVectorOfString(const std::string& statement) const;
 
+  /// execute a statement and return the results (if any) as one vector of column values per row
+  boost::optional<std::vector<std::vector<std::string> > > execAndReturnVectorOfRows(const std::string& statement) const;
+
   /// execute a statement and return the error code, used for create/drop tables
   int execute(const std::string& statement);
 
@@ -30,6 +30,9 @@
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string &, double &, double &);
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(int, double &, double &);
 
+// No wrapper for optional vector of string vectors
+%ignore openstudio::SqlFile::execAndReturnVectorOfRows;
+
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
 %template(OptionalEnvironmentType) boost::optional<openstudio::EnvironmentType>;
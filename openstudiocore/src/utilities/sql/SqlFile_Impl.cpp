@@ -1997,6 +1997,36 @@ namespace openstudio{
       return valueVector;
     }
 
+    boost::optional<std::vector<std::vector<std::string> > > SqlFile_Impl::execAndReturnVectorOfRows(const std::string& statement) const
+    {
+      boost::optional<std::vector<std::vector<std::string> > > rows;
+      if (m_db)
+      {
+        sqlite3_stmt* sqlStmtPtr;
+
+        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        if (code == SQLITE_OK)
+        {
+          rows = std::vector<std::vector<std::string> >();
+          int numColumns = sqlite3_column_count(sqlStmtPtr);
+          while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW)
+          {
+            std::vector<std::string> row;
+            row.reserve(numColumns);
+            for (int i = 0; i < numColumns; ++i)
+            {
+              const unsigned char* text = sqlite3_column_text(sqlStmtPtr, i);
+              row.push_back(text ? columnText(text) : std::string());
+            }
+            rows->push_back(row);
+          }
+        }
+        // must finalize to prevent memory leaks
+        sqlite3_finalize(sqlStmtPtr);
+      }
+      return rows;
+    }
+
 
     // execute a statement and return the error code, used for create/drop tables
     int SqlFile_Impl::execute(const std::string& statement)
@@ -2049,12 +2079,7 @@ namespace openstudio{
         int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+        LOG(Debug, "SQL Query:" << std::endl << s.str() << "Return Code:" << std::endl << code);
         while (code == SQLITE_ROW)
         {
           stdValues.push_back( sqlite3_column_double(sqlStmtPtr, 0) ); // values
@@ -2279,12 +2304,7 @@ namespace openstudio{
         int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+        LOG(Debug, "SQL Query:" << std::endl << s.str() << "Return Code:" << std::endl << code);
 
         long cumulativeSeconds = 0;
 
@@ -2368,12 +2388,7 @@ namespace openstudio{
         int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+        LOG(Debug, "SQL Query:" << std::endl << s.str() << "Return Code:" << std::endl << code);
         while (code == SQLITE_ROW) {
           unsigned month, day, hour, minute;//, simulationDay;
           month = sqlite3_column_int(sqlStmtPtr, 0);
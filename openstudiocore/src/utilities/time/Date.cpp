@@ -172,7 +172,6 @@ namespace openstudio{
   Date Date::fromDayOfYear(unsigned dayOfYear)
   {
     Date result;
-    result.m_impl.reset();
     result.m_assumedBaseYear = YearDescription().assumedYear();
     result.initFromYearDayOfYear(result.m_assumedBaseYear, dayOfYear);
     return result;
@@ -181,8 +180,7 @@ namespace openstudio{
   Date Date::fromDayOfYear(unsigned dayOfYear, int year)
   {
     Date result;
-    result.m_impl.reset();
-    result.m_baseYear = year;
+    result.m_hasBaseYear = true;
     result.m_assumedBaseYear = year;
     result.initFromYearDayOfYear(year, dayOfYear);
     return result;
@@ -191,7 +189,6 @@ namespace openstudio{
   Date Date::fromDayOfYear(unsigned dayOfYear, const YearDescription& yearDescription)
   {
     Date result;
-    result.m_impl.reset();
     result.m_assumedBaseYear = yearDescription.assumedYear();
     result.initFromYearDayOfYear(result.m_assumedBaseYear, dayOfYear);
     return result;
@@ -212,71 +209,55 @@ namespace openstudio{
 
   /// default constructor
   Date::Date()
-    : m_assumedBaseYear(YearDescription().assumedYear())
+    : m_assumedBaseYear(YearDescription().assumedYear()), m_hasBaseYear(false)
   {
     initFromYearDayOfYear(m_assumedBaseYear, 1);
   }
 
   /// from impl
   Date::Date(const Date::ImplType& impl)
-    : m_assumedBaseYear(impl.year()),
-      m_impl(ImplPtr(new ImplType(impl)))
+    : m_impl(impl), m_assumedBaseYear(impl.year()), m_hasBaseYear(false)
   {}
 
   /// Date from month, day of month
   Date::Date(MonthOfYear monthOfYear, unsigned dayOfMonth)
-    : m_assumedBaseYear(YearDescription().assumedYear())
+    : m_assumedBaseYear(YearDescription().assumedYear()), m_hasBaseYear(false)
   {
     initFromYearMonthDay(m_assumedBaseYear, monthOfYear, dayOfMonth);
   }
 
   /// Date from month, day, year
   Date::Date(MonthOfYear monthOfYear, unsigned dayOfMonth, int year)
-    : m_baseYear(year), m_assumedBaseYear(year)
+    : m_assumedBaseYear(year), m_hasBaseYear(true)
   {
     initFromYearMonthDay(year, monthOfYear, dayOfMonth);
   }
 
   /// Date from month, day of month, and YearDescription
   Date::Date(MonthOfYear monthOfYear, unsigned dayOfMonth, const YearDescription& yearDescription)
-    : m_assumedBaseYear(yearDescription.assumedYear())
+    : m_assumedBaseYear(yearDescription.assumedYear()), m_hasBaseYear(false)
   {
     initFromYearMonthDay(m_assumedBaseYear, monthOfYear, dayOfMonth);
   }
 
   Date::Date(const std::string& string)
+    : m_hasBaseYear(false)
   {
     std::stringstream ss;
     ss << string;
-    boost::gregorian::date date;
-    ss >> date;
+    ss >> m_impl;
 
-    m_impl = std::shared_ptr<boost::gregorian::date>(new boost::gregorian::date(date));
+    m_assumedBaseYear = m_impl.is_special() ? YearDescription().assumedYear() : int(m_impl.year());
   }
 
   /// from tm
   Date::Date(tm t_tm)
-    : m_impl(new ImplType(boost::gregorian::date_from_tm(t_tm))),
-      m_baseYear(m_impl->year()),
-      m_assumedBaseYear(m_impl->year())
+    : m_impl(boost::gregorian::date_from_tm(t_tm)),
+      m_assumedBaseYear(m_impl.year()),
+      m_hasBaseYear(true)
   {
   }
 
-  /// copy constructor
-  Date::Date(const Date& other)
-    : m_baseYear(other.baseYear()), m_assumedBaseYear(other.assumedBaseYear())
-  {
-    initFromYearMonthDay(other.year(), other.monthOfYear(), other.dayOfMonth());
-  }
-
-  Date &Date::operator=(const Date &other)
-  {
-    m_baseYear = other.m_baseYear;
-    m_assumedBaseYear = other.m_assumedBaseYear;
-    m_impl = std::shared_ptr<ImplType>(new ImplType(*other.m_impl));
-    return *this;
-  }
-
   /// assignment by addition operator
   Date Date::operator+ (const Time& time) const
   {
@@ -288,7 +269,7 @@ namespace openstudio{
   /// assignment by addition operator
   Date& Date::operator+= (const Time& time)
   {
-    (*m_impl) += date_duration(time.days());
+    m_impl += date_duration(time.days());
     return *this;
   }
 
@@ -303,25 +284,21 @@ namespace openstudio{
   /// assignment by difference operator
   Date& Date::operator-= (const Time& time)
   {
-    (*m_impl) -= date_duration(time.days());
+    m_impl -= date_duration(time.days());
     return *this;
   }
 
   /// time duration
   Time Date::operator- (const Date& date) const
   {
-    boost::gregorian::date_duration duration( (*m_impl)-(*date.m_impl) );
+    boost::gregorian::date_duration duration( m_impl-date.m_impl );
     return Time(duration.days());
   }
 
   /// equality operator
   bool Date::operator== (const Date& other) const
   {
-    bool result = ( (year() == other.year()) &&
-          (monthOfYear() == other.monthOfYear()) &&
-          (dayOfMonth() == other.dayOfMonth()) ); 
-
-    return result;
+    return (m_impl == other.m_impl);
   }
 
   /// non-equality operator
@@ -338,19 +315,7 @@ namespace openstudio{
       LOG(Error, "Comparing Dates with improper base years");
     }
 
-    bool result = false;
-    if (year() < rhs.year()){
-      result = true;
-    }else if (year() == rhs.year()){
-      if (monthOfYear() < rhs.monthOfYear()){
-        result = true;
-      }else if (monthOfYear() == rhs.monthOfYear()){
-        if (dayOfMonth() < rhs.dayOfMonth()){
-          result = true;
-        }
-      }
-    }
-    return result;
+    return (m_impl < rhs.m_impl);
   }
 
   /// less than equals operator
@@ -374,13 +339,16 @@ namespace openstudio{
   /// base year
   optional<int> Date::baseYear() const
   {
-    return m_baseYear;
+    if (m_hasBaseYear){
+      return m_assumedBaseYear;
+    }
+    return boost::none;
   }
 
   /// set  base year
   void Date::baseYear(int baseYear)
   {
-    m_baseYear = baseYear;
+    m_hasBaseYear = true;
     m_assumedBaseYear = baseYear;
   }
 
@@ -392,25 +360,25 @@ namespace openstudio{
 
   int Date::year() const
   {
-    return m_impl->year();
+    return m_impl.year();
   }
 
   /// month of year
   MonthOfYear Date::monthOfYear() const
   {
-    return m_impl->month().as_enum();
+    return m_impl.month().as_enum();
   }
 
   /// day of month
   unsigned Date::dayOfMonth() const
   {
-    return m_impl->day();
+    return m_impl.day();
   };
 
   /// day of year
   unsigned Date::dayOfYear() const
   {
-    return m_impl->day_of_year();
+    return m_impl.day_of_year();
   };
 
   /// is year a leap year
@@ -422,7 +390,7 @@ namespace openstudio{
   /// day of the week
   DayOfWeek Date::dayOfWeek() const
   {
-    return DayOfWeek(m_impl->day_of_week());
+    return DayOfWeek(m_impl.day_of_week());
   };
 
   // initFromYearMonthDay
@@ -430,11 +398,12 @@ namespace openstudio{
   {
     try{
       // construct with year, month, day
-      m_impl = ImplPtr(new ImplType(year, monthOfYear.value(), dayOfMonth));
+      m_impl = ImplType(year, monthOfYear.value(), dayOfMonth);
     }catch(...){
+      m_impl = ImplType(boost::gregorian::not_a_date_time);
     }
 
-    if (!m_impl || m_impl->is_not_a_date()){
+    if (m_impl.is_not_a_date()){
       LOG_AND_THROW("Bad Date: year = " << year << ", month = " << monthOfYear << 
           ", day = " << dayOfMonth << ". ");
     }
@@ -455,17 +424,17 @@ namespace openstudio{
       // we override wrapped class and only allow dayOfYear >= 1 and <= daysInYear
       if ((dayOfYear >= 1) && (dayOfYear <= daysInYear)){
 
-        // construct at Jan, 1 of year
-        m_impl = ImplPtr(new ImplType(year, 1, 1));
-
-        // add day of year minus one to impl
-        (*m_impl) += date_duration(dayOfYear-1);
-      };
+        // construct at Jan, 1 of year, and add day of year minus one
+        m_impl = ImplType(year, 1, 1) + date_duration(dayOfYear-1);
+      }else{
+        m_impl = ImplType(boost::gregorian::not_a_date_time);
+      }
 
     }catch(...){
+      m_impl = ImplType(boost::gregorian::not_a_date_time);
     }
 
-    if (!m_impl || m_impl->is_not_a_date() ){
+    if (m_impl.is_not_a_date()){
       LOG_AND_THROW("Bad Date: year = " << year << ", dayOfYear = " << dayOfYear <<  ". ");
     }
   }
@@ -473,7 +442,7 @@ namespace openstudio{
   // reference to impl
   const Date::ImplType& Date::impl() const
   {
-    return *m_impl;
+    return m_impl;
   }
 
   // std::ostream operator<<
@@ -163,7 +163,8 @@ namespace openstudio{
   class DateTime;
 
   /// Date is an absolute unit of time, resolution to the day
-  /// Date is simple wrapper around boost::gregorian::date
+  /// Date is simple wrapper around boost::gregorian::date, which it holds by value (a day number),
+  /// so Dates are cheap to copy and do not allocate
   class UTILITIES_API Date
   {
   public:
@@ -174,7 +175,6 @@ namespace openstudio{
 
     /// impl type is boost::gregorian::date
     typedef boost::gregorian::date ImplType;
-    typedef std::shared_ptr<ImplType> ImplPtr;
 
     REGISTER_LOGGER("utilities.time.Date");
 
@@ -196,9 +196,6 @@ namespace openstudio{
     /// default constructor
     Date();
 
-    /// destructor
-    ~Date(){}
-
     /// from impl
     Date(const ImplType& impl);
 
@@ -218,7 +215,7 @@ namespace openstudio{
     Date(tm t_tm);
 
     /// copy constructor
-    Date(const Date& other);
+    Date(const Date& other) = default;
 
     /// addition operator
     Date operator+ (const Time& time) const;
@@ -254,7 +251,7 @@ namespace openstudio{
     bool operator>= (const Date& rhs) const;
 
     /// assignment operator
-    Date &operator=(const Date &other);
+    Date &operator=(const Date &other) = default;
 
     /// user provided base year
     boost::optional<int> baseYear() const;
@@ -296,14 +293,14 @@ namespace openstudio{
     // initFromYearDayOfYear
     void initFromYearDayOfYear(int year, unsigned dayOfYear);
 
-    // pointer to impl
-    ImplPtr m_impl;
-
-    // user provided base year is optional
-    boost::optional<int> m_baseYear;
+    // impl
+    ImplType m_impl;
 
     // always have assumed base year
     int m_assumedBaseYear;
+
+    // whether the assumed base year was provided by the user, in which case it is also the base year
+    bool m_hasBaseYear;
   };
 
   /// optional Date
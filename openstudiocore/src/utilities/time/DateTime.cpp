@@ -52,13 +52,6 @@ DateTime::DateTime(const Date& date, const Time& timeFromDate)
   normalize();
 }
 
-/// copy constructor
-DateTime::DateTime(const DateTime& other)
-  : m_date(other.date()), m_time(other.time())
-{
-  // should not need to normalize
-}
-
 DateTime::DateTime(const std::string& string)
   : m_date(), m_time()
 {
@@ -72,17 +65,6 @@ DateTime::DateTime(tm t_tm)
 {
 }
 
-/// assignment operator
-DateTime& DateTime::operator= (const DateTime& other)
-{
-  m_date = Date(other.date());
-  m_time = Time(other.time());
-
-  // should not need to normalize
-
-  return *this;
-}
-
 /// addition operator
 DateTime DateTime::operator+ (const Time& time) const
 {
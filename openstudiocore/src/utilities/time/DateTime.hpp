@@ -40,6 +40,7 @@ namespace openstudio{
 /// DateTime is an absolute unit of time, resolution to the second
 /// date is a valid Date
 /// time is normalized to 0 <= time < 24 hrs
+/// like Date and Time, DateTime is a plain value that does not allocate
 class UTILITIES_API DateTime {
  public:
 
@@ -58,7 +59,7 @@ class UTILITIES_API DateTime {
   DateTime(const Date& date, const Time& timeFromDate);
 
   /// copy constructor
-  DateTime(const DateTime& other);
+  DateTime(const DateTime& other) = default;
 
   /// constructor from string
   DateTime(const std::string& string);
@@ -67,7 +68,7 @@ class UTILITIES_API DateTime {
   DateTime(tm t_tm);
 
   /// assignment operator
-  DateTime& operator= (const DateTime& other);
+  DateTime& operator= (const DateTime& other) = default;
 
   /// addition operator
   DateTime operator+ (const Time& time) const;
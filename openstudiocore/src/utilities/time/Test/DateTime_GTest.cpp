@@ -24,6 +24,8 @@
 
 #include <string>
 
+#include <boost/timer.hpp>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -178,6 +180,87 @@ TEST(DateTime,ISO8601Conversions) {
   EXPECT_EQ(dateTime,copy.get());
 }
 
+TEST(DateTime,ValueSemantics) {
+  DateTime dateTime(Date(MonthOfYear::Mar,1,2008),Time(0,12,0,0));
+  DateTime copy(dateTime);
+  copy += Time(1,0,0,0);
+  EXPECT_EQ(Date(MonthOfYear::Mar,1,2008),dateTime.date());
+  EXPECT_EQ(Date(MonthOfYear::Mar,2,2008),copy.date());
+
+  copy = dateTime;
+  EXPECT_EQ(dateTime,copy);
+  ASSERT_TRUE(copy.date().baseYear());
+  EXPECT_EQ(2008,copy.date().baseYear().get());
+
+  Date date(MonthOfYear::Feb,28);
+  Date dateCopy = date;
+  EXPECT_FALSE(dateCopy.baseYear());
+  EXPECT_EQ(date.assumedBaseYear(),dateCopy.assumedBaseYear());
+  dateCopy.baseYear(2012);
+  EXPECT_FALSE(date.baseYear());
+  ASSERT_TRUE(dateCopy.baseYear());
+  EXPECT_EQ(2012,dateCopy.baseYear().get());
+  EXPECT_EQ(2012,dateCopy.assumedBaseYear());
+}
+
+TEST(DateTime,Performance_DateTimeVector) {
+  // a year of 15 minute data
+  unsigned n = 35040;
+  DateTime start(Date(MonthOfYear::Jan,1,2009),Time(0,0,15,0));
+
+  boost::timer t;
+  DateTimeVector dateTimes;
+  dateTimes.reserve(n);
+  for (unsigned i = 0; i < n; ++i) {
+    dateTimes.push_back(start + Time(0,0,15*i,0));
+  }
+  double buildTime = t.elapsed();
+
+  t.restart();
+  DateTimeVector copies(dateTimes);
+  double copyTime = t.elapsed();
+
+  ASSERT_EQ(n,dateTimes.size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan,2,2009),Time(0,0,0,0)),dateTimes[95]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan,1,2010),Time(0,0,0,0)),dateTimes.back());
+  EXPECT_TRUE(copies == dateTimes);
+
+  LOG_FREE(Info,"DateTime_GTest","Building " << n << " DateTimes: " << buildTime
+           << ", copying them: " << copyTime);
+}
+
+TEST(DateTime,Performance_DateArithmetic) {
+  unsigned n = 100000;
+  Date start(MonthOfYear::Jan,1,2009);
+
+  boost::timer t;
+  Date date = start;
+  int days = 0;
+  for (unsigned i = 0; i < n; ++i) {
+    date += Time(1,0,0,0);
+    days += (date - start).days();
+    if (date.dayOfYear() == 1) {
+      date = start;
+    }
+  }
+  double dateElapsed = t.elapsed();
+
+  t.restart();
+  DateTime dateTime0(start);
+  DateTime dateTime1(start);
+  Time elapsed;
+  for (unsigned i = 0; i < n; ++i) {
+    dateTime1 += Time(0,0,10,0);
+    elapsed = dateTime1 - dateTime0;
+  }
+  double dateTimeTime = t.elapsed();
+
+  EXPECT_GT(days,0);
+  EXPECT_EQ(n * 600,unsigned(elapsed.totalSeconds()));
+
+  LOG_FREE(Info,"DateTime_GTest","Date arithmetic: " << dateElapsed << ", DateTime arithmetic: " << dateTimeTime);
+}
+
 
 /////////////////////////////////////////////////////////////
 // Calendar for 2008.  Format is day of month, day of year //
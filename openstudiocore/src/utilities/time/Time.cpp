@@ -47,7 +47,7 @@ namespace openstudio{
 
   /// Default constructor
   Time::Time() :
-    m_impl(ImplPtr(new ImplType(0, 0, 0, 0)))
+    m_impl(0, 0, 0, 0)
   {}
 
   /// Time from number of days, fractional values ok
@@ -62,7 +62,7 @@ namespace openstudio{
     double fracSeconds = SECONDS_PER_MINUTE * (fracMinutes-minutes);
     int seconds = floor0(fracSeconds);
 
-    m_impl = ImplPtr(new ImplType(hours, minutes, seconds, 0));
+    m_impl = ImplType(hours, minutes, seconds, 0);
   }
 
   /// Time from days, hours, minutes, seconds
@@ -71,44 +71,30 @@ namespace openstudio{
     hours += HOURS_PER_DAY*days;
     if ((hours*minutes >= 0) && (hours*seconds >= 0) && (minutes*seconds >= 0)) {
       // same sign, carry on
-      m_impl = ImplPtr(new ImplType(hours, minutes, seconds, 0));
+      m_impl = ImplType(hours, minutes, seconds, 0);
     }
     else {
       // mixed sign
       ImplType negativeDuration(std::min(hours,0),std::min(minutes,0),std::min(seconds,0),0);
-      m_impl = ImplPtr(new ImplType(std::max(hours,0),std::max(minutes,0),std::max(seconds,0),0));
-      *m_impl += negativeDuration;
+      m_impl = ImplType(std::max(hours,0),std::max(minutes,0),std::max(seconds,0),0);
+      m_impl += negativeDuration;
     }
   }
 
   Time::Time(const std::string& string)
+    : m_impl(boost::posix_time::duration_from_string(string))
   {
-    boost::posix_time::time_duration td = boost::posix_time::duration_from_string(string);
-
-    m_impl = std::shared_ptr<boost::posix_time::time_duration>(new boost::posix_time::time_duration(td));
   }
 
   Time::Time(tm t_tm)
-    : m_impl(new ImplType(t_tm.tm_hour, t_tm.tm_min, t_tm.tm_sec))
+    : m_impl(t_tm.tm_hour, t_tm.tm_min, t_tm.tm_sec)
   {
   }
 
-  /// copy constructor
-  Time::Time(const Time& other) :
-    m_impl(ImplPtr(new ImplType(other.impl())))
-  {}
-
   /// Time from impl 
   Time::Time(const ImplType& implType)
+    : m_impl(implType)
   {
-    m_impl = ImplPtr(new ImplType(implType));
-  }
-
-  /// assignment operator
-  Time& Time::operator= (const Time& other)
-  {
-    m_impl = ImplPtr(new ImplType(other.impl()));
-    return *this;
   }
 
   /// addition operator
@@ -122,14 +108,14 @@ namespace openstudio{
   /// assignment by addition operator
   Time& Time::operator+= (const Time& time)
   {
-    (*m_impl)+= time.impl();
+    m_impl += time.m_impl;
     return *this;
   }
 
 
   std::string Time::toString() const
   {
-    return boost::posix_time::to_simple_string(*m_impl);
+    return boost::posix_time::to_simple_string(m_impl);
   }
 
   /// difference operator
@@ -143,7 +129,7 @@ namespace openstudio{
   /// assignment by difference operator
   Time& Time::operator-= (const Time& time)
   {
-    (*m_impl)-= time.impl();
+    m_impl -= time.m_impl;
     return *this;
   }
 
@@ -204,19 +190,19 @@ namespace openstudio{
   /// whole number of hours remaining after days
   int Time::hours() const
   {
-    return (m_impl->hours() % 24);
+    return (m_impl.hours() % 24);
   }
 
   /// whole number of minutes remaining after hours
   int Time::minutes() const
   {
-    return m_impl->minutes();
+    return m_impl.minutes();
   }
 
   /// whole number of seconds remaining after minutes
   int Time::seconds() const
   {
-    return m_impl->seconds();
+    return m_impl.seconds();
   }
 
   /// entire time in days
@@ -240,13 +226,13 @@ namespace openstudio{
   /// entire time in seconds
   int Time::totalSeconds() const
   {
-    return m_impl->total_seconds();
+    return m_impl.total_seconds();
   }
 
   // reference to impl
   const Time::ImplType& Time::impl() const
   {
-    return (*m_impl);
+    return m_impl;
   }
 
   // std::ostream operator<<
@@ -46,7 +46,8 @@ namespace openstudio{
   class DateTime;
 
   /// Time is a relative unit of time, resolution to the second
-  /// Time is simple wrapper around boost::posix_time::time_duration
+  /// Time is simple wrapper around boost::posix_time::time_duration, which it holds by value (a tick count),
+  /// so Times are cheap to copy and do not allocate
   /// Internally totalSeconds is the primary definition of time 
   /// (i.e. it does not matter how time is divided into hours, minutes, seconds)
   class UTILITIES_API Time
@@ -59,8 +60,6 @@ namespace openstudio{
 
       /// impl type is boost::posix_time::time_duration
       typedef boost::posix_time::time_duration ImplType;
-      typedef std::shared_ptr<ImplType> ImplPtr;
-
 
       /// get current time of day
       static Time currentTime();
@@ -84,10 +83,10 @@ namespace openstudio{
       Time(const std::string& string);
 
       /// copy constructor
-      Time(const Time& other);
+      Time(const Time& other) = default;
 
       /// assignment operator
-      Time& operator= (const Time& other);
+      Time& operator= (const Time& other) = default;
 
       /// addition operator
       Time operator+ (const Time& time) const;
@@ -160,8 +159,8 @@ namespace openstudio{
     private:
       REGISTER_LOGGER("utilities.time.Time");
 
-      // pointer to impl
-      ImplPtr m_impl;
+      // impl
+      ImplType m_impl;
   };
 
   /// optional Time
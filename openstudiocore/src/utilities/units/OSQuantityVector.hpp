@@ -171,6 +171,10 @@ class UTILITIES_API OSQuantityVector {
 
   //@}
  private:
+  // conversions write the converted values straight into m_values
+  friend UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys);
+  friend UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits);
+
   Unit m_units;
   std::vector<double> m_values;
 
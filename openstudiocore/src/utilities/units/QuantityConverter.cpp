@@ -35,8 +35,86 @@
 
 #include "../core/Assert.hpp"
 
+#include <QMutexLocker>
+
 namespace openstudio {
 
+namespace {
+
+  // Converting a power of two and dividing it back out is exact for purely multiplicative
+  // conversions, and keeps the error in the factor small when there is a large offset (as with
+  // temperatures) in the way a probe value of 1 would not.
+  const double conversionPlanProbe = 1024.0;
+
+  UnitConversionPlan makeConversionPlan(const Quantity& offset, const Quantity& probe) {
+    UnitConversionPlan result;
+    result.factor = (probe.value() - offset.value()) / conversionPlanProbe;
+    result.offset = offset.value();
+    return result;
+  }
+
+}
+
+boost::optional<UnitConversionPlan> QuantityConverterSingleton::conversionPlan(
+    const std::string& originalUnits, const std::string& finalUnits) const
+{
+  std::pair<std::string,std::string> key(originalUnits,finalUnits);
+
+  QMutexLocker lock(&m_conversionPlansMutex);
+
+  auto it = m_conversionPlans.find(key);
+  if (it != m_conversionPlans.end()) {
+    return it->second;
+  }
+
+  boost::optional<UnitConversionPlan> result;
+  if (originalUnits == finalUnits) {
+    UnitConversionPlan identity;
+    identity.factor = 1.0;
+    identity.offset = 0.0;
+    result = identity;
+  }
+  else {
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+    if (originalUnit && finalUnit) {
+      if (boost::optional<std::pair<UnitConversionPlan,Unit> > plan = conversionPlan(*originalUnit,*finalUnit)) {
+        result = plan->first;
+      }
+    }
+  }
+
+  // failures are cached too, so that bad unit strings are only reported once
+  m_conversionPlans.insert(ConversionPlanMap::value_type(key,result));
+  return result;
+}
+
+boost::optional<std::pair<UnitConversionPlan,Unit> > QuantityConverterSingleton::conversionPlan(
+    const Unit& originalUnits, const Unit& targetUnits) const
+{
+  OptionalQuantity offset = convert(Quantity(0.0,originalUnits),targetUnits);
+  if (!offset) {
+    return boost::none;
+  }
+  OptionalQuantity probe = convert(Quantity(conversionPlanProbe,originalUnits),targetUnits);
+  OS_ASSERT(probe);
+  OS_ASSERT(offset->units() == probe->units());
+  return std::make_pair(makeConversionPlan(*offset,*probe),offset->units());
+}
+
+boost::optional<std::pair<UnitConversionPlan,Unit> > QuantityConverterSingleton::conversionPlan(
+    const Unit& originalUnits, UnitSystem sys) const
+{
+  OptionalQuantity offset = convert(Quantity(0.0,originalUnits),sys);
+  if (!offset) {
+    return boost::none;
+  }
+  OptionalQuantity probe = convert(Quantity(conversionPlanProbe,originalUnits),sys);
+  OS_ASSERT(probe);
+  OS_ASSERT(offset->units() == probe->units());
+  return std::make_pair(makeConversionPlan(*offset,*probe),offset->units());
+}
+
 boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity &q,
                                                               UnitSystem sys) const
 {
@@ -503,23 +581,9 @@ boost::optional<double> convert(double original, const std::string& originalUnit
     return original;
   }
 
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
-
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
-
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
-
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
-  
-    //if the conversion 
-    if (finalQuant) {
-      return finalQuant->value();
-    }
+  boost::optional<UnitConversionPlan> plan = QuantityConverter::instance().conversionPlan(originalUnits, finalUnits);
+  if (plan) {
+    return plan->apply(original);
   }
 
   return boost::none;
@@ -531,17 +595,16 @@ boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
 
 OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys) {
   OSQuantityVector result;
-  Quantity testQuantity(0.0,original.units());
-  OptionalQuantity offset = convert(testQuantity,sys);
-  if (!offset) {
+  boost::optional<std::pair<UnitConversionPlan,Unit> > plan =
+      QuantityConverter::instance().conversionPlan(original.units(),sys);
+  if (!plan) {
     return result;
   }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity,sys);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
+  result.m_units = plan->second;
+  result.m_values = original.m_values;
+  for (double& value : result.m_values) {
+    value = plan->first.apply(value);
+  }
   return result;
 }
 
@@ -551,17 +614,16 @@ boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUn
 
 OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits) {
   OSQuantityVector result;
-  Quantity testQuantity(0.0,original.units());
-  OptionalQuantity offset = convert(testQuantity,targetUnits);
-  if (!offset) {
+  boost::optional<std::pair<UnitConversionPlan,Unit> > plan =
+      QuantityConverter::instance().conversionPlan(original.units(),targetUnits);
+  if (!plan) {
     return result;
   }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity,targetUnits);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(),original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
+  result.m_units = plan->second;
+  result.m_values = original.m_values;
+  for (double& value : result.m_values) {
+    value = plan->first.apply(value);
+  }
   return result;
 }
 
@@ -27,6 +27,8 @@
 #include <string>
 #include <map>
 
+#include <QMutex>
+
 class QDomElement;
 
 namespace openstudio {
@@ -73,6 +75,16 @@ struct baseUnitConversionFactor {
   double offset;
 };
 
+/** The conversion between two fixed sets of units, resolved once. Every conversion that
+ *  QuantityConverter performs is affine in the value being converted, so once factor and offset
+ *  are known, converting a value no longer requires any Unit objects. */
+struct UTILITIES_API UnitConversionPlan {
+  double factor;
+  double offset;
+
+  double apply(double value) const { return value * factor + offset; }
+};
+
 /** Singleton for converting quantities to different \link UnitSystem unit systems \endlink or
  *  to targeted \link Unit units \endlink */
 class UTILITIES_API QuantityConverterSingleton {
@@ -85,6 +97,21 @@ class UTILITIES_API QuantityConverterSingleton {
 
   boost::optional<Quantity> convert(const Quantity &original, const Unit& targetUnits) const;
 
+  /** Returns the plan for converting values in originalUnits to finalUnits. Plans are cached by
+   *  unit string pair, so the strings are only parsed the first time a pair is requested. */
+  boost::optional<UnitConversionPlan> conversionPlan(const std::string& originalUnits,
+                                                     const std::string& finalUnits) const;
+
+  /** Returns the plan for converting values in originalUnits to targetUnits, and the units of
+   *  the converted values. Not cached. */
+  boost::optional<std::pair<UnitConversionPlan,Unit> > conversionPlan(const Unit& originalUnits,
+                                                                      const Unit& targetUnits) const;
+
+  /** Returns the plan for converting values in originalUnits to sys, and the units of the
+   *  converted values. Not cached. */
+  boost::optional<std::pair<UnitConversionPlan,Unit> > conversionPlan(const Unit& originalUnits,
+                                                                      UnitSystem sys) const;
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
@@ -102,12 +129,19 @@ class UTILITIES_API QuantityConverterSingleton {
   boost::optional<Quantity> m_convertToTargetFromSI(const Quantity& original,
                                                     const Unit& targetUnits) const;
 
+  typedef std::map<std::pair<std::string,std::string>,boost::optional<UnitConversionPlan> > ConversionPlanMap;
+
+  mutable ConversionPlanMap m_conversionPlans;
+  mutable QMutex m_conversionPlansMutex;
+
 };
 
 /** \relates QuantityConverterSingleton */
 typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 
-/** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
+/** Non-member function to simplify interface for users. The conversion between each pair of unit
+ *  strings is resolved once and cached, see QuantityConverterSingleton::conversionPlan.
+ *  \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
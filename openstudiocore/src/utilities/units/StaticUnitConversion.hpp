@@ -0,0 +1,117 @@
+/**********************************************************************
+ *  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+ *  All rights reserved.
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ **********************************************************************/
+
+#ifndef UTILITIES_UNITS_STATICUNITCONVERSION_HPP
+#define UTILITIES_UNITS_STATICUNITCONVERSION_HPP
+
+#include <type_traits>
+
+namespace openstudio {
+
+/** Units known at compile time, for internal call sites that convert the same, fixed units over
+ *  and over (e.g. while reading or writing weather and results data). Each unit is a tag type
+ *  with a dimension and the affine map onto its SI equivalent, si = value * factor() + offset(),
+ *  using the same factors QuantityConverter registers for the corresponding base units. Unlike
+ *  openstudio::convert(double,const std::string&,const std::string&), nothing is parsed or looked
+ *  up at run time, and converting between units of different dimension does not compile:
+ *
+ *  \code
+ *  double tdb = staticunits::convert<staticunits::Celsius,staticunits::Kelvin>(value);
+ *  \endcode
+ *
+ *  Anything not listed here, or whose units are only known at run time, should go through
+ *  QuantityConverter. */
+namespace staticunits {
+
+  /** @name Dimensions */
+  //@{
+
+  struct Length {};
+  struct Area {};
+  struct Volume {};
+  struct Temperature {};
+  struct Power {};
+  struct Energy {};
+  struct Velocity {};
+  struct VolumetricFlowRate {};
+  struct Pressure {};
+
+  //@}
+  /** @name Units */
+  //@{
+
+  struct Meters { typedef Length dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct Feet { typedef Length dimension; static double factor() { return 0.3048; } static double offset() { return 0.0; } };
+  struct Inches { typedef Length dimension; static double factor() { return 0.0254; } static double offset() { return 0.0; } };
+
+  struct SquareMeters { typedef Area dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct SquareFeet { typedef Area dimension; static double factor() { return 0.3048 * 0.3048; } static double offset() { return 0.0; } };
+
+  struct CubicMeters { typedef Volume dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct CubicFeet { typedef Volume dimension; static double factor() { return 0.3048 * 0.3048 * 0.3048; } static double offset() { return 0.0; } };
+
+  struct Kelvin { typedef Temperature dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct Celsius { typedef Temperature dimension; static double factor() { return 1.0; } static double offset() { return 273.15; } };
+  struct Rankine { typedef Temperature dimension; static double factor() { return 0.55555555555555556; } static double offset() { return 0.0; } };
+  struct Fahrenheit { typedef Temperature dimension; static double factor() { return 0.555555555555555555556; } static double offset() { return 255.37222222222222222222222; } };
+
+  struct Watts { typedef Power dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct BtuPerHour { typedef Power dimension; static double factor() { return 1055.05585262 / 3600.0; } static double offset() { return 0.0; } };
+  struct Tons { typedef Power dimension; static double factor() { return 3516.85284207; } static double offset() { return 0.0; } };
+
+  struct Joules { typedef Energy dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct Btu { typedef Energy dimension; static double factor() { return 1055.05585262; } static double offset() { return 0.0; } };
+  struct KilowattHours { typedef Energy dimension; static double factor() { return 3.6e6; } static double offset() { return 0.0; } };
+
+  struct MetersPerSecond { typedef Velocity dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct MetersPerHour { typedef Velocity dimension; static double factor() { return 1.0 / 3600.0; } static double offset() { return 0.0; } };
+  struct FeetPerMinute { typedef Velocity dimension; static double factor() { return 0.3048 / 60.0; } static double offset() { return 0.0; } };
+
+  struct CubicMetersPerSecond { typedef VolumetricFlowRate dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct CubicFeetPerMinute { typedef VolumetricFlowRate dimension; static double factor() { return 0.3048 * 0.3048 * 0.3048 / 60.0; } static double offset() { return 0.0; } };
+
+  struct Pascals { typedef Pressure dimension; static double factor() { return 1.0; } static double offset() { return 0.0; } };
+  struct InchesOfWater { typedef Pressure dimension; static double factor() { return 249.08891; } static double offset() { return 0.0; } };
+
+  //@}
+
+  /** Converts value from units From to units To. */
+  template<class From, class To>
+  inline double convert(double value) {
+    static_assert(std::is_same<typename From::dimension, typename To::dimension>::value,
+                  "staticunits::convert requires units of the same dimension");
+    return ((value * From::factor() + From::offset()) - To::offset()) / To::factor();
+  }
+
+  /** Converts every element of values from units From to units To, in place. Container is any
+   *  sequence of doubles, e.g. std::vector<double>. */
+  template<class From, class To, class Container>
+  inline void convertInPlace(Container& values) {
+    static_assert(std::is_same<typename From::dimension, typename To::dimension>::value,
+                  "staticunits::convertInPlace requires units of the same dimension");
+    for (double& value : values) {
+      value = ((value * From::factor() + From::offset()) - To::offset()) / To::factor();
+    }
+  }
+
+} // staticunits
+
+} // openstudio
+
+#endif // UTILITIES_UNITS_STATICUNITCONVERSION_HPP
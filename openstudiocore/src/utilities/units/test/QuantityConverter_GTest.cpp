@@ -33,6 +33,12 @@
 #include "../IPUnit.hpp"
 #include "../SIUnit.hpp"
 #include "../Unit.hpp"
+#include "../StaticUnitConversion.hpp"
+
+#include <boost/timer.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 using namespace openstudio;
 
@@ -258,3 +264,115 @@ TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
 TEST_F(UnitsFixture,QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector,UnitSystem(UnitSystem::Wh));
 }
+
+TEST_F(UnitsFixture,QuantityConverter_ConversionPlan) {
+  // plans agree with converting through Quantity
+  std::vector<std::pair<std::string,std::string> > pairs;
+  pairs.push_back(std::make_pair("ft","m"));
+  pairs.push_back(std::make_pair("m^2","ft^2"));
+  pairs.push_back(std::make_pair("W","Btu/h"));
+  pairs.push_back(std::make_pair("kW","W"));
+  pairs.push_back(std::make_pair("m^3/s","ft^3/min"));
+  pairs.push_back(std::make_pair("C","K"));
+  pairs.push_back(std::make_pair("C","F"));
+  pairs.push_back(std::make_pair("F","C"));
+  pairs.push_back(std::make_pair("1/s","1/h"));
+  for (const auto& p : pairs) {
+    SCOPED_TRACE(p.first + " to " + p.second);
+    boost::optional<UnitConversionPlan> plan = QuantityConverter::instance().conversionPlan(p.first,p.second);
+    ASSERT_TRUE(plan);
+    OptionalUnit originalUnit = createUnit(p.first);
+    OptionalUnit finalUnit = createUnit(p.second);
+    ASSERT_TRUE(originalUnit);
+    ASSERT_TRUE(finalUnit);
+    for (double value : {-40.0, 0.0, 1.0, 20.0, 1.0E6}) {
+      OptionalQuantity expected = QuantityConverter::instance().convert(Quantity(value,*originalUnit),*finalUnit);
+      ASSERT_TRUE(expected);
+      EXPECT_NEAR(expected->value(),plan->apply(value),1.0E-12 * std::max(1.0,std::fabs(expected->value())));
+      boost::optional<double> converted = convert(value,p.first,p.second);
+      ASSERT_TRUE(converted);
+      EXPECT_DOUBLE_EQ(plan->apply(value),*converted);
+    }
+  }
+
+  EXPECT_NEAR(68.0,convert(20.0,"C","F").get(),1.0E-12);
+  EXPECT_NEAR(20.0,convert(68.0,"F","C").get(),1.0E-12);
+  EXPECT_DOUBLE_EQ(1.0,convert(1000.0,"W","kW").get());
+
+  // failures are remembered too
+  EXPECT_FALSE(QuantityConverter::instance().conversionPlan("m","K"));
+  EXPECT_FALSE(QuantityConverter::instance().conversionPlan("m","K"));
+  EXPECT_FALSE(convert(1.0,"m","K"));
+  EXPECT_FALSE(convert(1.0,"not a unit","m"));
+}
+
+TEST_F(UnitsFixture,QuantityConverter_StaticUnitConversion) {
+  using namespace staticunits;
+
+  double expected(0.0);
+  expected = convert(20.0,"C","K").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Celsius,Kelvin>(20.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(20.0,"C","F").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Celsius,Fahrenheit>(20.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(68.0,"F","C").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Fahrenheit,Celsius>(68.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(500.0,"R","K").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Rankine,Kelvin>(500.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(3.0,"ft","m").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Feet,Meters>(3.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(12.0,"in","ft").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Inches,Feet>(12.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(100.0,"m^2","ft^2").get();
+  EXPECT_NEAR(expected,(staticunits::convert<SquareMeters,SquareFeet>(100.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(2.0,"m^3","ft^3").get();
+  EXPECT_NEAR(expected,(staticunits::convert<CubicMeters,CubicFeet>(2.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(1000.0,"W","Btu/h").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Watts,BtuPerHour>(1000.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(1000.0,"W","ton").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Watts,Tons>(1000.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(1.0,"Btu","J").get();
+  EXPECT_NEAR(expected,(staticunits::convert<Btu,Joules>(1.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(3.0,"m/h","m/s").get();
+  EXPECT_NEAR(expected,(staticunits::convert<MetersPerHour,MetersPerSecond>(3.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(1.0,"m^3/s","ft^3/min").get();
+  EXPECT_NEAR(expected,(staticunits::convert<CubicMetersPerSecond,CubicFeetPerMinute>(1.0)),1.0E-12 * std::fabs(expected));
+  expected = convert(1.0,"inH_{2}O","Pa").get();
+  EXPECT_NEAR(expected,(staticunits::convert<InchesOfWater,Pascals>(1.0)),1.0E-12 * std::fabs(expected));
+
+  std::vector<double> values(3u,20.0);
+  staticunits::convertInPlace<Celsius,Fahrenheit>(values);
+  for (double value : values) {
+    EXPECT_NEAR(68.0,value,1.0E-12);
+  }
+}
+
+TEST_F(UnitsFixture,QuantityConverter_ConversionPlan_Performance) {
+  unsigned n = 100000;
+
+  boost::timer t;
+  double sum = 0.0;
+  for (unsigned i = 0; i < n; ++i) {
+    Quantity q(double(i),createCelsiusTemperature());
+    sum += QuantityConverter::instance().convert(q,createFahrenheitTemperature())->value();
+  }
+  double quantityTime = t.elapsed();
+
+  t.restart();
+  double planSum = 0.0;
+  for (unsigned i = 0; i < n; ++i) {
+    planSum += convert(double(i),"C","F").get();
+  }
+  double planTime = t.elapsed();
+
+  t.restart();
+  double staticSum = 0.0;
+  for (unsigned i = 0; i < n; ++i) {
+    staticSum += staticunits::convert<staticunits::Celsius,staticunits::Fahrenheit>(double(i));
+  }
+  double staticTime = t.elapsed();
+
+  EXPECT_NEAR(sum,planSum,1.0E-9 * sum);
+  EXPECT_NEAR(sum,staticSum,1.0E-9 * sum);
+  LOG(Info,"Converting " << n << " temperatures, Quantity: " << quantityTime << " plan: "
+      << planTime << " static: " << staticTime);
+}